@@ -1,5 +1,5 @@
 QT += core gui widgets network multimedia multimediawidgets
-QT += location quickwidgets
+QT += location positioning quick quickwidgets
 QT += serialport svg svgwidgets
 QT += webenginewidgets webchannel
 QT += multimedia-private
@@ -19,19 +19,86 @@ CONFIG += c++17
 # Kaynak dosyaları
 SOURCES += \
     src/Camera/CameraManager.cpp \
+    src/Geofence/GeofenceIndex.cpp \
+    src/Geofence/GeofenceMonitor.cpp \
     src/main.cpp \
     src/MainWindow/MainWindow.cpp \
+    src/Map/FleetState.cpp \
+    src/Map/MarkerAtlas.cpp \
+    src/Map/MarkerLayer.cpp \
+    src/Map/TileCacheServer.cpp \
+    src/Map/TilePack.cpp \
+    src/Map/TrailDecimator.cpp \
+    src/Map/TrailModel.cpp \
+    src/Map/VehicleState.cpp \
+    src/Mission/MissionModel.cpp \
+    src/Mission/MissionUploader.cpp \
+    src/Mission/SurveyGenerator.cpp \
+    src/UAV/CommandPipeline.cpp \
+    src/UAV/LinkManager.cpp \
+    src/UAV/MavlinkForwarder.cpp \
     src/UAV/UAVManager.cpp \
+    src/UAV/VehicleRegistry.cpp \
+    src/Telemetry/DerivedMetrics.cpp \
+    src/Telemetry/FlightRecorder.cpp \
+    src/Telemetry/FlightRecordingReader.cpp \
+    src/Telemetry/TelemetryArchive.cpp \
+    src/Telemetry/TelemetryArchiveCodec.cpp \
     src/Telemetry/TelemetryHandler.cpp \
+    src/Telemetry/TelemetrySubscriptionRegistry.cpp \
+    src/Telemetry/TelemetryReplay.cpp \
+    src/Telemetry/TelemetryStatistics.cpp \
+    src/Telemetry/TelemetryTimeSeries.cpp \
+    src/Terrain/TerrainDatabase.cpp \
     src/Utils/Logger.cpp \
+    src/Utils/StreamingStatistics.cpp \
+    src/Utils/TaskExecutor.cpp \
 
 # Header dosyaları
 HEADERS += \
     src/Camera/CameraManager.h \
+    src/Geofence/GeofenceIndex.h \
+    src/Geofence/GeofenceMonitor.h \
     src/MainWindow/MainWindow.h \
+    src/Map/FleetState.h \
+    src/Map/MarkerAtlas.h \
+    src/Map/MarkerLayer.h \
+    src/Map/TileCacheServer.h \
+    src/Map/TilePack.h \
+    src/Map/TrailDecimator.h \
+    src/Map/TrailModel.h \
+    src/Map/VehicleState.h \
+    src/Mission/MissionModel.h \
+    src/Mission/MissionUploader.h \
+    src/Mission/SurveyGenerator.h \
+    src/UAV/CommandPipeline.h \
+    src/UAV/LinkManager.h \
+    src/UAV/MavlinkForwarder.h \
     src/UAV/UAVManager.h \
+    src/UAV/VehicleRegistry.h \
+    src/Telemetry/DerivedMetrics.h \
+    src/Telemetry/FlightRecorder.h \
+    src/Telemetry/FlightRecordingReader.h \
+    src/Telemetry/TelemetryArchive.h \
+    src/Telemetry/TelemetryArchiveCodec.h \
     src/Telemetry/TelemetryHandler.h \
-    src/Utils/Logger.h
+    src/Telemetry/TelemetryChannel.h \
+    src/Telemetry/TelemetrySnapshot.h \
+    src/Telemetry/TelemetryRecord.h \
+    src/Terrain/TerrainDatabase.h \
+    src/Telemetry/TelemetryReplay.h \
+    src/Telemetry/TelemetryStatistics.h \
+    src/Telemetry/TelemetrySubscriptionRegistry.h \
+    src/Telemetry/TelemetryTimeSeries.h \
+    src/Utils/BitStream.h \
+    src/Utils/BoundedMpscQueue.h \
+    src/Utils/Crc32.h \
+    src/Utils/GeoMath.h \
+    src/Utils/Logger.h \
+    src/Utils/SeqLock.h \
+    src/Utils/StreamingStatistics.h \
+    src/Utils/StructuredLog.h \
+    src/Utils/TaskExecutor.h
 
 # UI dosyaları
 FORMS += \
@@ -1,14 +1,12 @@
 import QtQuick
 import QtLocation
 import QtPositioning
+import UavGroundControl.Map
 
 Rectangle {
     width: 800
     height: 600
 
-    property var uavCoordinate: QtPositioning.coordinate(39.925025, 32.836943) // UAV başlangıç konumu
-    property real uavHeading: 0 // UAV'ın yön açısı
-    property var trailPath: [] // UAV'ın geçtiği izler
     property var clickedCoordinate: QtPositioning.coordinate(0, 0) // Son tıklanan konum
 
     property double lat: 0.1
@@ -18,39 +16,61 @@ Rectangle {
         id: map
         anchors.fill: parent
         opacity: 0.99
+        // Karolar yerel karo sunucusundan gelir (TileCacheServer); paket önbelleğin kendisidir
         plugin: Plugin {
             name: "osm"
             PluginParameter {
-                name: "osm.mapping.host"
-                value: "https://api.maptiler.com/maps/satellite-v2/tiles.json?key=ClRXPuGZzvarZejWpw6q"
+                name: "osm.mapping.custom.host"
+                value: tileServerUrl
+            }
+            PluginParameter {
+                name: "osm.mapping.providersrepository.disabled"
+                value: true
+            }
+            PluginParameter {
+                name: "osm.mapping.cache.disk.size"
+                value: 0
             }
         }
+        // Özel URL harita tipi listenin sonundadır
+        activeMapType: supportedMapTypes[supportedMapTypes.length - 1]
 
-        center: uavCoordinate
+        center: QtPositioning.coordinate(39.925025, 32.836943) // UAV konumu gelene kadar başlangıç konumu
         zoomLevel: 18
 
-        // UAV'ın izini gösteren poligon
+        // Harita aracı takip eder; VehicleState kare başına en fazla bir kez değişir
+        Binding {
+            target: map
+            property: "center"
+            value: vehicleState.coordinate
+            when: vehicleState !== null && vehicleState.followVehicle && vehicleState.coordinate.isValid
+        }
+
+        Binding {
+            target: trailModel
+            property: "zoomLevel"
+            value: map.zoomLevel
+            when: trailModel !== null
+        }
+
+        // UAV'ın izi; yakınlaştırmaya göre sadeleştirilmiş köşeler TrailModel'den gelir
         MapPolyline {
             id: trail
             line.width: 3
             line.color: "#aaFF0000" // Hafif saydam kırmızı
             smooth: true
-            path: trailPath
+            path: trailModel ? trailModel.path : []
         }
 
-        // UAV'ı temsil eden SVG
-        MapQuickItem {
-            id: uavMarker
-            coordinate: uavCoordinate
-            sourceItem: Image {
-                source: "qrc:/images/images/uav.svg"
-                width: 30
-                height: 30
-                transform: Rotation {angle: uavHeading}
-            }
+        // Son köşeden aracın anlık konumuna kadar olan parça (her konumda güncellenir)
+        MapPolyline {
+            id: trailTail
+            line.width: 3
+            line.color: "#aaFF0000"
+            smooth: true
+            path: trailModel ? trailModel.tail : []
         }
 
-
         // Tıklanan yeri göstermek için işaretçi
         MapQuickItem {
             id: clickMarker
@@ -108,20 +128,78 @@ Rectangle {
                 clickMarker.visible = true; // İşareti görünür yap
             }
         }
+
+
+        // Görev rotası; noktalar MissionModel'den gelir
+        MapPolyline {
+            id: missionPath
+            line.width: 2
+            line.color: "#ddFFC107"
+            path: missionModel ? missionModel.path : []
+        }
+
+        // Araçlar, numaralı görev noktaları ve etiketler tek sahne grafiği düğümünde çizilir.
+        // Görev noktaları sürüklenerek taşınır (tıklama alanının üstünde olmalı)
+        MarkerLayer {
+            id: markerLayer
+            anchors.fill: parent
+            map: map
+            vehicle: vehicleState
+            fleet: fleetState
+            waypoints: missionModel
+            onWaypointMoved: function(index, latitude, longitude) {
+                missionModel.moveWaypoint(index, latitude, longitude);
+            }
+        }
     }
 
-    // UAV konumunu güncellemek için fonksiyon
-    function updateUAVCoordinate(latitude, longitude, heading) {
-        var newCoordinate = QtPositioning.coordinate(latitude, longitude);
-        uavCoordinate = newCoordinate;
-        uavHeading = heading;
-        //console.log("uavHeading : ",uavHeading);
+    // Görünen bölgeyi şimdiki yakınlaştırmadan üç seviye ötesine kadar pakete indirir
+    Rectangle {
+        id: prefetchButton
+        anchors.top: parent.top
+        anchors.right: parent.right
+        anchors.margins: 10
+        width: prefetchText.implicitWidth + 20
+        height: 30
+        radius: 6
+        color: "#cc263238"
+
+        property bool running: false
+
+        Text {
+            id: prefetchText
+            anchors.centerIn: parent
+            color: "white"
+            font.pixelSize: 12
+            text: "Cache visible area"
+        }
 
-        // İz bırakmak için eski konumları trail'e ekleyelim
-        if (trailPath.length === 0 || trailPath[trailPath.length - 1] !== newCoordinate) {
-            trailPath.push(newCoordinate);
+        MouseArea {
+            anchors.fill: parent
+            onClicked: {
+                if (prefetchButton.running) {
+                    tileCache.cancelPrefetch();
+                    return;
+                }
+                var region = map.visibleRegion.boundingGeoRectangle();
+                var zoom = Math.floor(map.zoomLevel);
+                prefetchButton.running = tileCache.prefetchRegion(region.topLeft.latitude, region.topLeft.longitude,
+                                                                  region.bottomRight.latitude,
+                                                                  region.bottomRight.longitude, zoom, zoom + 3);
+                prefetchText.text = prefetchButton.running ? "Preparing..." : "Area too large or offline";
+            }
         }
 
-        map.center = uavCoordinate;
+        Connections {
+            target: tileCache
+            function onPrefetchProgress(completed, total) {
+                prefetchText.text = "Caching " + completed + "/" + total + " (click to cancel)";
+            }
+            function onPrefetchFinished(downloaded, failed, cancelled) {
+                prefetchButton.running = false;
+                prefetchText.text = (cancelled ? "Cancelled: " : "Cached: ") + downloaded + " tiles"
+                                    + (failed > 0 ? ", " + failed + " failed" : "");
+            }
+        }
     }
 }
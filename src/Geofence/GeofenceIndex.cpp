@@ -0,0 +1,390 @@
+#include "GeofenceIndex.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// a->b doğrusuna göre p'nin yönü (pozitif: sol)
+double orientation(double ax, double ay, double bx, double by, double px, double py) {
+    return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+}
+
+double pointSegmentDistance(double px, double py, double ax, double ay, double bx, double by) {
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double lengthSquared = dx * dx + dy * dy;
+    double t = lengthSquared > 0.0 ? ((px - ax) * dx + (py - ay) * dy) / lengthSquared : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    const double ex = ax + t * dx - px;
+    const double ey = ay + t * dy - py;
+    return std::sqrt(ex * ex + ey * ey);
+}
+
+struct PendingEntry {
+    int cell;
+    int zone;
+    bool centerInside;
+    int edgeBegin;
+    int edgeEnd;
+};
+
+} // namespace
+
+
+GeofenceIndex::GeofenceIndex(std::vector<GeofenceZone> input) {
+    double minLat = 90.0, maxLat = -90.0, minLon = 180.0, maxLon = -180.0;
+    for (const GeofenceZone &zone : input) {
+        if (zone.ring.size() < 3) {
+            continue;
+        }
+        for (const GeoPoint &point : zone.ring) {
+            minLat = std::min(minLat, point.latitudeDeg);
+            maxLat = std::max(maxLat, point.latitudeDeg);
+            minLon = std::min(minLon, point.longitudeDeg);
+            maxLon = std::max(maxLon, point.longitudeDeg);
+        }
+    }
+    if (minLat > maxLat) {
+        return;  // Geçerli bölge yok
+    }
+    projection = GeoMath::LocalProjection((minLat + maxLat) / 2.0, (minLon + maxLon) / 2.0);
+
+    // Kenarlar bölge sırasıyla tutulur: bir bölgenin kenarları ardışıktır
+    std::vector<int> zoneEdgeBegin;
+    double maxX = 0.0, maxY = 0.0;
+    minX = minY = std::numeric_limits<double>::max();
+    maxX = maxY = std::numeric_limits<double>::lowest();
+    for (const GeofenceZone &zone : input) {
+        if (zone.ring.size() < 3) {
+            continue;
+        }
+        const int zoneIndex = static_cast<int>(zones.size());
+        zones.push_back({zone.id, zone.type, std::max(0.0, zone.marginM)});
+        zoneEdgeBegin.push_back(static_cast<int>(edges.size()));
+        hasKeepIn = hasKeepIn || zone.type == GeofenceZone::Type::KeepIn;
+        maxMarginM = std::max(maxMarginM, zones.back().marginM);
+
+        const std::size_t count = zone.ring.size();
+        for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+            Edge edge;
+            projection.toLocal(zone.ring[j].latitudeDeg, zone.ring[j].longitudeDeg, edge.ax, edge.ay);
+            projection.toLocal(zone.ring[i].latitudeDeg, zone.ring[i].longitudeDeg, edge.bx, edge.by);
+            edge.zone = zoneIndex;
+            minX = std::min(minX, edge.bx);
+            maxX = std::max(maxX, edge.bx);
+            minY = std::min(minY, edge.by);
+            maxY = std::max(maxY, edge.by);
+            if (edge.ax != edge.bx || edge.ay != edge.by) {
+                edges.push_back(edge);
+            }
+        }
+    }
+    zoneEdgeBegin.push_back(static_cast<int>(edges.size()));
+
+    // Pay yarıçapındaki sorgular da ızgaranın içine düşsün
+    const double pad = maxMarginM + MinCellSizeM;
+    minX -= pad;
+    minY -= pad;
+    maxX += pad;
+    maxY += pad;
+    const double width = maxX - minX;
+    const double height = maxY - minY;
+    // Bölgeler alana seyrek dağılmış olabilir: yoğunluğa göre hücre, kenar uzunluğunun birkaç katını geçmez
+    double totalEdgeLength = 0.0;
+    for (const Edge &edge : edges) {
+        totalEdgeLength += std::hypot(edge.bx - edge.ax, edge.by - edge.ay);
+    }
+    const double meanEdgeLength = totalEdgeLength / std::max<std::size_t>(1, edges.size());
+    const double densityCell = std::sqrt(width * height * TargetEdgesPerCell / std::max<std::size_t>(1, edges.size()));
+    cellSize = std::max(MinCellSizeM, std::min(densityCell, meanEdgeLength * TargetEdgesPerCell / 2.0));
+    for (;;) {
+        columns = std::max(1, static_cast<int>(std::ceil(width / cellSize)));
+        rows = std::max(1, static_cast<int>(std::ceil(height / cellSize)));
+        if (static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows) <= MaxCells) {
+            break;
+        }
+        cellSize *= 1.25;
+    }
+
+    std::vector<PendingEntry> pending;
+    std::vector<std::pair<int, int>> cellEdgePairs;  // (hücre, kenar)
+    std::vector<double> crossings;
+
+    for (int zone = 0; zone < static_cast<int>(zones.size()); ++zone) {
+        const int begin = zoneEdgeBegin[static_cast<std::size_t>(zone)];
+        const int end = zoneEdgeBegin[static_cast<std::size_t>(zone) + 1];
+        if (begin == end) {
+            continue;
+        }
+
+        // Kenarlar geçtikleri hücrelere dağıtılır: her satırda kenarın o satırdaki x aralığı
+        int zoneColumn0 = columns, zoneColumn1 = -1, zoneRow0 = rows, zoneRow1 = -1;
+        cellEdgePairs.clear();
+        for (int e = begin; e < end; ++e) {
+            const Edge &edge = edges[static_cast<std::size_t>(e)];
+            const double lowY = std::min(edge.ay, edge.by);
+            const double highY = std::max(edge.ay, edge.by);
+            const int row0 = std::clamp(static_cast<int>(std::floor((lowY - minY) / cellSize)), 0, rows - 1);
+            const int row1 = std::clamp(static_cast<int>(std::floor((highY - minY) / cellSize)), 0, rows - 1);
+            for (int row = row0; row <= row1; ++row) {
+                const double bandLow = std::max(lowY, minY + row * cellSize);
+                const double bandHigh = std::min(highY, minY + (row + 1) * cellSize);
+                double x0, x1;
+                if (edge.ay == edge.by) {
+                    x0 = std::min(edge.ax, edge.bx);
+                    x1 = std::max(edge.ax, edge.bx);
+                } else {
+                    const double slope = (edge.bx - edge.ax) / (edge.by - edge.ay);
+                    const double xa = edge.ax + (bandLow - edge.ay) * slope;
+                    const double xb = edge.ax + (bandHigh - edge.ay) * slope;
+                    x0 = std::min(xa, xb);
+                    x1 = std::max(xa, xb);
+                }
+                const int column0 = std::clamp(static_cast<int>(std::floor((x0 - minX) / cellSize)), 0, columns - 1);
+                const int column1 = std::clamp(static_cast<int>(std::floor((x1 - minX) / cellSize)), 0, columns - 1);
+                for (int column = column0; column <= column1; ++column) {
+                    cellEdgePairs.emplace_back(row * columns + column, e);
+                }
+                zoneColumn0 = std::min(zoneColumn0, column0);
+                zoneColumn1 = std::max(zoneColumn1, column1);
+            }
+            zoneRow0 = std::min(zoneRow0, row0);
+            zoneRow1 = std::max(zoneRow1, row1);
+        }
+        std::sort(cellEdgePairs.begin(), cellEdgePairs.end());
+
+        // Hücre merkezlerinin içeride olup olmadığı satır taramasıyla bulunur
+        std::size_t pairIndex = 0;
+        for (int row = zoneRow0; row <= zoneRow1; ++row) {
+            const double centerY = minY + (row + 0.5) * cellSize;
+            crossings.clear();
+            for (int e = begin; e < end; ++e) {
+                const Edge &edge = edges[static_cast<std::size_t>(e)];
+                if ((edge.ay <= centerY) != (edge.by <= centerY)) {
+                    crossings.push_back(edge.ax + (centerY - edge.ay) * (edge.bx - edge.ax) / (edge.by - edge.ay));
+                }
+            }
+            std::sort(crossings.begin(), crossings.end());
+
+            std::size_t crossingIndex = 0;
+            for (int column = zoneColumn0; column <= zoneColumn1; ++column) {
+                const double centerX = minX + (column + 0.5) * cellSize;
+                while (crossingIndex < crossings.size() && crossings[crossingIndex] < centerX) {
+                    ++crossingIndex;
+                }
+                const bool inside = (crossingIndex % 2) == 1;
+                const int cell = row * columns + column;
+
+                const int edgeBegin = static_cast<int>(cellEdges.size());
+                while (pairIndex < cellEdgePairs.size() && cellEdgePairs[pairIndex].first == cell) {
+                    // Komşu satır bantlarından aynı kenar tekrar gelebilir
+                    if (cellEdges.size() == static_cast<std::size_t>(edgeBegin) ||
+                        cellEdges.back() != cellEdgePairs[pairIndex].second) {
+                        cellEdges.push_back(cellEdgePairs[pairIndex].second);
+                    }
+                    ++pairIndex;
+                }
+                const int edgeEnd = static_cast<int>(cellEdges.size());
+                // Kenarsız ve merkezi dışarıda hücre bilgi taşımaz
+                if (inside || edgeEnd > edgeBegin) {
+                    pending.push_back({cell, zone, inside, edgeBegin, edgeEnd});
+                }
+            }
+        }
+    }
+
+    std::stable_sort(pending.begin(), pending.end(),
+                     [](const PendingEntry &a, const PendingEntry &b) { return a.cell < b.cell; });
+    cellStart.assign(static_cast<std::size_t>(rows) * static_cast<std::size_t>(columns) + 1, 0);
+    for (const PendingEntry &entry : pending) {
+        ++cellStart[static_cast<std::size_t>(entry.cell) + 1];
+    }
+    for (std::size_t i = 1; i < cellStart.size(); ++i) {
+        cellStart[i] += cellStart[i - 1];
+    }
+    cellZones.reserve(pending.size());
+    for (const PendingEntry &entry : pending) {
+        cellZones.push_back({entry.zone, entry.centerInside, entry.edgeBegin, entry.edgeEnd});
+    }
+}
+
+
+bool GeofenceIndex::cellOf(double x, double y, int &column, int &row) const {
+    if (columns == 0) {
+        return false;
+    }
+    const double fx = std::floor((x - minX) / cellSize);
+    const double fy = std::floor((y - minY) / cellSize);
+    if (fx < 0.0 || fy < 0.0 || fx >= columns || fy >= rows) {
+        return false;
+    }
+    column = static_cast<int>(fx);
+    row = static_cast<int>(fy);
+    return true;
+}
+
+
+bool GeofenceIndex::insideZone(const CellZone &entry, int column, int row, double x, double y) const {
+    const double centerX = minX + (column + 0.5) * cellSize;
+    const double centerY = minY + (row + 0.5) * cellSize;
+    bool inside = entry.centerInside;
+    // Merkezden noktaya doğru parçayı kesen her kenar içeride/dışarıda durumunu değiştirir.
+    // Sıfır yönelim tek tarafa sayılır, böylece parçanın köşeden geçtiği durumda çift sayım olmaz.
+    for (int i = entry.edgeBegin; i < entry.edgeEnd; ++i) {
+        const Edge &edge = edges[static_cast<std::size_t>(cellEdges[static_cast<std::size_t>(i)])];
+        const bool centerSide = orientation(edge.ax, edge.ay, edge.bx, edge.by, centerX, centerY) > 0.0;
+        const bool pointSide = orientation(edge.ax, edge.ay, edge.bx, edge.by, x, y) > 0.0;
+        if (centerSide == pointSide) {
+            continue;
+        }
+        const bool aSide = orientation(centerX, centerY, x, y, edge.ax, edge.ay) > 0.0;
+        const bool bSide = orientation(centerX, centerY, x, y, edge.bx, edge.by) > 0.0;
+        if (aSide != bSide) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+
+void GeofenceIndex::collectInside(double x, double y, std::vector<int> &zonesInside) const {
+    int column, row;
+    if (!cellOf(x, y, column, row)) {
+        return;
+    }
+    const std::size_t cell = static_cast<std::size_t>(row) * static_cast<std::size_t>(columns) + static_cast<std::size_t>(column);
+    for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+        const CellZone &entry = cellZones[static_cast<std::size_t>(i)];
+        if (insideZone(entry, column, row, x, y)) {
+            zonesInside.push_back(entry.zone);
+        }
+    }
+}
+
+
+template <typename Visitor>
+void GeofenceIndex::visitEdges(double x, double y, double radiusM, Visitor &&visit) const {
+    if (columns == 0) {
+        return;
+    }
+    const int column0 = std::max(0, static_cast<int>(std::floor((x - radiusM - minX) / cellSize)));
+    const int column1 = std::min(columns - 1, static_cast<int>(std::floor((x + radiusM - minX) / cellSize)));
+    const int row0 = std::max(0, static_cast<int>(std::floor((y - radiusM - minY) / cellSize)));
+    const int row1 = std::min(rows - 1, static_cast<int>(std::floor((y + radiusM - minY) / cellSize)));
+    for (int row = row0; row <= row1; ++row) {
+        for (int column = column0; column <= column1; ++column) {
+            const std::size_t cell = static_cast<std::size_t>(row) * static_cast<std::size_t>(columns) +
+                                     static_cast<std::size_t>(column);
+            for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                const CellZone &entry = cellZones[static_cast<std::size_t>(i)];
+                for (int e = entry.edgeBegin; e < entry.edgeEnd; ++e) {
+                    visit(edges[static_cast<std::size_t>(cellEdges[static_cast<std::size_t>(e)])]);
+                }
+            }
+        }
+    }
+}
+
+
+GeofenceIndex::Result GeofenceIndex::evaluate(double latitudeDeg, double longitudeDeg) const {
+    Result result;
+    if (zones.empty()) {
+        return result;
+    }
+    double x, y;
+    projection.toLocal(latitudeDeg, longitudeDeg, x, y);
+
+    // Aynı noktada iç içe birkaç bölge olabilir; telemetri hızında ayırma yapmamak için tekrar kullanılır
+    thread_local std::vector<int> zonesInside;
+    zonesInside.clear();
+    collectInside(x, y, zonesInside);
+
+    bool insideKeepIn = false;
+    for (int zone : zonesInside) {
+        const ZoneInfo &info = zones[static_cast<std::size_t>(zone)];
+        if (info.type == GeofenceZone::Type::KeepOut) {
+            result.state = State::Breach;
+            result.zoneId = info.id;
+            break;
+        }
+        insideKeepIn = true;
+    }
+    if (result.state != State::Breach && hasKeepIn && !insideKeepIn) {
+        result.state = State::Breach;
+        result.zoneId = NoZone;
+    }
+
+    double nearestMarginRatio = std::numeric_limits<double>::max();
+    const bool breached = result.state == State::Breach;
+    visitEdges(x, y, maxMarginM, [&](const Edge &edge) {
+        const double distance = pointSegmentDistance(x, y, edge.ax, edge.ay, edge.bx, edge.by);
+        if (!(distance >= result.boundaryDistanceM)) {  // İlk değer NaN
+            result.boundaryDistanceM = distance;
+        }
+        if (breached) {
+            return;
+        }
+        const ZoneInfo &info = zones[static_cast<std::size_t>(edge.zone)];
+        if (distance >= info.marginM) {
+            return;
+        }
+        // Keep-in sınırı sadece içindeysek tehlikelidir; keep-out'un içinde olsaydık ihlal olurdu
+        if (info.type == GeofenceZone::Type::KeepIn &&
+            std::find(zonesInside.begin(), zonesInside.end(), edge.zone) == zonesInside.end()) {
+            return;
+        }
+        const double ratio = distance / info.marginM;
+        if (ratio < nearestMarginRatio) {
+            nearestMarginRatio = ratio;
+            result.state = State::Near;
+            result.zoneId = info.id;
+        }
+    });
+    return result;
+}
+
+
+double GeofenceIndex::distanceToBoundaryM(double latitudeDeg, double longitudeDeg, double searchRadiusM) const {
+    double x, y;
+    projection.toLocal(latitudeDeg, longitudeDeg, x, y);
+    double nearest = std::numeric_limits<double>::quiet_NaN();
+    visitEdges(x, y, searchRadiusM, [&](const Edge &edge) {
+        const double distance = pointSegmentDistance(x, y, edge.ax, edge.ay, edge.bx, edge.by);
+        if (distance <= searchRadiusM && !(distance >= nearest)) {
+            nearest = distance;
+        }
+    });
+    return nearest;
+}
+
+
+std::size_t GeofenceIndex::zoneCount() const {
+    return zones.size();
+}
+
+std::size_t GeofenceIndex::edgeCount() const {
+    return edges.size();
+}
+
+std::size_t GeofenceIndex::cellCount() const {
+    return static_cast<std::size_t>(rows) * static_cast<std::size_t>(columns);
+}
+
+double GeofenceIndex::cellSizeM() const {
+    return cellSize;
+}
+
+std::size_t GeofenceIndex::memoryBytes() const {
+    return zones.capacity() * sizeof(ZoneInfo) + edges.capacity() * sizeof(Edge) +
+           cellStart.capacity() * sizeof(int) + cellZones.capacity() * sizeof(CellZone) +
+           cellEdges.capacity() * sizeof(int);
+}
+
+const char *GeofenceIndex::stateToString(State state) {
+    switch (state) {
+    case State::Clear: return "clear";
+    case State::Near: return "near";
+    case State::Breach: return "breach";
+    }
+    return "unknown";
+}
@@ -0,0 +1,98 @@
+#ifndef GEOFENCEINDEX_H
+#define GEOFENCEINDEX_H
+
+#include "src/Utils/GeoMath.h"
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+struct GeofenceZone {
+    enum class Type { KeepOut, KeepIn };
+
+    int id = 0;
+    Type type = Type::KeepOut;
+    std::vector<GeoPoint> ring;  // Kapalı kabul edilir, ilk nokta tekrar edilmez
+    double marginM = 0.0;        // Sınıra bu mesafeden yaklaşınca "yakın" uyarısı
+};
+
+// Çok sayıda geofence çokgeni üzerinde sabit maliyetli konum sorgusu.
+// Kenarlar tek bir yerel düzlemde düzgün ızgaraya dağıtılır (hücre başına birkaç kenar).
+// Her hücre, kapsadığı her bölge için hücre merkezinin içeride olup olmadığını ve hücreye
+// düşen kenarları tutar; nokta-çokgen testi merkezden noktaya doğru parçayı kesen kenarları
+// saymaktan ibarettir, yani bölge boyutundan bağımsız olarak hücredeki kenar sayısı kadar sürer.
+// Sınır mesafesi sadece en büyük pay yarıçapındaki hücrelerde aranır.
+// Oluşturulduktan sonra değişmez; birden fazla thread aynı anda sorgulayabilir.
+// Tek projeksiyon kullanıldığı için bölgeler birkaç yüz km içinde olmalıdır.
+class GeofenceIndex {
+public:
+    enum class State { Clear, Near, Breach };
+
+    struct Result {
+        State state = State::Clear;
+        int zoneId = NoZone;  // İhlal/yakınlık nedeni olan bölge; NoZone: hiçbir keep-in bölgesinde değil
+        // En yakın sınır; sadece en büyük pay yarıçapında (ve bulunulan hücrede) aranır, yoksa NaN
+        double boundaryDistanceM = std::numeric_limits<double>::quiet_NaN();
+    };
+
+    static constexpr int NoZone = -1;
+    static constexpr int TargetEdgesPerCell = 4;
+    static constexpr std::size_t MaxCells = 1u << 20;
+    static constexpr double MinCellSizeM = 1.0;
+
+    explicit GeofenceIndex(std::vector<GeofenceZone> zones);
+
+    // Bütün keep-out bölgelerinin dışında ve (varsa) en az bir keep-in bölgesinin içinde olmak serbesttir
+    Result evaluate(double latitudeDeg, double longitudeDeg) const;
+    // En yakın sınır (searchRadiusM içinde yoksa NaN)
+    double distanceToBoundaryM(double latitudeDeg, double longitudeDeg, double searchRadiusM) const;
+
+    std::size_t zoneCount() const;
+    std::size_t edgeCount() const;
+    std::size_t cellCount() const;
+    double cellSizeM() const;
+    std::size_t memoryBytes() const;
+
+    static const char *stateToString(State state);
+
+private:
+    struct Edge {
+        double ax, ay, bx, by;
+        int zone;
+    };
+
+    // Bir hücre ile bir bölgenin kesişimi; kenarlar cellEdges[edgeBegin, edgeEnd)
+    struct CellZone {
+        int zone;
+        bool centerInside;
+        int edgeBegin;
+        int edgeEnd;
+    };
+
+    struct ZoneInfo {
+        int id;
+        GeofenceZone::Type type;
+        double marginM;
+    };
+
+    bool cellOf(double x, double y, int &column, int &row) const;
+    bool insideZone(const CellZone &entry, int column, int row, double x, double y) const;
+    void collectInside(double x, double y, std::vector<int> &zonesInside) const;
+    template <typename Visitor>
+    void visitEdges(double x, double y, double radiusM, Visitor &&visit) const;
+
+    GeoMath::LocalProjection projection;
+    std::vector<ZoneInfo> zones;
+    std::vector<Edge> edges;
+    double minX = 0.0;
+    double minY = 0.0;
+    double cellSize = 1.0;
+    int columns = 0;
+    int rows = 0;
+    std::vector<int> cellStart;  // rows * columns + 1, cellZones içine
+    std::vector<CellZone> cellZones;
+    std::vector<int> cellEdges;
+    bool hasKeepIn = false;
+    double maxMarginM = 0.0;
+};
+
+#endif // GEOFENCEINDEX_H
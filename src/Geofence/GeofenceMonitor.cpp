@@ -0,0 +1,226 @@
+#include "GeofenceMonitor.h"
+#include "src/Utils/Logger.h"
+#include "src/Utils/TaskExecutor.h"
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPointer>
+#include <atomic>
+#include <cmath>
+#include <functional>
+
+namespace {
+
+class GeofenceMetric : public DerivedMetric {
+public:
+    using IndexPointer = std::shared_ptr<const GeofenceIndex>;
+    using Notify = std::function<void(int, GeofenceIndex::State, int, double)>;
+
+    GeofenceMetric(int systemId, std::shared_ptr<const IndexPointer> indexSlot, Notify notify)
+        : systemId(systemId), indexSlot(std::move(indexSlot)), notify(std::move(notify)) {}
+
+    const char *name() const override { return "geofence"; }
+    quint32 inputFields() const override { return TelemetryField::Position; }
+
+    void update(TelemetrySnapshot &snapshot, quint32, std::int64_t) override {
+        const auto &position = snapshot.position;
+        auto &derived = snapshot.derived;
+        const IndexPointer index = std::atomic_load(indexSlot.get());
+        if (!index || !std::isfinite(position.latitude_deg) || !std::isfinite(position.longitude_deg) ||
+            (position.latitude_deg == 0.0 && position.longitude_deg == 0.0)) {
+            return;
+        }
+
+        GeofenceIndex::Result result = index->evaluate(position.latitude_deg, position.longitude_deg);
+        if (lastState == GeofenceIndex::State::Breach && result.state != GeofenceIndex::State::Breach &&
+            result.boundaryDistanceM < GeofenceMonitor::ExitHysteresisM) {
+            result.state = GeofenceIndex::State::Breach;
+            result.zoneId = lastZoneId;
+        }
+
+        derived.geofenceState = static_cast<int>(result.state);
+        derived.geofenceZoneId = result.zoneId;
+        derived.geofenceDistanceM = result.boundaryDistanceM;
+
+        if (result.state != lastState || (result.state != GeofenceIndex::State::Clear && result.zoneId != lastZoneId)) {
+            lastState = result.state;
+            lastZoneId = result.zoneId;
+            notify(systemId, result.state, result.zoneId, result.boundaryDistanceM);
+        }
+    }
+
+    // Geofence durumu uçuştan bağımsızdır, arm ile sıfırlanmaz
+    void reset(TelemetrySnapshot &) override {}
+
+private:
+    const int systemId;
+    std::shared_ptr<const IndexPointer> indexSlot;
+    Notify notify;
+    GeofenceIndex::State lastState = GeofenceIndex::State::Clear;
+    int lastZoneId = GeofenceIndex::NoZone;
+};
+
+bool readRing(const QJsonArray &coordinates, std::vector<GeoPoint> &ring) {
+    ring.clear();
+    ring.reserve(static_cast<std::size_t>(coordinates.size()));
+    for (const QJsonValue &value : coordinates) {
+        const QJsonArray pair = value.toArray();
+        if (pair.size() < 2) {
+            return false;
+        }
+        ring.push_back({pair.at(1).toDouble(), pair.at(0).toDouble()});  // GeoJSON: [boylam, enlem]
+    }
+    // GeoJSON halkaları kapalıdır; tekrarlanan son nokta atılır
+    if (ring.size() > 1 && ring.front().latitudeDeg == ring.back().latitudeDeg &&
+        ring.front().longitudeDeg == ring.back().longitudeDeg) {
+        ring.pop_back();
+    }
+    return ring.size() >= 3;
+}
+
+} // namespace
+
+
+GeofenceMonitor::GeofenceMonitor(QObject *parent)
+    : QObject(parent),
+    currentIndex(std::make_shared<IndexSlot>()) {}
+
+
+GeofenceMonitor::~GeofenceMonitor() {
+    ++loadGeneration;
+}
+
+
+void GeofenceMonitor::setZones(std::vector<GeofenceZone> zones) {
+    const quint64 generation = ++loadGeneration;
+    TaskExecutor::instance().submit(this, [zones = std::move(zones)](const CancellationToken &) {
+        return std::shared_ptr<const GeofenceIndex>(std::make_shared<GeofenceIndex>(zones));
+    }, [this, generation](const std::shared_ptr<const GeofenceIndex> &newIndex) {
+        if (generation == loadGeneration) {
+            install(newIndex);
+        }
+    }, TaskExecutor::Priority::Low);
+}
+
+
+void GeofenceMonitor::loadFile(const QString &filePath) {
+    const quint64 generation = ++loadGeneration;
+    TaskExecutor::instance().submit(this, [filePath](const CancellationToken &) {
+        QFile file(filePath);
+        if (!file.open(QIODevice::ReadOnly)) {
+            Logger::instance().log("Failed to open geofence file: " + filePath, ERROR);
+            return std::shared_ptr<const GeofenceIndex>();
+        }
+        std::vector<GeofenceZone> zones;
+        QString error;
+        if (!parseGeoJson(file.readAll(), zones, &error)) {
+            Logger::instance().log("Invalid geofence file " + filePath + ": " + error, ERROR);
+            return std::shared_ptr<const GeofenceIndex>();
+        }
+        return std::shared_ptr<const GeofenceIndex>(std::make_shared<GeofenceIndex>(std::move(zones)));
+    }, [this, generation](const std::shared_ptr<const GeofenceIndex> &newIndex) {
+        if (generation == loadGeneration && newIndex) {
+            install(newIndex);
+        }
+    }, TaskExecutor::Priority::Low);
+}
+
+
+void GeofenceMonitor::clear() {
+    ++loadGeneration;
+    install(nullptr);
+}
+
+
+void GeofenceMonitor::install(IndexSlot newIndex) {
+    const int zones = newIndex ? static_cast<int>(newIndex->zoneCount()) : 0;
+    const int edges = newIndex ? static_cast<int>(newIndex->edgeCount()) : 0;
+    if (newIndex) {
+        Logger::instance().log(QString("Geofence: %1 zones, %2 edges, %3 cells of %4 m, %5 KB index")
+                                   .arg(zones).arg(edges).arg(newIndex->cellCount())
+                                   .arg(newIndex->cellSizeM(), 0, 'f', 1).arg(newIndex->memoryBytes() / 1024), INFO);
+    }
+    std::atomic_store(currentIndex.get(), std::move(newIndex));
+    emit zonesLoaded(zones, edges);
+}
+
+
+std::shared_ptr<const GeofenceIndex> GeofenceMonitor::index() const {
+    return std::atomic_load(currentIndex.get());
+}
+
+
+GeofenceIndex::Result GeofenceMonitor::evaluate(double latitudeDeg, double longitudeDeg) const {
+    const std::shared_ptr<const GeofenceIndex> current = index();
+    return current ? current->evaluate(latitudeDeg, longitudeDeg) : GeofenceIndex::Result();
+}
+
+
+std::unique_ptr<DerivedMetric> GeofenceMonitor::createMetric(int systemId) {
+    // Telemetri thread'inden gelir; olay GUI thread'inde yayınlanır
+    QPointer<GeofenceMonitor> monitor(this);
+    auto notify = [monitor](int id, GeofenceIndex::State state, int zoneId, double distance) {
+        if (!monitor) {
+            return;
+        }
+        QMetaObject::invokeMethod(monitor, [monitor, id, state, zoneId, distance]() {
+            if (monitor) {
+                emit monitor->geofenceStateChanged(id, state, zoneId, distance);
+            }
+        }, Qt::QueuedConnection);
+    };
+    return std::make_unique<GeofenceMetric>(systemId, currentIndex, notify);
+}
+
+
+bool GeofenceMonitor::parseGeoJson(const QByteArray &data, std::vector<GeofenceZone> &zones, QString *error) {
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(data, &parseError);
+    if (document.isNull()) {
+        if (error) {
+            *error = parseError.errorString();
+        }
+        return false;
+    }
+
+    const QJsonArray features = document.object().value("features").toArray();
+    std::vector<GeoPoint> ring;
+    for (int i = 0; i < features.size(); ++i) {
+        const QJsonObject feature = features.at(i).toObject();
+        const QJsonObject geometry = feature.value("geometry").toObject();
+        const QJsonObject properties = feature.value("properties").toObject();
+
+        GeofenceZone zone;
+        zone.id = properties.value("id").toInt(i);
+        zone.type = properties.value("fence").toString() == "keep-in" ? GeofenceZone::Type::KeepIn
+                                                                       : GeofenceZone::Type::KeepOut;
+        zone.marginM = properties.value("margin").toDouble(DefaultMarginM);
+
+        // Polygon: [dış halka, delikler...], MultiPolygon: [Polygon...]
+        const QString type = geometry.value("type").toString();
+        const QJsonArray coordinates = geometry.value("coordinates").toArray();
+        QJsonArray polygons;
+        if (type == "Polygon") {
+            polygons.append(coordinates);
+        } else if (type == "MultiPolygon") {
+            polygons = coordinates;
+        } else {
+            continue;
+        }
+        for (const QJsonValue &polygon : polygons) {
+            if (readRing(polygon.toArray().at(0).toArray(), ring)) {
+                zone.ring = ring;
+                zones.push_back(zone);
+            }
+        }
+    }
+
+    if (zones.empty()) {
+        if (error) {
+            *error = "no Polygon or MultiPolygon features";
+        }
+        return false;
+    }
+    return true;
+}
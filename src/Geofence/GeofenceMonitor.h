@@ -0,0 +1,58 @@
+#ifndef GEOFENCEMONITOR_H
+#define GEOFENCEMONITOR_H
+
+#include "src/Geofence/GeofenceIndex.h"
+#include "src/Telemetry/DerivedMetrics.h"
+#include <QByteArray>
+#include <QObject>
+#include <QString>
+#include <memory>
+#include <vector>
+
+// Bütün araçların konumunu geofence bölgelerine karşı denetler.
+// Her aracın TelemetryHandler'ına bir DerivedMetric eklenir: kontrol, konum örneğinin işlendiği
+// thread'de ve telemetri hızında yapılır, sonuç snapshot.derived.geofence* alanlarına yazılır.
+// Durum değiştiğinde (temiz/yakın/ihlal) geofenceStateChanged GUI thread'inde yayınlanır.
+// Bölgeler TaskExecutor'da indekslenir ve hazır olunca tek bir işaretçi değişimiyle devreye girer;
+// metrikler eski indeksi kullanmayı bitirmeden indeks serbest bırakılmaz.
+class GeofenceMonitor : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr double DefaultMarginM = 30.0;
+    // İhlalden çıkış için sınırdan bu kadar uzaklaşmak gerekir (GPS gürültüsüyle olay yağmuru olmasın)
+    static constexpr double ExitHysteresisM = 2.0;
+
+    explicit GeofenceMonitor(QObject *parent = nullptr);
+    ~GeofenceMonitor();
+
+    void setZones(std::vector<GeofenceZone> zones);
+    // GeoJSON FeatureCollection; okuma ve indeksleme arka planda yapılır, sonuç zonesLoaded ile gelir
+    void loadFile(const QString &filePath);
+    void clear();
+
+    std::shared_ptr<const GeofenceIndex> index() const;
+    GeofenceIndex::Result evaluate(double latitudeDeg, double longitudeDeg) const;
+
+    // Her araç için bir kez, TelemetryHandler::start() öncesinde eklenir
+    std::unique_ptr<DerivedMetric> createMetric(int systemId);
+
+    // Polygon/MultiPolygon özellikleri: "fence": "keep-in" | "keep-out" (varsayılan), "margin" (m), "id".
+    // Çokgen delikleri yok sayılır.
+    static bool parseGeoJson(const QByteArray &data, std::vector<GeofenceZone> &zones, QString *error = nullptr);
+
+signals:
+    void zonesLoaded(int zoneCount, int edgeCount);
+    void geofenceStateChanged(int systemId, GeofenceIndex::State state, int zoneId, double boundaryDistanceM);
+
+private:
+    using IndexSlot = std::shared_ptr<const GeofenceIndex>;
+
+    void install(IndexSlot newIndex);
+
+    // İçerik std::atomic_load/store ile erişilir; metriklerle paylaşılır, metrik monitörden uzun yaşayabilir
+    std::shared_ptr<IndexSlot> currentIndex;
+    quint64 loadGeneration = 0;  // Art arda yüklemelerde sadece sonuncusu devreye girer
+};
+
+#endif // GEOFENCEMONITOR_H
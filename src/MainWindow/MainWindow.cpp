@@ -2,19 +2,31 @@
 #include "ui_MainWindow.h"
 #include <QSerialPortInfo>
 #include <QDir>
+#include <QFileDialog>
 #include <QMediaDevices>
 #include <QTimer>
 #include <QMediaCaptureSession>
 #include <QVideoSink>
 #include "qboxlayout.h"
 #include <QQmlContext>
+#include <QQmlEngine>
 #include <QQuickItem>
+#include "src/Map/MarkerLayer.h"
+#include "src/Mission/SurveyGenerator.h"
+#include "src/Terrain/TerrainDatabase.h"
+#include "src/Utils/TaskExecutor.h"
+#include <cmath>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
     , uavManager(new UAVManager(this))
     , cameraManager(new CameraManager(this))
+    , missionModel(new MissionModel(this))
+    , tileCache(new TileCacheServer(this))
+    , trailModel(new TrailModel(this))
+    , vehicleState(new VehicleState(this))
+    , fleetState(new FleetState(this))
     , videoWidget(new QVideoWidget(this))
     ,captureSession(new QMediaCaptureSession(this))
 {
@@ -38,6 +50,14 @@ MainWindow::MainWindow(QWidget *parent)
     ui->flightModeLabel->setAlignment(Qt::AlignCenter);
 
     ui->quickWidget->rootContext()->setContextProperty("mapFunction", this);
+    ui->quickWidget->rootContext()->setContextProperty("missionModel", missionModel);
+    ui->quickWidget->rootContext()->setContextProperty("trailModel", trailModel);
+    ui->quickWidget->rootContext()->setContextProperty("vehicleState", vehicleState);
+    ui->quickWidget->rootContext()->setContextProperty("fleetState", fleetState);
+
+    connect(tileCache, &TileCacheServer::prefetchFinished, this, [this](int, int, bool) {
+        Logger::instance().log(tileCache->metricsReport());
+    });
 
     bool connectedStatus = connect(
         &Logger::instance(),              // Logger'ın örneği
@@ -49,6 +69,23 @@ MainWindow::MainWindow(QWidget *parent)
 
 }
 
+// osm eklentisi parametreleri eklenti oluşturulurken bir kez okunur; bu yüzden QML kaynağı
+// .ui dosyasında değil, karo sunucusunun adresi belli olduktan sonra burada verilir
+void MainWindow::loadMap()
+{
+    if (!tileCache->isRunning()) {
+        Logger::instance().log("Karo sunucusu çalışmıyor, harita karoları yüklenemeyecek.", ERROR);
+    }
+    ui->quickWidget->rootContext()->setContextProperty("tileServerUrl", tileCache->url());
+    ui->quickWidget->rootContext()->setContextProperty("tileCache", tileCache);
+    // İşaretçi katmanı ve beslendiği durum nesneleri
+    qmlRegisterType<MarkerLayer>("UavGroundControl.Map", 1, 0, "MarkerLayer");
+    qmlRegisterAnonymousType<VehicleState>("UavGroundControl.Map", 1);
+    qmlRegisterAnonymousType<FleetState>("UavGroundControl.Map", 1);
+    ui->quickWidget->setSource(QUrl("qrc:/maps/maps/GeneralMap.qml"));
+}
+
+
 MainWindow::~MainWindow()
 {
     Logger::instance().log("MainWindow yok ediliyor.");
@@ -62,10 +99,26 @@ void MainWindow::setupConnections()
 
     // "Connect UAV" butonuna tıklama olayını bağla
     connect(ui->connectPushButton, &QPushButton::clicked, this, [=]() {
+        if (uavManager->isConnecting()) {
+            Logger::instance().log("UAV bağlantı denemesi iptal edildi.");
+            uavManager->cancelConnect();
+            return;
+        }
+
         if (!uavManager->isConnected()) {
             QString portName = ui->connectionComboBox->currentText();
             QString baudRate = ui->baundComboBox->currentText();
 
+            if (portName == "Replay") {
+                QString filePath = QFileDialog::getOpenFileName(this, "Uçuş kaydı seç", QDir::currentPath() + "/recordings",
+                                                                "Uçuş kaydı (*.uavrec)");
+                if (!filePath.isEmpty()) {
+                    Logger::instance().log("Uçuş kaydı oynatma isteği: " + filePath);
+                    uavManager->startReplay(filePath);
+                }
+                return;
+            }
+
             Logger::instance().log("UAV bağlantı isteği gönderildi: Port=" + portName + ", Baud=" + baudRate);
             uavManager->connectToUAV(portName, baudRate);
         }
@@ -90,10 +143,79 @@ void MainWindow::setupConnections()
         ui->connectionStatusLabel->setText("NOT CONNECTED !!!");
         ui->connectionStatusLabel->setStyleSheet("color: rgb(255, 19, 90); font: 700 10pt 'Segoe UI';");
         Logger::instance().log("UAV bağlantısı kesildi.");
+        fleetState->clear();
         qDebug() << "UAV bağlantısı kesildi.";
     });
 
     connect(uavManager, &UAVManager::connected, this, &MainWindow::onUAVConnected);
+    // MAVSDK log satırları araçtan bağımsızdır, bağlantı boyunca tek bağlantı yeterli
+    connect(uavManager, &UAVManager::mavsdkLogUpdated, this, &MainWindow::updateMavsdkPlainTextEdit);
+
+    // Filodaki her araç haritada düşük hızda gösterilir; seçili araç ayrıca VehicleState'ten çizilir
+    connect(uavManager, &UAVManager::vehicleAdded, this, [this](int systemId) {
+        if (auto &telemetryHandler = uavManager->getTelemetryHandler(systemId)) {
+            telemetryHandler->subscribe(TelemetryField::Position | TelemetryField::Heading, FleetMarkerRateHz, this,
+                                        [this, systemId](const TelemetrySnapshot &snapshot, quint32) {
+                fleetState->update(systemId, snapshot.position.latitude_deg, snapshot.position.longitude_deg,
+                                   snapshot.heading.heading_deg);
+            });
+        }
+    });
+
+    // Filoda seçili araç değişince görünümler yeni aracın telemetrisine bağlanır
+    connect(uavManager, &UAVManager::activeVehicleChanged, this, [this](int systemId) {
+        fleetState->setActiveVehicle(systemId);
+        if (auto &telemetryHandler = uavManager->getTelemetryHandler(systemId)) {
+            subscribeTelemetryViews(telemetryHandler.get());
+        }
+    });
+
+    // Bağlantı adımları arka planda ilerler; buton iptal için kullanılabilir kalır
+    connect(uavManager, &UAVManager::connectionStateChanged, this, [=](ConnectionState state, const QString &) {
+        switch (state) {
+        case ConnectionState::Connecting:
+        case ConnectionState::Discovered:
+            ui->connectPushButton->setText("Cancel");
+            ui->connectionStatusLabel->setText(UAVManager::connectionStateToString(state).toUpper() + "...");
+            ui->connectionStatusLabel->setStyleSheet("color: rgb(255, 170, 0); font: 700 10pt 'Segoe UI';");
+            break;
+        case ConnectionState::Failed:
+        case ConnectionState::Disconnected:
+            if (!uavManager->isConnected()) {
+                ui->connectPushButton->setText("Connect UAV");
+                ui->connectionStatusLabel->setText("NOT CONNECTED !!!");
+                ui->connectionStatusLabel->setStyleSheet("color: rgb(255, 19, 90); font: 700 10pt 'Segoe UI';");
+            }
+            break;
+        default:
+            break;
+        }
+    });
+
+    // Link değişimi bağlantı etiketinin ipucunda gösterilir
+    connect(uavManager, &UAVManager::activeLinkChanged, this, [this](int index, const QString &url) {
+        ui->connectionStatusLabel->setToolTip("Active link " + QString::number(index) + ": " + url + "\n" +
+                                              uavManager->getLinkManager()->statusReport());
+        Logger::instance().log("Aktif link değişti: " + url);
+    });
+
+    connect(uavManager->getGeofence(), &GeofenceMonitor::geofenceStateChanged, this,
+            [](int systemId, GeofenceIndex::State state, int zoneId, double distanceM) {
+        const QString vehicle = "Araç " + QString::number(systemId);
+        const QString zone = zoneId == GeofenceIndex::NoZone ? QString("izinli alan dışı") : "bölge " + QString::number(zoneId);
+        switch (state) {
+        case GeofenceIndex::State::Breach:
+            Logger::instance().log("Geofence ihlali: " + vehicle + ", " + zone, ERROR);
+            break;
+        case GeofenceIndex::State::Near:
+            Logger::instance().log("Geofence sınırına yakın: " + vehicle + ", " + zone + ", " +
+                                       QString::number(distanceM, 'f', 0) + " m", WARNING);
+            break;
+        case GeofenceIndex::State::Clear:
+            Logger::instance().log("Geofence temiz: " + vehicle, INFO);
+            break;
+        }
+    });
 
     connect(ui->cameraConnectPushButton, &QPushButton::clicked, this, &MainWindow::cameraConnectPushButton_clicked);
 
@@ -120,7 +242,7 @@ void MainWindow::setupConnections()
 
     connect(ui->takeoffPushButton, &QPushButton::clicked, this, [this]() {
         int takeoffHeight = ui->altitudeSpinBox->value();
-        Logger::instance().log("UAV kalkış isteği gönderildi. Yükseklik: " + QString::number(takeoffHeight));
+        LOG_STRUCTURED(INFO, "UAV kalkış isteği gönderildi. Yükseklik: %1", takeoffHeight);
         uavManager->takeoff(takeoffHeight);
     });
 
@@ -129,16 +251,185 @@ void MainWindow::setupConnections()
         int speed = ui->speedSpinBox->value();
         int yaw = ui->yawSpinBox->value();
 
-        Logger::instance().log("UAV hedefe yönlendirme isteği gönderildi. Yükseklik: " + QString::number(takeoffHeight) +
-                               ", Hız: " + QString::number(speed) + ", Yaw: " + QString::number(yaw));
+        LOG_STRUCTURED(INFO, "UAV hedefe yönlendirme isteği gönderildi. Yükseklik: %1, Hız: %2, Yaw: %3",
+                       takeoffHeight, speed, yaw);
 
         uavManager->sendCoordinatesToUAV(togoLat, togoLon, takeoffHeight, speed, yaw);
     });
 
+    setupMissionControls();
+
     Logger::instance().log("setupConnections: Tüm bağlantılar başarıyla kuruldu.");
 }
 
 
+// Görev noktaları haritada seçilen hedeften eklenir, haritada sürüklenerek taşınır
+void MainWindow::setupMissionControls()
+{
+    connect(ui->addWaypointPushButton, &QPushButton::clicked, this, [this]() {
+        if (!std::isfinite(togoLat) || !std::isfinite(togoLon)) {
+            Logger::instance().log("Görev noktası için önce haritadan konum seçin.", WARNING);
+            return;
+        }
+        missionModel->appendWaypoint(togoLat, togoLon, ui->altitudeSpinBox->value(), ui->speedSpinBox->value());
+    });
+
+    connect(ui->removeWaypointPushButton, &QPushButton::clicked, this, [this]() {
+        missionModel->removeWaypoint(missionModel->count() - 1);
+    });
+
+    connect(ui->clearMissionPushButton, &QPushButton::clicked, missionModel, &MissionModel::clear);
+
+    connect(ui->uploadMissionPushButton, &QPushButton::clicked, this, [this]() {
+        if (missionModel->count() == 0) {
+            Logger::instance().log("Yüklenecek görev noktası yok.", WARNING);
+            return;
+        }
+        uploadMissionWithTerrainCheck();
+    });
+
+    connect(ui->startMissionPushButton, &QPushButton::clicked, this, [this]() {
+        Logger::instance().log("Görev başlatma isteği gönderildi.");
+        uavManager->startMission();
+    });
+
+    // Mevcut noktalar çokgenin köşeleri kabul edilir ve tarama göreviyle değiştirilir
+    connect(ui->surveyPushButton, &QPushButton::clicked, this, [this]() {
+        if (missionModel->count() < 3) {
+            Logger::instance().log("Tarama için en az 3 köşe noktası ekleyin.", WARNING);
+            return;
+        }
+        SurveyPolygon polygon;
+        for (const MissionWaypoint &waypoint : missionModel->waypoints()) {
+            polygon.outer.push_back({waypoint.latitudeDeg, waypoint.longitudeDeg});
+        }
+        SurveyParameters parameters;
+        parameters.altitudeM = ui->altitudeSpinBox->value();
+        parameters.speedMS = ui->speedSpinBox->value();
+        parameters.angleDeg = SurveyGenerator::longestEdgeBearing(polygon);
+
+        ui->surveyPushButton->setEnabled(false);
+        TaskExecutor::instance().submit(this, [polygon, parameters](const CancellationToken &token) {
+            return SurveyGenerator::generate(polygon, parameters, token);
+        }, [this](const SurveyResult &result) {
+            ui->surveyPushButton->setEnabled(true);
+            if (!result.success) {
+                Logger::instance().log("Tarama görevi oluşturulamadı: " + result.error, ERROR);
+                return;
+            }
+            missionModel->setCameraTriggerDistance(result.triggerDistanceM);
+            missionModel->setWaypoints(result.waypoints);
+            Logger::instance().log(QString("Tarama görevi: %1 nokta, %2 hat, hat aralığı %3 m, tetikleme %4 m, "
+                                           "GSD %5 cm/px, alan %6 ha (%7 ms, %8 thread)")
+                                       .arg(result.waypoints.size()).arg(result.lines)
+                                       .arg(result.lineSpacingM, 0, 'f', 1).arg(result.triggerDistanceM, 0, 'f', 1)
+                                       .arg(result.gsdCmPerPx, 0, 'f', 2).arg(result.areaM2 / 10000.0, 0, 'f', 2)
+                                       .arg(result.elapsedUs / 1000.0, 0, 'f', 1).arg(result.threads));
+        });
+    });
+
+    connect(missionModel, &MissionModel::countChanged, this, [this]() {
+        ui->missionStatusLabel->setText("Mission: " + QString::number(missionModel->count()) + " waypoints");
+    });
+
+    connect(uavManager, &UAVManager::missionUploadStarted, this, [this](int, int totalItems, MissionUploader::Method method) {
+        ui->uploadMissionPushButton->setEnabled(false);
+        ui->missionStatusLabel->setText("Uploading " + QString::number(totalItems) + " items (" +
+                                        MissionUploader::methodToString(method) + ")...");
+    });
+
+    connect(uavManager, &UAVManager::missionUploadFinished, this, [this](int systemId, const MissionUploader::Report &report) {
+        if (systemId == uavManager->getActiveVehicle()) {
+            updateMissionStatus(report);
+        }
+    });
+}
+
+
+// Rota arazi verisiyle arka planda denetlenir; irtifalar eve göreli olduğu için evin deniz
+// seviyesine göre yüksekliği mevcut konumdan (mutlak - göreli irtifa) bulunur.
+// Araç konumu veya arazi verisi yoksa denetim yapılamaz ve görev doğrudan yüklenir.
+void MainWindow::uploadMissionWithTerrainCheck()
+{
+    const std::vector<MissionWaypoint> waypoints = missionModel->waypoints();
+    const double cameraTriggerDistanceM = missionModel->cameraTriggerDistance();
+    const auto upload = [this, waypoints, cameraTriggerDistanceM]() {
+        Logger::instance().log("Görev yükleme isteği gönderildi: " + QString::number(waypoints.size()) + " nokta");
+        uavManager->uploadMission(waypoints, cameraTriggerDistanceM);
+    };
+
+    const std::unique_ptr<TelemetryHandler> &handler = uavManager->getTelemetryHandler();
+    const TelemetrySnapshot snapshot = handler ? handler->getSnapshot() : TelemetrySnapshot();
+    const double homeAmslM = snapshot.position.absolute_altitude_m - snapshot.position.relative_altitude_m;
+    if (!handler || !std::isfinite(homeAmslM)) {
+        Logger::instance().log("Arazi denetimi için araç irtifası yok, görev denetimsiz yükleniyor.", WARNING);
+        upload();
+        return;
+    }
+
+    std::vector<GeoPoint> route;
+    std::vector<double> altitudes;
+    route.reserve(waypoints.size());
+    altitudes.reserve(waypoints.size());
+    for (const MissionWaypoint &waypoint : waypoints) {
+        route.push_back({waypoint.latitudeDeg, waypoint.longitudeDeg});
+        altitudes.push_back(homeAmslM + waypoint.relativeAltitudeM);
+    }
+
+    ui->uploadMissionPushButton->setEnabled(false);
+    ui->missionStatusLabel->setText("Checking terrain clearance...");
+    const bool submitted = TaskExecutor::instance().submit(this, [route, altitudes](const CancellationToken &) {
+        return TerrainDatabase::instance().checkClearance(route, altitudes, MinTerrainClearanceM);
+    }, [this, upload](const TerrainDatabase::ClearanceReport &report) {
+        ui->uploadMissionPushButton->setEnabled(true);
+        if (!report.valid) {
+            Logger::instance().log("Rota için arazi verisi yok, görev denetimsiz yükleniyor.", WARNING);
+            upload();
+            return;
+        }
+        if (report.violations > 0) {
+            ui->missionStatusLabel->setText(QString("Terrain clearance %1 m on leg %2 (%3 samples below %4 m), upload refused")
+                                                .arg(report.minClearanceM, 0, 'f', 0).arg(report.worstLeg + 1)
+                                                .arg(report.violations).arg(MinTerrainClearanceM, 0, 'f', 0));
+            Logger::instance().log(QString("Görev araziye çok yakın: en düşük pay %1 m (bacak %2), yükleme iptal edildi.")
+                                       .arg(report.minClearanceM, 0, 'f', 1).arg(report.worstLeg + 1), ERROR);
+            return;
+        }
+        Logger::instance().log(QString("Arazi denetimi: en düşük pay %1 m, %2/%3 örnekte veri yok.")
+                                   .arg(report.minClearanceM, 0, 'f', 1).arg(report.unknownSamples).arg(report.samples));
+        upload();
+    });
+    if (!submitted) {
+        ui->uploadMissionPushButton->setEnabled(true);
+        upload();
+    }
+}
+
+
+void MainWindow::updateMissionStatus(const MissionUploader::Report &report)
+{
+    ui->uploadMissionPushButton->setEnabled(true);
+    if (!report.success) {
+        ui->missionStatusLabel->setText("Upload failed: " + report.error);
+        return;
+    }
+
+    QString text = QString("Uploaded %1/%2 items (%3")
+                       .arg(report.sentItems).arg(report.totalItems).arg(MissionUploader::methodToString(report.method));
+    if (report.method == MissionUploader::Method::Partial) {
+        text += QString(", %1 ranges").arg(report.ranges);
+    }
+    text += QString(") in %1 s").arg(report.elapsedMs / 1000.0, 0, 'f', 2);
+
+    // Kısmi yüklemenin kazancı son tam yükleme süresiyle karşılaştırılarak görülür
+    const MissionUploader *uploader = uavManager->getMissionUploader();
+    if (uploader && report.method != MissionUploader::Method::Full && uploader->lastFullUploadMs() > 0) {
+        text += QString(", last full upload %1 s").arg(uploader->lastFullUploadMs() / 1000.0, 0, 'f', 2);
+    }
+    ui->missionStatusLabel->setText(text);
+}
+
+
 void MainWindow::listSerialPortsAndConnections()
 {
     Logger::instance().log("Bağlantı noktaları ve baud rate listeleniyor.");
@@ -148,6 +439,7 @@ void MainWindow::listSerialPortsAndConnections()
         ui->connectionComboBox->addItem(port.portName());
     }
     ui->connectionComboBox->addItem("Simulation");
+    ui->connectionComboBox->addItem("Replay");
     ui->baundComboBox->clear();
     ui->baundComboBox->addItems({"9600", "19200", "38400", "57600", "115200", "14550"});
     ui->cameraComboBox->clear();
@@ -156,35 +448,172 @@ void MainWindow::listSerialPortsAndConnections()
 
 
 
-void MainWindow::updateTelemetryData() {
+// Her görünüm sadece gösterdiği alanlara ve kendi yenileme hızıyla abone olur
+void MainWindow::subscribeTelemetryViews(TelemetryHandler *telemetryHandler) {
 
+    // Aktif araç değiştiğinde önceki aracın görünüm abonelikleri kaldırılır
+    if (subscribedHandler) {
+        for (auto id : std::as_const(telemetrySubscriptions)) {
+            subscribedHandler->unsubscribe(id);
+        }
+    }
+    telemetrySubscriptions.clear();
+    if (subscribedHandler != telemetryHandler) {
+        trailModel->clear();
+        vehicleState->reset();
+    }
+    subscribedHandler = telemetryHandler;
 
-    auto& telemetryHandler = uavManager->getTelemetryHandler();
+    // Harita sadece konum ve yön ile ilgilenir
+    telemetrySubscriptions << telemetryHandler->subscribe(TelemetryField::Position | TelemetryField::Heading, 15, this,
+                                [this](const TelemetrySnapshot &snapshot, quint32) {
+        updateUAVPosition(snapshot.position.latitude_deg, snapshot.position.longitude_deg, snapshot.heading.heading_deg);
+    });
 
+    // EADI akıcı olmalı, dağıtım kare hızında güncellenir
+    telemetrySubscriptions << telemetryHandler->subscribe(TelemetryField::Attitude | TelemetryField::FixedwingMetrics | TelemetryField::Position, 0, this,
+                                [this](const TelemetrySnapshot &snapshot, quint32) {
+        updateAttitudeIndicator(snapshot);
+    });
+
+    telemetrySubscriptions << telemetryHandler->subscribe(TelemetryField::Position | TelemetryField::Battery | TelemetryField::TotalSpeed |
+                                    TelemetryField::GpsInfo | TelemetryField::FlightMode | TelemetryField::Armed |
+                                    TelemetryField::RcStatus,
+                                5, this,
+                                [this](const TelemetrySnapshot &snapshot, quint32 changedFields) {
+        updateStatusLabels(snapshot, changedFields);
+    });
+
+    telemetrySubscriptions << telemetryHandler->subscribe(TelemetryField::Health, 2, this,
+                                [this](const TelemetrySnapshot &snapshot, quint32) {
+        updateHealthLabels(snapshot);
+    });
+
+    // Uçuş istatistikleri label ipuçlarında gösterilir, disarm'da özet loglanır
+    telemetrySubscriptions << telemetryHandler->subscribe(TelemetryField::Position | TelemetryField::Battery | TelemetryField::TotalSpeed |
+                                    TelemetryField::Armed,
+                                1, this,
+                                [this, telemetryHandler](const TelemetrySnapshot &snapshot, quint32 changedFields) {
+        updateStatisticsToolTips(telemetryHandler->getStatistics());
+        if ((changedFields & TelemetryField::Armed) && !snapshot.armed) {
+            logFlightStatistics(telemetryHandler->getStatistics());
+        }
+    });
+
+    // Hedefe kalan mesafe koordinat label'ında gösterilir
+    telemetrySubscriptions << telemetryHandler->subscribe(TelemetryField::Derived | TelemetryField::Target, 2, this,
+                                [this](const TelemetrySnapshot &snapshot, quint32) {
+        updateTargetLabel(snapshot);
+    });
+}
+
+
+
+namespace {
+QString statisticsText(const TelemetryStatistics::Summary &summary, const QString &unit, int precision) {
+    if (summary.count == 0) {
+        return "Veri yok";
+    }
+    const auto number = [precision](double value) { return QString::number(value, 'f', precision); };
+    return QString("min %1 / max %2 / ort %3 ±%4 %5\np50 %6 / p90 %7 / p99 %8 %5")
+        .arg(number(summary.min), number(summary.max), number(summary.mean), number(summary.stddev), unit,
+             number(summary.p50), number(summary.p90), number(summary.p99));
+}
+}
 
-    // Position bilgilerini güncelle
-    auto position = telemetryHandler->getPosition();
-    ui->altitudeLabel->setText(QString::number(position.absolute_altitude_m, 'f', 2));
 
-    auto heading = telemetryHandler->getHeading();
 
-    /// position'dan gelen kordinat bilgileri ile haritayı güncelle
-    updateUAVPosition(position.latitude_deg, position.longitude_deg, heading.heading_deg);
+void MainWindow::updateStatisticsToolTips(const TelemetryStatistics &statistics) {
+    ui->altitudeLabel->setToolTip(statisticsText(statistics.summary(TelemetryChannel::Position, 2), "m", 1));
+    ui->speedLabel->setToolTip(statisticsText(statistics.summary(TelemetryChannel::TotalSpeed, 0), "m/s", 2));
+    ui->batteryLabel->setToolTip(statisticsText(statistics.summary(TelemetryChannel::Battery, 0), "V", 2));
+}
+
+
+
+void MainWindow::logFlightStatistics(const TelemetryStatistics &statistics) {
+    const auto roll = statistics.summary(TelemetryChannel::Attitude, 0);
+    const auto climb = statistics.summary(TelemetryChannel::FixedwingMetrics, 2);
+    const auto voltage = statistics.summary(TelemetryChannel::Battery, 0);
+    if (roll.count == 0 && voltage.count == 0) {
+        return;
+    }
+
+    Logger::instance().log(QString("Uçuş özeti: p99 roll %1°, maks. tırmanma %2 m/s, min. batarya %3 V")
+                               .arg(roll.p99, 0, 'f', 1)
+                               .arg(climb.max, 0, 'f', 2)
+                               .arg(voltage.min, 0, 'f', 2));
+}
 
 
 
+void MainWindow::updateTargetLabel(const TelemetrySnapshot &snapshot) {
+    if (!std::isfinite(snapshot.targetLatitudeDeg)) {
+        return;
+    }
+
+    QString text = QString("%1  %2").arg(snapshot.targetLatitudeDeg).arg(snapshot.targetLongitudeDeg);
+    if (std::isfinite(snapshot.derived.targetDistanceM)) {
+        text += QString("  (%1 m, %2°)").arg(snapshot.derived.targetDistanceM, 0, 'f', 0)
+                    .arg(snapshot.derived.targetBearingDeg, 0, 'f', 0);
+    }
+    ui->coordinateLabel->setText(text);
+}
+
+
+
+void MainWindow::updateStatusLabels(const TelemetrySnapshot &snapshot, quint32 changedFields) {
+
+    // Sadece son teslimattan bu yana değişen alanlara ait label'lar güncellenir
+    const auto changed = [changedFields](quint32 fields) { return (changedFields & fields) != 0; };
+
+    // Position bilgilerini güncelle
+    if (changed(TelemetryField::Position)) {
+        QString altitude = QString::number(snapshot.position.absolute_altitude_m, 'f', 2);
+        if (std::isfinite(snapshot.derived.aglM)) {
+            altitude += QString(" (AGL %1)").arg(snapshot.derived.aglM, 0, 'f', 1);
+        }
+        ui->altitudeLabel->setText(altitude);
+    }
+
     // Battery bilgilerini güncelle
-    auto battery = telemetryHandler->getBattery();
-    ui->batteryLabel->setText(QString::number(battery.remaining_percent, 'f', 1) + "%");
+    if (changed(TelemetryField::Battery)) {
+        ui->batteryLabel->setText(QString::number(snapshot.battery.remaining_percent, 'f', 1) + "%");
+    }
 
     // Total Speed bilgilerini güncelle
-    ui->speedLabel->setText(QString::number(telemetryHandler->getTotalSpeed(), 'f', 2) + " m/s");
+    if (changed(TelemetryField::TotalSpeed)) {
+        ui->speedLabel->setText(QString::number(snapshot.totalSpeed, 'f', 2) + " m/s");
+    }
 
+    if (changed(TelemetryField::GpsInfo)) {
+        const auto &gps = snapshot.gpsInfo;
+        ui->satCountLabel->setText(QString::number(gps.num_satellites));
+        std::stringstream ss;
+        ss << gps.fix_type;
+        ui->gpsLabel->setText(QString::fromStdString(ss.str()));
+    }
 
+    if (changed(TelemetryField::FlightMode)) {
+        ui->flightModeLabel->setText(TelemetryHandler::flightModeToString(snapshot.flightMode));
+    }
+
+    // ARM/DISARM Label'ı için özel font ve boyut
+    if (changed(TelemetryField::Armed)) {
+        setLabel(ui->armStringLabel, snapshot.armed, "ARM", "DISARM", "Ubuntu", 20, 700);
+    }
+
+    if (changed(TelemetryField::RcStatus)) {
+        ui->signalLabel->setText(QString::number(snapshot.rcStatus.signal_strength_percent, 'f', 2) + "%" );
+    }
+}
 
 
-    auto attitude = telemetryHandler->getAttitude();
-    auto fixedwingMetrics = telemetryHandler->getFixedwingMetrics();
+
+void MainWindow::updateAttitudeIndicator(const TelemetrySnapshot &snapshot) {
+    const auto &position = snapshot.position;
+    const auto &attitude = snapshot.attitude;
+    const auto &fixedwingMetrics = snapshot.fixedwingMetrics;
 
     ui->AttitudeGraphicsView->setPitch(attitude.pitch_deg);
     ui->AttitudeGraphicsView->setRoll(attitude.roll_deg);
@@ -196,27 +625,12 @@ void MainWindow::updateTelemetryData() {
     ui->AttitudeGraphicsView->setHeading(attitude.yaw_deg);
     ui->AttitudeGraphicsView->setHeadingSel(attitude.yaw_deg);
     ui->AttitudeGraphicsView->redraw();
-
-
-    auto gps = telemetryHandler->getGpsInfo();
-    ui->satCountLabel->setText(QString::number(gps.num_satellites));
-    std::stringstream ss;
-    ss << gps.fix_type;
-    ui->gpsLabel->setText(QString::fromStdString(ss.str()));
-
-
-
-
-    QString mode = telemetryHandler->getFlightMode();
-    ui->flightModeLabel->setText(mode);
+}
 
 
 
-    // ARM/DISARM Label'ı için özel font ve boyut
-    setLabel(ui->armStringLabel, telemetryHandler->isArmed(), "ARM", "DISARM", "Ubuntu", 20, 700);
-
-    // Health verilerini almak
-    auto health = telemetryHandler->getHealth();
+void MainWindow::updateHealthLabels(const TelemetrySnapshot &snapshot) {
+    const auto &health = snapshot.health;
 
     // Kalibrasyonlar için font: 700 14pt "Ubuntu"
     setLabel(ui->gyroValueLabel, health.is_gyrometer_calibration_ok, "Calibrated", "Not Calibrated", "Ubuntu", 14, 700);
@@ -228,26 +642,17 @@ void MainWindow::updateTelemetryData() {
     setLabel(ui->globalPosValueLabel, health.is_global_position_ok, "Good", "Bad", "Ubuntu", 14, 700);
     setLabel(ui->homePosValueLabel, health.is_home_position_ok, "Initialized", "Not Initialized", "Ubuntu", 14, 700);
     setLabel(ui->armableValueLabel, health.is_armable, "Yes", "No", "Ubuntu", 14, 700);
-
-
-    auto RcStatus = telemetryHandler->getRcStatus();
-    ui->signalLabel->setText(QString::number(RcStatus.signal_strength_percent, 'f', 2) + "%" );
-
 }
 
 
 
 void MainWindow::updateMavsdkPlainTextEdit() {
-    auto& telemetryHandler = uavManager->getTelemetryHandler();
-    auto [message, level] = telemetryHandler->getLastLog();
+    auto [message, level] = uavManager->getLastLog();
     Logger::instance().appendLogMessage(message ,ui->MavsdkPlainTextEdit, level);
 }
 
 
-void MainWindow::updatestatusControlTextEdit() {
-
-    auto [message, level] = Logger::instance().getLastLog();
-
+void MainWindow::updatestatusControlTextEdit(const QString &message, LogLevel level) {
     Logger::instance().appendLogMessage(message ,ui->statusControlTextEdit, level);
 }
 
@@ -282,22 +687,13 @@ void MainWindow::onUAVConnected() {
         return;
     }
 
-    bool connected = connect(telemetryHandler.get(), &TelemetryHandler::telemetryDataUpdated, this, &MainWindow::updateTelemetryData);
-    bool connectedMavsdk = connect(telemetryHandler.get(), &TelemetryHandler::UavLogDataUpdated, this, &MainWindow::updateMavsdkPlainTextEdit);
-
-
-
-
-    if (!connected && !connectedMavsdk) {
-        Logger::instance().log("HATA: Telemetri sinyali bağlantısı başarısız!", ERROR);
-        qDebug() << "Sinyal bağlantısı başarısız!";
-    } else {
-        Logger::instance().log("Telemetri sinyali bağlantısı başarılı.");
-        qDebug() << "Sinyal bağlantısı başarılı!";
+    subscribeTelemetryViews(telemetryHandler.get());
+    fleetState->setActiveVehicle(uavManager->getActiveVehicle());
+    if (std::isfinite(togoLat) && std::isfinite(togoLon)) {
+        telemetryHandler->setTarget(togoLat, togoLon);
     }
-
-    Logger::instance().log("TelemetryHandler sinyali updateTelemetryData fonksiyonuna bağlandı.");
-    qDebug() << "TelemetryHandler sinyali updateTelemetryData fonksiyonuna bağlandı.";
+    Logger::instance().log("Telemetri görünümleri alan bazlı aboneliklere bağlandı.");
+    qDebug() << "Telemetri görünümleri alan bazlı aboneliklere bağlandı.";
 }
 
 
@@ -325,19 +721,21 @@ void MainWindow::updateCoordinates(double lat, double lon)
 {
     togoLat = lat;
     togoLon = lon;
-    Logger::instance().log("Yeni hedef koordinatlar: " + QString::number(lat) + ", " + QString::number(lon));
+    LOG_STRUCTURED(INFO, "Yeni hedef koordinatlar: %1, %2", lat, lon);
     ui->coordinateLabel->setText(QString("%1  %2").arg(lat).arg(lon));
+
+    // Hedefe mesafe/kerteriz türetilmiş metrikler tarafından hesaplanır
+    if (auto &telemetryHandler = uavManager->getTelemetryHandler()) {
+        telemetryHandler->setTarget(lat, lon);
+    }
 }
 
 
 void MainWindow::updateUAVPosition(double latitude, double longitude, double headingDegrees)
 {
     //Logger::instance().log("UAV pozisyon güncellemesi: " + QString::number(latitude) + ", " + QString::number(longitude) + " Heading: " + QString::number(headingDegrees));
-    QObject *rootObject = ui->quickWidget->rootObject();
-    QMetaObject::invokeMethod(rootObject, "updateUAVCoordinate",
-                              Q_ARG(QVariant, latitude),
-                              Q_ARG(QVariant, longitude),
-                              Q_ARG(QVariant, headingDegrees));
+    trailModel->append(latitude, longitude);
+    vehicleState->update(latitude, longitude, headingDegrees);
 }
 
 
@@ -3,11 +3,17 @@
 
 #include "qlabel.h"
 #include "src/Camera/CameraManager.h"
+#include "src/Map/FleetState.h"
+#include "src/Map/TileCacheServer.h"
+#include "src/Map/TrailModel.h"
+#include "src/Map/VehicleState.h"
+#include "src/Mission/MissionModel.h"
 #include "src/UAV/UAVManager.h"
 #include "src/Utils/Logger.h"
 #include <QMainWindow>
 #include <QVideoWidget>
 #include <QCamera>
+#include <QPointer>
 
 namespace Ui {
 class MainWindow;
@@ -21,6 +27,10 @@ public:
     explicit MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
     QMediaCaptureSession* getCaptureSession() const { return captureSession; }
+    UAVManager *getUAVManager() const { return uavManager; }
+    TileCacheServer *getTileCache() const { return tileCache; }
+    // Harita, karo sunucusu başlatıldıktan sonra yüklenir
+    void loadMap();
 
 
 private:
@@ -33,9 +43,21 @@ private:
     //Logger *logger;  // Logger sınıfının bir örneği
     // void updateTelemetryData();
     void updateMavsdkPlainTextEdit();
-    void updateTelemetryData();
+    void subscribeTelemetryViews(TelemetryHandler *telemetryHandler);
+    void updateStatusLabels(const TelemetrySnapshot &snapshot, quint32 changedFields);
+    void updateAttitudeIndicator(const TelemetrySnapshot &snapshot);
+    void updateHealthLabels(const TelemetrySnapshot &snapshot);
+    void updateTargetLabel(const TelemetrySnapshot &snapshot);
+    void updateStatisticsToolTips(const TelemetryStatistics &statistics);
+    void logFlightStatistics(const TelemetryStatistics &statistics);
+    void setupMissionControls();
+    void updateMissionStatus(const MissionUploader::Report &report);
+    void uploadMissionWithTerrainCheck();
 
-    void updatestatusControlTextEdit();
+    // Görev rotası araziye bundan fazla yaklaşıyorsa yükleme reddedilir
+    static constexpr double MinTerrainClearanceM = 10.0;
+
+    void updatestatusControlTextEdit(const QString &message, LogLevel level);
 
 
 
@@ -48,7 +70,16 @@ private:
     MainWindow* mainWindowPointer; // MainWindow işaretçisi
     void setLabel(QLabel* label, bool condition, const QString& trueText, const QString& falseText, const QString& fontFamily, int fontSize, int fontWeight);
 
-    double togoLat, togoLon;
+    double togoLat = qQNaN(), togoLon = qQNaN();
+    MissionModel *missionModel;  // Haritada düzenlenen çok noktalı görev
+    TileCacheServer *tileCache;  // Harita karolarını yerel paketten verir
+    TrailModel *trailModel;      // Aktif aracın haritadaki izi
+    VehicleState *vehicleState;  // Haritadaki araç işaretçisinin konumu ve yönü
+    FleetState *fleetState;      // Filodaki diğer araçların harita işaretçileri
+    static constexpr int FleetMarkerRateHz = 10;
+
+    QPointer<TelemetryHandler> subscribedHandler;
+    QList<TelemetrySubscriptionRegistry::SubscriptionId> telemetrySubscriptions;
 
 private slots:
     void updateUAVPosition(double latitude, double longitude, double headingDegrees);
@@ -0,0 +1,78 @@
+#include "FleetState.h"
+#include <cmath>
+
+FleetState::FleetState(QObject *parent)
+    : QObject(parent) {
+}
+
+
+void FleetState::update(int systemId, double latitudeDeg, double longitudeDeg, double headingDeg) {
+    if (!std::isfinite(latitudeDeg) || !std::isfinite(longitudeDeg) || (latitudeDeg == 0.0 && longitudeDeg == 0.0)) {
+        return;  // Konum kilidi yok
+    }
+    auto it = indexById.find(systemId);
+    if (it == indexById.end()) {
+        indexById.emplace(systemId, entries.size());
+        entries.push_back({systemId, latitudeDeg, longitudeDeg, headingDeg});
+        emit countChanged();
+    } else {
+        Vehicle &vehicle = entries[it->second];
+        vehicle.latitudeDeg = latitudeDeg;
+        vehicle.longitudeDeg = longitudeDeg;
+        vehicle.headingDeg = std::isfinite(headingDeg) ? headingDeg : vehicle.headingDeg;
+    }
+    emit changed();
+}
+
+
+void FleetState::remove(int systemId) {
+    auto it = indexById.find(systemId);
+    if (it == indexById.end()) {
+        return;
+    }
+    // Son eleman silinen yere taşınır
+    const std::size_t index = it->second;
+    indexById.erase(it);
+    if (index + 1 != entries.size()) {
+        entries[index] = entries.back();
+        indexById[entries[index].systemId] = index;
+    }
+    entries.pop_back();
+    emit countChanged();
+    emit changed();
+}
+
+
+void FleetState::clear() {
+    if (entries.empty()) {
+        return;
+    }
+    entries.clear();
+    indexById.clear();
+    emit countChanged();
+    emit changed();
+}
+
+
+void FleetState::setActiveVehicle(int systemId) {
+    if (active == systemId) {
+        return;
+    }
+    active = systemId;
+    emit changed();
+}
+
+
+int FleetState::count() const {
+    return static_cast<int>(entries.size());
+}
+
+
+int FleetState::activeVehicle() const {
+    return active;
+}
+
+
+const std::vector<FleetState::Vehicle> &FleetState::vehicles() const {
+    return entries;
+}
@@ -0,0 +1,44 @@
+#ifndef FLEETSTATE_H
+#define FLEETSTATE_H
+
+#include <QObject>
+#include <unordered_map>
+#include <vector>
+
+// Filodaki araçların harita için son konumları (QML'de "fleetState"). Telemetri aboneliklerinden
+// GUI thread'inde beslenir; harita katmanı changed() ile bir sonraki karede yeniden çizer.
+// Seçili araç VehicleState üzerinden ayrıca çizildiği için katman onu atlar.
+class FleetState : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    struct Vehicle {
+        int systemId;
+        double latitudeDeg;
+        double longitudeDeg;
+        double headingDeg;
+    };
+
+    explicit FleetState(QObject *parent = nullptr);
+
+    void update(int systemId, double latitudeDeg, double longitudeDeg, double headingDeg);
+    void remove(int systemId);
+    void clear();
+    void setActiveVehicle(int systemId);
+
+    int count() const;
+    int activeVehicle() const;
+    const std::vector<Vehicle> &vehicles() const;
+
+signals:
+    void changed();
+    void countChanged();
+
+private:
+    std::vector<Vehicle> entries;
+    std::unordered_map<int, std::size_t> indexById;
+    int active = -1;
+};
+
+#endif // FLEETSTATE_H
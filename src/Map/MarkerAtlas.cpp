@@ -0,0 +1,82 @@
+#include "MarkerAtlas.h"
+#include <QFont>
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QSvgRenderer>
+#include <QtMath>
+#include <cmath>
+
+namespace {
+
+constexpr qreal VehicleSize = 30.0;
+constexpr qreal ActiveVehicleSize = 38.0;  // Seçili araçta simgenin çevresinde hale
+constexpr qreal WaypointSize = 22.0;
+constexpr int Padding = 2;  // Doğrusal filtrelemede komşu görüntünün taşmaması için
+
+} // namespace
+
+MarkerAtlas::MarkerAtlas(qreal devicePixelRatio)
+    : ratio(devicePixelRatio > 0.0 ? devicePixelRatio : 1.0) {
+    QFont digitFont;
+    digitFont.setPixelSize(11);
+    digitFont.setBold(true);
+    const QFontMetricsF metrics(digitFont);
+
+    std::array<QSizeF, SpriteCount> sizes;
+    sizes[Vehicle] = QSizeF(VehicleSize, VehicleSize);
+    sizes[ActiveVehicle] = QSizeF(ActiveVehicleSize, ActiveVehicleSize);
+    sizes[Waypoint] = QSizeF(WaypointSize, WaypointSize);
+    for (int digit = 0; digit < 10; ++digit) {
+        sizes[Digit0 + digit] = QSizeF(std::ceil(metrics.horizontalAdvance(QChar('0' + digit))),
+                                       std::ceil(metrics.height()));
+    }
+
+    // Görüntüler tek satıra dizilir; koordinatlar cihaz pikselidir
+    int width = Padding;
+    int height = 0;
+    for (int sprite = 0; sprite < SpriteCount; ++sprite) {
+        const QSize pixels(qCeil(sizes[sprite].width() * ratio), qCeil(sizes[sprite].height() * ratio));
+        sources[sprite] = QRectF(width, Padding, pixels.width(), pixels.height());
+        width += pixels.width() + Padding;
+        height = qMax(height, pixels.height());
+    }
+    atlas = QImage(width, height + 2 * Padding, QImage::Format_ARGB32_Premultiplied);
+    atlas.fill(Qt::transparent);
+
+    QPainter painter(&atlas);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setRenderHint(QPainter::TextAntialiasing);
+    auto logicalRect = [this](int sprite) {
+        const QRectF source = sources[sprite];
+        return QRectF(source.topLeft() / ratio, source.size() / ratio);
+    };
+    painter.scale(ratio, ratio);
+
+    QSvgRenderer vehicleIcon(QStringLiteral(":/images/images/uav.svg"));
+    vehicleIcon.render(&painter, logicalRect(Vehicle));
+
+    const QRectF active = logicalRect(ActiveVehicle);
+    painter.setPen(QPen(QColor("#00E5FF"), 2.0));
+    painter.setBrush(QColor(0, 229, 255, 60));
+    painter.drawEllipse(active.adjusted(1.0, 1.0, -1.0, -1.0));
+    const qreal inset = (ActiveVehicleSize - VehicleSize) / 2.0;
+    vehicleIcon.render(&painter, active.adjusted(inset, inset, -inset, -inset));
+
+    // Eski MapQuickItem görev noktasıyla aynı görünüm
+    painter.setPen(QPen(Qt::black, 1.0));
+    painter.setBrush(QColor("#ccFFC107"));
+    painter.drawEllipse(logicalRect(Waypoint).adjusted(0.5, 0.5, -0.5, -0.5));
+
+    painter.setFont(digitFont);
+    painter.setPen(Qt::black);
+    for (int digit = 0; digit < 10; ++digit) {
+        painter.drawText(logicalRect(Digit0 + digit), Qt::AlignCenter, QString(QChar('0' + digit)));
+    }
+}
+
+
+QRectF MarkerAtlas::textureRect(int sprite) const {
+    const QRectF source = sources[sprite];
+    return QRectF(source.x() / atlas.width(), source.y() / atlas.height(),
+                  source.width() / atlas.width(), source.height() / atlas.height());
+}
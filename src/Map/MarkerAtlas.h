@@ -0,0 +1,38 @@
+#ifndef MARKERATLAS_H
+#define MARKERATLAS_H
+
+#include <QImage>
+#include <QRectF>
+#include <QSizeF>
+#include <array>
+
+// Harita işaretçilerinin bütün görüntüleri tek bir dokuda: araç simgesi (SVG bir kez rasterlenir),
+// seçili araç, görev noktası dairesi ve etiketler için rakamlar. Bütün işaretçiler bu dokudan
+// tek çizimde basılır. devicePixelRatio'ya göre üretilir; oran değişirse yeniden oluşturulmalıdır.
+class MarkerAtlas {
+public:
+    enum Sprite {
+        Vehicle,
+        ActiveVehicle,
+        Waypoint,
+        Digit0,
+        SpriteCount = Digit0 + 10
+    };
+
+    explicit MarkerAtlas(qreal devicePixelRatio = 1.0);
+
+    const QImage &image() const { return atlas; }
+    qreal devicePixelRatio() const { return ratio; }
+
+    // Dokudaki piksel dikdörtgeni, normalize doku koordinatları ve mantıksal (ekran) boyut
+    QRectF sourceRect(int sprite) const { return sources[sprite]; }
+    QRectF textureRect(int sprite) const;
+    QSizeF size(int sprite) const { return sources[sprite].size() / ratio; }
+
+private:
+    QImage atlas;
+    qreal ratio;
+    std::array<QRectF, SpriteCount> sources;
+};
+
+#endif // MARKERATLAS_H
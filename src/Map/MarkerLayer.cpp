@@ -0,0 +1,521 @@
+#include "MarkerLayer.h"
+#include "src/Utils/GeoMath.h"
+#include <QGeoCoordinate>
+#include <QMetaProperty>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGRenderNode>
+#include <QSGRendererInterface>
+#include <QSGTextureMaterial>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Web Mercator'un kare olduğu enlem sınırı
+constexpr double MaxMercatorLatitude = 85.05112878;
+// Kenara yakın işaretçiler kısmen görünsün diye ekranın biraz dışı da çizilir
+constexpr qreal CullMarginPx = 40.0;
+// Benzerlik dönüşümü için ikinci referans noktasının merkeze uzaklığı
+constexpr qreal ReferenceOffsetPx = 100.0;
+
+const QPointF InvalidPoint(std::numeric_limits<qreal>::quiet_NaN(), std::numeric_limits<qreal>::quiet_NaN());
+
+// [0, 1] x [0, 1] Web Mercator; y güneye doğru artar (ekranla aynı yön)
+std::complex<double> mercator(double latitudeDeg, double longitudeDeg) {
+    const double sinLatitude = std::sin(GeoMath::toRadians(std::clamp(latitudeDeg, -MaxMercatorLatitude,
+                                                                      MaxMercatorLatitude)));
+    return {(longitudeDeg + 180.0) / 360.0,
+            0.5 - std::log((1.0 + sinLatitude) / (1.0 - sinLatitude)) / (4.0 * GeoMath::Pi)};
+}
+
+// Bütün işaretçiler tek geometri ve tek doku: tek çizim çağrısı
+class MarkerGeometryNode : public QSGGeometryNode {
+public:
+    MarkerGeometryNode() {
+        auto *markerGeometry = new QSGGeometry(QSGGeometry::defaultAttributes_TexturedPoint2D(), 0, 0,
+                                               QSGGeometry::UnsignedIntType);
+        markerGeometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        setGeometry(markerGeometry);
+        auto *markerMaterial = new QSGTextureMaterial;
+        markerMaterial->setFiltering(QSGTexture::Linear);
+        markerMaterial->setFlag(QSGMaterial::Blending);
+        setMaterial(markerMaterial);
+        setFlags(OwnsGeometry | OwnsMaterial);
+    }
+
+    void setTexture(QSGTexture *newTexture) {
+        static_cast<QSGTextureMaterial *>(material())->setTexture(newTexture);
+        texture.reset(newTexture);
+        markDirty(DirtyMaterial);
+    }
+
+private:
+    std::unique_ptr<QSGTexture> texture;
+};
+
+// Yazılım arka ucu özel geometri çizmez; aynı liste QPainter ile tek çağrıda basılır
+class SoftwareMarkerNode : public QSGRenderNode {
+public:
+    explicit SoftwareMarkerNode(QQuickWindow *window)
+        : window(window) {
+    }
+
+    void render(const RenderState *state) override {
+        QSGRendererInterface *renderer = window->rendererInterface();
+        auto *painter = static_cast<QPainter *>(renderer->getResource(window, QSGRendererInterface::PainterResource));
+        if (!painter || fragments.empty()) {
+            return;
+        }
+        painter->setTransform(matrix()->toTransform());
+        painter->setOpacity(inheritedOpacity());
+        const QRegion *clipRegion = state->clipRegion();
+        if (clipRegion && !clipRegion->isEmpty()) {
+            painter->setClipRegion(*clipRegion, Qt::ReplaceClip);
+        }
+        painter->setRenderHint(QPainter::SmoothPixmapTransform);
+        painter->drawPixmapFragments(fragments.data(), static_cast<int>(fragments.size()), pixmap);
+    }
+
+    StateFlags changedStates() const override { return {}; }
+    RenderingFlags flags() const override { return BoundedRectRendering; }
+    QRectF rect() const override { return bounds; }
+
+    QQuickWindow *window;
+    QPixmap pixmap;
+    std::vector<QPainter::PixmapFragment> fragments;
+    QRectF bounds;
+};
+
+} // namespace
+
+MarkerLayer::MarkerLayer(QQuickItem *parent)
+    : QQuickItem(parent) {
+    setFlag(ItemHasContents);
+    setAcceptedMouseButtons(Qt::LeftButton);
+}
+
+
+MarkerLayer::~MarkerLayer() = default;
+
+
+QQuickItem *MarkerLayer::map() const {
+    return mapItem;
+}
+
+
+void MarkerLayer::setMap(QQuickItem *map) {
+    if (mapItem == map) {
+        return;
+    }
+    if (mapItem) {
+        disconnect(mapItem.data(), nullptr, this, nullptr);
+    }
+    mapItem = map;
+    if (mapItem) {
+        // Kamera özelliklerinden herhangi biri değişince yeniden izdüşürülür
+        const QMetaObject *meta = mapItem->metaObject();
+        const QMetaMethod slot = metaObject()->method(metaObject()->indexOfSlot("scheduleUpdate()"));
+        for (const char *name : {"center", "zoomLevel", "bearing", "tilt", "fieldOfView", "width", "height"}) {
+            const int index = meta->indexOfProperty(name);
+            if (index >= 0 && meta->property(index).hasNotifySignal()) {
+                connect(mapItem, meta->property(index).notifySignal(), this, slot);
+            }
+        }
+    }
+    emit mapChanged();
+    scheduleUpdate();
+}
+
+
+VehicleState *MarkerLayer::vehicle() const {
+    return vehicleState;
+}
+
+
+void MarkerLayer::setVehicle(VehicleState *vehicle) {
+    if (vehicleState == vehicle) {
+        return;
+    }
+    if (vehicleState) {
+        disconnect(vehicleState.data(), nullptr, this, nullptr);
+    }
+    vehicleState = vehicle;
+    if (vehicleState) {
+        connect(vehicleState, &VehicleState::coordinateChanged, this, &MarkerLayer::scheduleUpdate);
+        connect(vehicleState, &VehicleState::headingChanged, this, &MarkerLayer::scheduleUpdate);
+    }
+    emit vehicleChanged();
+    scheduleUpdate();
+}
+
+
+FleetState *MarkerLayer::fleet() const {
+    return fleetState;
+}
+
+
+void MarkerLayer::setFleet(FleetState *fleet) {
+    if (fleetState == fleet) {
+        return;
+    }
+    if (fleetState) {
+        disconnect(fleetState.data(), nullptr, this, nullptr);
+    }
+    fleetState = fleet;
+    if (fleetState) {
+        connect(fleetState, &FleetState::changed, this, &MarkerLayer::scheduleUpdate);
+    }
+    emit fleetChanged();
+    scheduleUpdate();
+}
+
+
+QAbstractItemModel *MarkerLayer::waypoints() const {
+    return waypointModel;
+}
+
+
+void MarkerLayer::setWaypoints(QAbstractItemModel *waypoints) {
+    if (waypointModel == waypoints) {
+        return;
+    }
+    if (waypointModel) {
+        disconnect(waypointModel.data(), nullptr, this, nullptr);
+    }
+    waypointModel = waypoints;
+    if (waypointModel) {
+        connect(waypointModel, &QAbstractItemModel::dataChanged, this, &MarkerLayer::reloadWaypoints);
+        connect(waypointModel, &QAbstractItemModel::rowsInserted, this, &MarkerLayer::reloadWaypoints);
+        connect(waypointModel, &QAbstractItemModel::rowsRemoved, this, &MarkerLayer::reloadWaypoints);
+        connect(waypointModel, &QAbstractItemModel::rowsMoved, this, &MarkerLayer::reloadWaypoints);
+        connect(waypointModel, &QAbstractItemModel::modelReset, this, &MarkerLayer::reloadWaypoints);
+        connect(waypointModel, &QAbstractItemModel::layoutChanged, this, &MarkerLayer::reloadWaypoints);
+    }
+    emit waypointsChanged();
+    reloadWaypoints();
+}
+
+
+int MarkerLayer::markerCount() const {
+    return drawnMarkers;
+}
+
+
+void MarkerLayer::scheduleUpdate() {
+    // Aynı karedeki bütün değişiklikler tek polish + tek çizimde birleşir
+    polish();
+    update();
+}
+
+
+void MarkerLayer::reloadWaypoints() {
+    waypointCache.clear();
+    if (waypointModel) {
+        const QHash<int, QByteArray> roles = waypointModel->roleNames();
+        const int latitudeRole = roles.key("latitude", -1);
+        const int longitudeRole = roles.key("longitude", -1);
+        const int sequenceRole = roles.key("sequence", -1);
+        const int rows = latitudeRole >= 0 && longitudeRole >= 0 ? waypointModel->rowCount() : 0;
+        waypointCache.reserve(rows);
+        for (int row = 0; row < rows; ++row) {
+            const QModelIndex index = waypointModel->index(row, 0);
+            waypointCache.push_back({waypointModel->data(index, latitudeRole).toDouble(),
+                                     waypointModel->data(index, longitudeRole).toDouble(),
+                                     sequenceRole >= 0 ? waypointModel->data(index, sequenceRole).toInt() : row + 1});
+        }
+    }
+    if (draggedWaypoint >= static_cast<int>(waypointCache.size())) {
+        draggedWaypoint = -1;
+    }
+    scheduleUpdate();
+}
+
+
+void MarkerLayer::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) {
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    scheduleUpdate();
+}
+
+
+bool MarkerLayer::updateProjection() {
+    if (!mapItem || width() <= 0.0 || height() <= 0.0) {
+        return false;
+    }
+    tilted = mapItem->property("tilt").toDouble() > 0.01;
+
+    // Eğim yokken Mercator -> ekran dönüşümü ölçek + dönme + ötelemedir; iki nokta yeter
+    const QPointF first(width() / 2.0, height() / 2.0);
+    const QPointF second(first.x() + ReferenceOffsetPx, first.y());
+    QGeoCoordinate firstCoordinate;
+    QGeoCoordinate secondCoordinate;
+    QMetaObject::invokeMethod(mapItem.data(), "toCoordinate", Q_RETURN_ARG(QGeoCoordinate, firstCoordinate),
+                              Q_ARG(QPointF, mapToItem(mapItem, first)), Q_ARG(bool, false));
+    QMetaObject::invokeMethod(mapItem.data(), "toCoordinate", Q_RETURN_ARG(QGeoCoordinate, secondCoordinate),
+                              Q_ARG(QPointF, mapToItem(mapItem, second)), Q_ARG(bool, false));
+    if (!firstCoordinate.isValid() || !secondCoordinate.isValid()) {
+        return false;
+    }
+
+    referenceMercator = mercator(firstCoordinate.latitude(), firstCoordinate.longitude());
+    referenceScreen = {first.x(), first.y()};
+    std::complex<double> delta = mercator(secondCoordinate.latitude(), secondCoordinate.longitude()) - referenceMercator;
+    delta.real(std::remainder(delta.real(), 1.0));
+    if (std::abs(delta) == 0.0) {
+        return false;
+    }
+    scale = std::complex<double>(ReferenceOffsetPx, 0.0) / delta;
+    rotationDeg = tilted ? -mapItem->property("bearing").toDouble() : GeoMath::toDegrees(std::arg(scale));
+    return true;
+}
+
+
+QPointF MarkerLayer::project(double latitudeDeg, double longitudeDeg) const {
+    if (tilted) {
+        QPointF mapPoint;
+        QMetaObject::invokeMethod(mapItem.data(), "fromCoordinate", Q_RETURN_ARG(QPointF, mapPoint),
+                                  Q_ARG(QGeoCoordinate, QGeoCoordinate(latitudeDeg, longitudeDeg)), Q_ARG(bool, false));
+        return std::isnan(mapPoint.x()) ? InvalidPoint : mapFromItem(mapItem, mapPoint);
+    }
+    std::complex<double> delta = mercator(latitudeDeg, longitudeDeg) - referenceMercator;
+    delta.real(std::remainder(delta.real(), 1.0));  // 180. meridyenin öbür tarafı
+    const std::complex<double> screen = scale * delta + referenceScreen;
+    return QPointF(screen.real(), screen.imag());
+}
+
+
+bool MarkerLayer::isVisible(const QPointF &point) const {
+    return point.x() >= -CullMarginPx && point.y() >= -CullMarginPx &&
+           point.x() <= width() + CullMarginPx && point.y() <= height() + CullMarginPx;
+}
+
+
+void MarkerLayer::addMarker(const QPointF &center, float angleDeg, int sprite, int label, qreal labelOffsetY) {
+    instances.push_back({center, angleDeg, sprite});
+    ++drawnMarkers;
+    if (label < 0) {
+        return;
+    }
+
+    // Etiket rakamları ortalanarak yan yana dizilir, dönmez
+    int digits[10];
+    int digitCount = 0;
+    do {
+        digits[digitCount++] = label % 10;
+        label /= 10;
+    } while (label > 0 && digitCount < 10);
+    qreal labelWidth = 0.0;
+    for (int i = 0; i < digitCount; ++i) {
+        labelWidth += atlas->size(MarkerAtlas::Digit0 + digits[i]).width();
+    }
+    qreal x = center.x() - labelWidth / 2.0;
+    for (int i = digitCount - 1; i >= 0; --i) {
+        const int digitSprite = MarkerAtlas::Digit0 + digits[i];
+        const qreal digitWidth = atlas->size(digitSprite).width();
+        instances.push_back({QPointF(x + digitWidth / 2.0, center.y() + labelOffsetY), 0.0f, digitSprite});
+        x += digitWidth;
+    }
+}
+
+
+void MarkerLayer::updatePolish() {
+    const qreal ratio = window() ? window()->effectiveDevicePixelRatio() : 1.0;
+    if (!atlas || !qFuzzyCompare(atlas->devicePixelRatio(), ratio)) {
+        atlas = std::make_unique<MarkerAtlas>(ratio);
+        atlasChanged = true;
+    }
+
+    const int previousCount = drawnMarkers;
+    instances.clear();
+    drawnMarkers = 0;
+    waypointScreen.assign(waypointCache.size(), InvalidPoint);
+
+    if (updateProjection()) {
+        // Çizim sırası: görev noktaları, filo, en üstte seçili araç
+        for (std::size_t i = 0; i < waypointCache.size(); ++i) {
+            const Waypoint &waypoint = waypointCache[i];
+            const QPointF position = static_cast<int>(i) == draggedWaypoint
+                                         ? dragPosition : project(waypoint.latitudeDeg, waypoint.longitudeDeg);
+            if (isVisible(position)) {
+                waypointScreen[i] = position;
+                addMarker(position, 0.0f, MarkerAtlas::Waypoint, waypoint.sequence, 0.0);
+            }
+        }
+
+        const bool showIds = fleetState && fleetState->count() > 1;
+        const qreal labelOffset = (atlas->size(MarkerAtlas::Vehicle).height() +
+                                   atlas->size(MarkerAtlas::Digit0).height()) / 2.0;
+        const int activeId = fleetState ? fleetState->activeVehicle() : -1;
+        if (fleetState) {
+            for (const FleetState::Vehicle &vehicle : fleetState->vehicles()) {
+                if (vehicle.systemId == activeId && vehicleState) {
+                    continue;
+                }
+                const QPointF position = project(vehicle.latitudeDeg, vehicle.longitudeDeg);
+                if (isVisible(position)) {
+                    addMarker(position, static_cast<float>(vehicle.headingDeg + rotationDeg), MarkerAtlas::Vehicle,
+                              showIds ? vehicle.systemId : -1, labelOffset);
+                }
+            }
+        }
+
+        if (vehicleState && vehicleState->coordinate().isValid()) {
+            const QGeoCoordinate coordinate = vehicleState->coordinate();
+            const QPointF position = project(coordinate.latitude(), coordinate.longitude());
+            if (isVisible(position)) {
+                addMarker(position, static_cast<float>(vehicleState->heading() + rotationDeg),
+                          showIds ? MarkerAtlas::ActiveVehicle : MarkerAtlas::Vehicle,
+                          showIds ? activeId : -1, labelOffset);
+            }
+        }
+    }
+
+    if (drawnMarkers != previousCount) {
+        emit markerCountChanged();
+    }
+}
+
+
+QSGNode *MarkerLayer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *) {
+    if (!atlas) {
+        return oldNode;
+    }
+
+    if (window()->rendererInterface()->graphicsApi() == QSGRendererInterface::Software) {
+        auto *node = static_cast<SoftwareMarkerNode *>(oldNode);
+        if (!node) {
+            node = new SoftwareMarkerNode(window());
+            atlasChanged = true;
+        }
+        if (atlasChanged) {
+            node->pixmap = QPixmap::fromImage(atlas->image());
+            atlasChanged = false;
+        }
+        const qreal inverseRatio = 1.0 / atlas->devicePixelRatio();
+        node->fragments.clear();
+        node->fragments.reserve(instances.size());
+        for (const Instance &instance : instances) {
+            node->fragments.push_back(QPainter::PixmapFragment::create(
+                instance.center, atlas->sourceRect(instance.sprite), inverseRatio, inverseRatio, instance.angleDeg));
+        }
+        node->bounds = boundingRect().adjusted(-CullMarginPx, -CullMarginPx, CullMarginPx, CullMarginPx);
+        node->markDirty(QSGNode::DirtyMaterial);
+        return node;
+    }
+
+    auto *node = static_cast<MarkerGeometryNode *>(oldNode);
+    if (!node) {
+        node = new MarkerGeometryNode;
+        atlasChanged = true;
+    }
+    if (atlasChanged) {
+        node->setTexture(window()->createTextureFromImage(atlas->image(), QQuickWindow::TextureHasAlphaChannel));
+        atlasChanged = false;
+    }
+
+    // İşaretçi başına dönmüş bir dörtgen: 4 köşe, 2 üçgen
+    QSGGeometry *geometry = node->geometry();
+    const int quadCount = static_cast<int>(instances.size());
+    if (geometry->vertexCount() != quadCount * 4) {
+        geometry->allocate(quadCount * 4, quadCount * 6);
+    }
+    QSGGeometry::TexturedPoint2D *vertex = geometry->vertexDataAsTexturedPoint2D();
+    quint32 *index = geometry->indexDataAsUInt();
+    for (int i = 0; i < quadCount; ++i) {
+        const Instance &instance = instances[i];
+        const QSizeF half = atlas->size(instance.sprite) / 2.0;
+        const QRectF texture = atlas->textureRect(instance.sprite);
+        const float angle = GeoMath::toRadians(instance.angleDeg);
+        const float cosAngle = std::cos(angle);
+        const float sinAngle = std::sin(angle);
+        const float x = instance.center.x();
+        const float y = instance.center.y();
+        const float halfWidth = half.width();
+        const float halfHeight = half.height();
+        const float cornerX[4] = {-halfWidth, halfWidth, halfWidth, -halfWidth};
+        const float cornerY[4] = {-halfHeight, -halfHeight, halfHeight, halfHeight};
+        const float textureX[4] = {float(texture.left()), float(texture.right()), float(texture.right()), float(texture.left())};
+        const float textureY[4] = {float(texture.top()), float(texture.top()), float(texture.bottom()), float(texture.bottom())};
+        for (int corner = 0; corner < 4; ++corner) {
+            vertex[corner].set(x + cornerX[corner] * cosAngle - cornerY[corner] * sinAngle,
+                               y + cornerX[corner] * sinAngle + cornerY[corner] * cosAngle,
+                               textureX[corner], textureY[corner]);
+        }
+        const quint32 base = static_cast<quint32>(i) * 4;
+        index[0] = base;
+        index[1] = base + 1;
+        index[2] = base + 2;
+        index[3] = base;
+        index[4] = base + 2;
+        index[5] = base + 3;
+        vertex += 4;
+        index += 6;
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+
+
+int MarkerLayer::waypointAt(const QPointF &point) const {
+    // Üstte çizilen (son) nokta önce denenir
+    const qreal radius = atlas ? atlas->size(MarkerAtlas::Waypoint).width() / 2.0 : 11.0;
+    for (int i = static_cast<int>(waypointScreen.size()) - 1; i >= 0; --i) {
+        const QPointF delta = waypointScreen[i] - point;
+        if (QPointF::dotProduct(delta, delta) <= radius * radius) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+void MarkerLayer::mousePressEvent(QMouseEvent *event) {
+    // Görev noktası dışındaki tıklamalar alttaki haritaya geçer
+    const int index = waypointAt(event->position());
+    if (index < 0) {
+        event->ignore();
+        return;
+    }
+    draggedWaypoint = index;
+    dragPosition = event->position();
+    event->accept();
+    scheduleUpdate();
+}
+
+
+void MarkerLayer::mouseMoveEvent(QMouseEvent *event) {
+    if (draggedWaypoint < 0) {
+        event->ignore();
+        return;
+    }
+    dragPosition = event->position();
+    scheduleUpdate();
+}
+
+
+void MarkerLayer::mouseReleaseEvent(QMouseEvent *event) {
+    if (draggedWaypoint < 0) {
+        event->ignore();
+        return;
+    }
+    const int index = draggedWaypoint;
+    draggedWaypoint = -1;
+    QGeoCoordinate coordinate;
+    if (mapItem) {
+        QMetaObject::invokeMethod(mapItem.data(), "toCoordinate", Q_RETURN_ARG(QGeoCoordinate, coordinate),
+                                  Q_ARG(QPointF, mapToItem(mapItem, event->position())), Q_ARG(bool, false));
+    }
+    scheduleUpdate();
+    if (coordinate.isValid()) {
+        emit waypointMoved(index, coordinate.latitude(), coordinate.longitude());
+    }
+}
+
+
+void MarkerLayer::mouseUngrabEvent() {
+    draggedWaypoint = -1;
+    scheduleUpdate();
+}
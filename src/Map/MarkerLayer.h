@@ -0,0 +1,109 @@
+#ifndef MARKERLAYER_H
+#define MARKERLAYER_H
+
+#include "src/Map/FleetState.h"
+#include "src/Map/MarkerAtlas.h"
+#include "src/Map/VehicleState.h"
+#include <QAbstractItemModel>
+#include <QPointer>
+#include <QQuickItem>
+#include <complex>
+#include <memory>
+#include <vector>
+
+// Araç simgelerini, görev noktalarını ve numaralarını tek bir sahne grafiği düğümünde çizen harita
+// katmanı (QML'de MarkerLayer, Map'in çocuğu olarak ekranı kaplar). Her işaretçi için ayrı
+// MapQuickItem + SVG yerine bütün işaretçiler ortak bir dokudan (MarkerAtlas) tek çizim çağrısıyla
+// basılır. Yazılım (GPU'suz) Qt Quick'te aynı liste tek bir drawPixmapFragments ile çizilir.
+//
+// Konumlar GUI thread'inde updatePolish() içinde ekrana izdüşürülür: eğim yokken Web Mercator'dan
+// ekrana dönüşüm bir benzerlik dönüşümüdür, kare başına harita ile iki referans noktasından bulunur ve
+// işaretçi başına birkaç çarpmadır. Görev noktaları sürüklenebilir; bırakılınca waypointMoved yayınlanır.
+class MarkerLayer : public QQuickItem {
+    Q_OBJECT
+    Q_PROPERTY(QQuickItem *map READ map WRITE setMap NOTIFY mapChanged)
+    Q_PROPERTY(VehicleState *vehicle READ vehicle WRITE setVehicle NOTIFY vehicleChanged)
+    Q_PROPERTY(FleetState *fleet READ fleet WRITE setFleet NOTIFY fleetChanged)
+    Q_PROPERTY(QAbstractItemModel *waypoints READ waypoints WRITE setWaypoints NOTIFY waypointsChanged)
+    Q_PROPERTY(int markerCount READ markerCount NOTIFY markerCountChanged)
+
+public:
+    explicit MarkerLayer(QQuickItem *parent = nullptr);
+    ~MarkerLayer() override;
+
+    QQuickItem *map() const;
+    void setMap(QQuickItem *map);
+    VehicleState *vehicle() const;
+    void setVehicle(VehicleState *vehicle);
+    FleetState *fleet() const;
+    void setFleet(FleetState *fleet);
+    QAbstractItemModel *waypoints() const;
+    void setWaypoints(QAbstractItemModel *waypoints);
+    // Son karede ekranda çizilen işaretçi sayısı
+    int markerCount() const;
+
+signals:
+    void mapChanged();
+    void vehicleChanged();
+    void fleetChanged();
+    void waypointsChanged();
+    void markerCountChanged();
+    void waypointMoved(int index, double latitude, double longitude);
+
+protected:
+    void updatePolish() override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void mouseUngrabEvent() override;
+
+private slots:
+    void scheduleUpdate();
+
+private:
+    // Çizilecek tek bir doku parçası (mantıksal piksel)
+    struct Instance {
+        QPointF center;
+        float angleDeg;
+        int sprite;
+    };
+
+    struct Waypoint {
+        double latitudeDeg;
+        double longitudeDeg;
+        int sequence;
+    };
+
+    void reloadWaypoints();
+    bool updateProjection();
+    QPointF project(double latitudeDeg, double longitudeDeg) const;
+    bool isVisible(const QPointF &point) const;
+    void addMarker(const QPointF &center, float angleDeg, int sprite, int label, qreal labelOffsetY);
+    int waypointAt(const QPointF &point) const;
+
+    QPointer<QQuickItem> mapItem;
+    QPointer<VehicleState> vehicleState;
+    QPointer<FleetState> fleetState;
+    QPointer<QAbstractItemModel> waypointModel;
+
+    std::vector<Waypoint> waypointCache;  // Model değişince okunur, her karede değil
+    std::vector<QPointF> waypointScreen;  // Son izdüşüm; ekran dışındakiler NaN
+    int draggedWaypoint = -1;
+    QPointF dragPosition;
+
+    // Ekran = scale * (mercator - referenceMercator) + referenceScreen (karmaşık sayılarla)
+    std::complex<double> scale;
+    std::complex<double> referenceMercator;
+    std::complex<double> referenceScreen;
+    double rotationDeg = 0.0;  // Harita döndürülmüşse kuzeyin ekrandaki açısı
+    bool tilted = false;  // Eğik haritada benzerlik dönüşümü geçmez, harita ile tek tek izdüşürülür
+
+    std::unique_ptr<MarkerAtlas> atlas;
+    std::vector<Instance> instances;  // updatePolish üretir, updatePaintNode tüketir
+    bool atlasChanged = true;
+    int drawnMarkers = 0;
+};
+
+#endif // MARKERLAYER_H
@@ -0,0 +1,517 @@
+#include "TileCacheServer.h"
+#include "src/Utils/GeoMath.h"
+#include "src/Utils/Logger.h"
+#include <QElapsedTimer>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QPointer>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QUrl>
+#include <algorithm>
+#include <cmath>
+
+const char *TileCacheServer::DefaultUpstream =
+    "https://api.maptiler.com/maps/satellite-v2/256/{z}/{x}/{y}.jpg?key=ClRXPuGZzvarZejWpw6q";
+
+namespace {
+
+constexpr int MaxPrefetchZoom = 19;
+constexpr int ProgressInterval = 50;  // Her karoda sinyal yayınlanmaz
+constexpr double MaxMercatorLatitude = 85.05112878;
+
+// "GET /15/19294/12405.png HTTP/1.1" -> karo
+bool parseRequestLine(const QByteArray &line, TilePack::TileId &tile) {
+    const QList<QByteArray> parts = line.split(' ');
+    if (parts.size() < 2 || parts.at(0) != "GET") {
+        return false;
+    }
+    QByteArray path = parts.at(1);
+    const int query = path.indexOf('?');
+    if (query >= 0) {
+        path.truncate(query);
+    }
+    const QList<QByteArray> segments = path.split('/');
+    if (segments.size() < 3) {
+        return false;
+    }
+    QByteArray last = segments.at(segments.size() - 1);
+    const int extension = last.indexOf('.');
+    if (extension >= 0) {
+        last.truncate(extension);
+    }
+    bool zoomOk = false, xOk = false, yOk = false;
+    tile.zoom = segments.at(segments.size() - 3).toInt(&zoomOk);
+    tile.x = segments.at(segments.size() - 2).toInt(&xOk);
+    tile.y = last.toInt(&yOk);
+    return zoomOk && xOk && yOk && TilePack::isValid(tile);
+}
+
+const char *contentType(const QByteArray &data) {
+    if (data.startsWith("\x89PNG")) {
+        return "image/png";
+    }
+    if (data.startsWith("\xFF\xD8")) {
+        return "image/jpeg";
+    }
+    return "application/octet-stream";
+}
+
+const char *statusText(int status) {
+    switch (status) {
+    case 200: return "OK";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    default: return "Bad Gateway";
+    }
+}
+
+} // namespace
+
+struct TileCacheServer::Connection {
+    QPointer<QTcpSocket> socket;
+    QByteArray buffer;
+    bool busy = false;  // Upstream bekleniyor; HTTP yanıt sırası korunmalı
+};
+
+
+TileCacheServer::TileCacheServer(QObject *parent)
+    : QObject(parent),
+    pack(std::make_shared<TilePack>()) {}
+
+
+TileCacheServer::~TileCacheServer() {
+    stop();
+}
+
+
+bool TileCacheServer::start(const QString &packPath, const QString &upstreamTemplate, quint16 port) {
+    if (isRunning()) {
+        return true;
+    }
+
+    QString error;
+    if (!pack->open(packPath, &error)) {
+        Logger::instance().log("Failed to open tile pack " + packPath + ": " + error, ERROR);
+        return false;
+    }
+    upstream = upstreamTemplate;
+
+    thread.start();
+    worker = new QObject;
+    worker->moveToThread(&thread);
+    bool ok = false;
+    QMetaObject::invokeMethod(worker, [this, port, &ok]() { openServer(port, &ok); }, Qt::BlockingQueuedConnection);
+    if (!ok) {
+        stop();
+        pack->close();
+        return false;
+    }
+
+    Logger::instance().log(QString("Tile cache server listening on %1 (%2 tiles in %3, upstream: %4)")
+                               .arg(url()).arg(pack->tileCount()).arg(packPath)
+                               .arg(upstream.isEmpty() ? "offline" : upstream), INFO);
+    return true;
+}
+
+
+void TileCacheServer::stop() {
+    if (!worker) {
+        return;
+    }
+    QMetaObject::invokeMethod(worker, [this]() { closeServer(); }, Qt::BlockingQueuedConnection);
+    thread.quit();
+    thread.wait();
+    delete worker;
+    worker = nullptr;
+
+    if (pack->isOpen()) {
+        Logger::instance().log(metricsReport(), INFO);
+        pack->close();
+    }
+}
+
+
+bool TileCacheServer::isRunning() const {
+    return serverPort.load(std::memory_order_acquire) != 0;
+}
+
+
+QString TileCacheServer::url() const {
+    const quint16 port = serverPort.load(std::memory_order_acquire);
+    return port ? QString("http://127.0.0.1:%1/").arg(port) : QString();
+}
+
+
+int TileCacheServer::tileX(double longitudeDeg, int zoom) {
+    const int tiles = 1 << zoom;
+    const int x = static_cast<int>(std::floor((longitudeDeg + 180.0) / 360.0 * tiles));
+    return std::clamp(x, 0, tiles - 1);
+}
+
+
+int TileCacheServer::tileY(double latitudeDeg, int zoom) {
+    const int tiles = 1 << zoom;
+    const double latitude = GeoMath::toRadians(std::clamp(latitudeDeg, -MaxMercatorLatitude, MaxMercatorLatitude));
+    const int y = static_cast<int>(std::floor((1.0 - std::asinh(std::tan(latitude)) / GeoMath::Pi) / 2.0 * tiles));
+    return std::clamp(y, 0, tiles - 1);
+}
+
+
+void TileCacheServer::openServer(quint16 port, bool *ok) {
+    server = new QTcpServer(worker);
+    if (!server->listen(QHostAddress::LocalHost, port)) {
+        Logger::instance().log("Tile cache server could not listen: " + server->errorString(), ERROR);
+        delete server;
+        server = nullptr;
+        *ok = false;
+        return;
+    }
+    network = new QNetworkAccessManager(worker);
+    QObject::connect(server, &QTcpServer::newConnection, worker, [this]() { acceptConnections(); });
+    serverPort.store(server->serverPort(), std::memory_order_release);
+    *ok = true;
+}
+
+
+void TileCacheServer::closeServer() {
+    serverPort.store(0, std::memory_order_release);
+    if (prefetchActive) {
+        prefetchToken.cancel();
+        finishPrefetch();
+    }
+    // Bekleyen indirmelerin geri çağrıları artık çalışmamalı
+    if (network) {
+        for (QNetworkReply *reply : network->findChildren<QNetworkReply *>()) {
+            reply->disconnect(worker);
+            reply->abort();
+        }
+    }
+    pendingFetches.clear();
+    delete network;
+    network = nullptr;
+    delete server;  // Bağlantı soketleri sunucunun çocuklarıdır
+    server = nullptr;
+}
+
+
+void TileCacheServer::acceptConnections() {
+    while (QTcpSocket *socket = server->nextPendingConnection()) {
+        auto connection = std::make_shared<Connection>();
+        connection->socket = socket;
+        socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+        QObject::connect(socket, &QTcpSocket::readyRead, worker, [this, connection]() {
+            connection->buffer += connection->socket->readAll();
+            processRequests(connection);
+        });
+        QObject::connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+    }
+}
+
+
+// Bağlantıdaki istekler sırayla yanıtlanır; bekleyen bir upstream indirmesi varsa
+// sonraki istekler tamponda kalır (HTTP/1.1 yanıt sırası)
+void TileCacheServer::processRequests(const std::shared_ptr<Connection> &connection) {
+    while (!connection->busy && connection->socket) {
+        const int headerEnd = connection->buffer.indexOf("\r\n\r\n");
+        if (headerEnd < 0) {
+            if (connection->buffer.size() > MaxRequestBytes) {
+                respond(connection->socket, 400, QByteArray(), false);
+            }
+            return;
+        }
+        const QByteArray header = connection->buffer.left(headerEnd);
+        connection->buffer.remove(0, headerEnd + 4);
+
+        const int lineEnd = header.indexOf("\r\n");
+        const QByteArray requestLine = lineEnd < 0 ? header : header.left(lineEnd);
+        const bool keepAlive = requestLine.endsWith("HTTP/1.1") && !header.toLower().contains("connection: close");
+
+        QElapsedTimer timer;
+        timer.start();
+        TilePack::TileId tile;
+        if (!parseRequestLine(requestLine, tile)) {
+            {
+                std::lock_guard<std::mutex> lock(metricsMutex);
+                ++counters.badRequests;
+            }
+            respond(connection->socket, 400, QByteArray(), false);
+            return;
+        }
+
+        const QByteArray data = pack->read(tile);
+        if (!data.isEmpty()) {
+            respond(connection->socket, 200, data, keepAlive);
+            recordLatency(true, timer.nsecsElapsed() / 1000);
+            if (!keepAlive) {
+                return;
+            }
+            continue;
+        }
+
+        connection->busy = true;
+        fetch(tile, false, [this, connection, keepAlive, timer](const QByteArray &downloaded) {
+            connection->busy = false;
+            if (!connection->socket) {
+                return;
+            }
+            respond(connection->socket, downloaded.isEmpty() ? (upstream.isEmpty() ? 404 : 502) : 200, downloaded,
+                    keepAlive);
+            recordLatency(false, timer.nsecsElapsed() / 1000);
+            if (keepAlive) {
+                processRequests(connection);
+            }
+        });
+        return;
+    }
+}
+
+
+void TileCacheServer::respond(QTcpSocket *socket, int status, const QByteArray &body, bool keepAlive) {
+    QByteArray header = "HTTP/1.1 " + QByteArray::number(status) + ' ' + statusText(status) + "\r\n";
+    header += "Content-Type: " + QByteArray(contentType(body)) + "\r\n";
+    header += "Content-Length: " + QByteArray::number(body.size()) + "\r\n";
+    header += status == 200 ? "Cache-Control: max-age=604800\r\n" : "Cache-Control: no-store\r\n";
+    header += keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+    socket->write(header);
+    if (!body.isEmpty()) {
+        socket->write(body);
+    }
+    if (!keepAlive) {
+        socket->disconnectFromHost();
+    }
+}
+
+
+// Aynı karo için tek indirme yapılır; bütün bekleyenler aynı sonucu alır
+void TileCacheServer::fetch(const TilePack::TileId &tile, bool background, TileCallback callback) {
+    const quint64 key = TilePack::key(tile);
+    auto pending = pendingFetches.find(key);
+    if (pending != pendingFetches.end()) {
+        pending->push_back(std::move(callback));
+        return;
+    }
+    if (upstream.isEmpty()) {
+        callback(QByteArray());
+        return;
+    }
+    pendingFetches[key].push_back(std::move(callback));
+
+    QString address = upstream;
+    address.replace("{z}", QString::number(tile.zoom))
+        .replace("{x}", QString::number(tile.x))
+        .replace("{y}", QString::number(tile.y));
+    QNetworkRequest request{QUrl(address)};
+    request.setPriority(background ? QNetworkRequest::LowPriority : QNetworkRequest::HighPriority);
+    request.setTransferTimeout(UpstreamTimeoutMs);
+    request.setHeader(QNetworkRequest::UserAgentHeader, "UAV_Ground_Control");
+
+    QNetworkReply *reply = network->get(request);
+    QObject::connect(reply, &QNetworkReply::finished, worker, [this, reply, tile, key]() {
+        reply->deleteLater();
+        QByteArray data;
+        if (reply->error() == QNetworkReply::NoError) {
+            data = reply->readAll();
+        }
+        if (data.isEmpty()) {
+            std::lock_guard<std::mutex> lock(metricsMutex);
+            ++counters.upstreamFailures;
+        } else if (!pack->write(tile, data)) {
+            Logger::instance().log("Tile pack write failed, tile served without caching.", WARNING);
+        }
+
+        const std::vector<TileCallback> callbacks = pendingFetches.take(key);
+        for (const TileCallback &callback : callbacks) {
+            callback(data);
+        }
+    });
+}
+
+
+bool TileCacheServer::prefetchRegion(double north, double west, double south, double east, int minZoom, int maxZoom) {
+    if (!isRunning()) {
+        Logger::instance().log("Tile cache server is not running, prefetch ignored.", WARNING);
+        return false;
+    }
+    if (upstream.isEmpty()) {
+        Logger::instance().log("Tile prefetch needs an upstream tile server.", WARNING);
+        return false;
+    }
+    minZoom = std::clamp(minZoom, 0, MaxPrefetchZoom);
+    maxZoom = std::clamp(maxZoom, minZoom, MaxPrefetchZoom);
+    if (north < south) {
+        std::swap(north, south);
+    }
+    if (east < west) {
+        std::swap(east, west);
+    }
+
+    // Bölge kaba olarak burada reddedilir ki büyük bir liste hiç oluşturulmasın
+    qint64 tiles = 0;
+    for (int zoom = minZoom; zoom <= maxZoom; ++zoom) {
+        tiles += static_cast<qint64>(tileX(east, zoom) - tileX(west, zoom) + 1) *
+                 (tileY(south, zoom) - tileY(north, zoom) + 1);
+    }
+    if (tiles > MaxPrefetchTiles) {
+        Logger::instance().log(QString("Prefetch region too large: %1 tiles (limit %2), lower the zoom range.")
+                                   .arg(tiles).arg(MaxPrefetchTiles), WARNING);
+        return false;
+    }
+
+    QMetaObject::invokeMethod(worker, [this, north, west, south, east, minZoom, maxZoom]() {
+        beginPrefetch(north, west, south, east, minZoom, maxZoom);
+    }, Qt::QueuedConnection);
+    return true;
+}
+
+
+void TileCacheServer::cancelPrefetch() {
+    if (!worker) {
+        return;
+    }
+    QMetaObject::invokeMethod(worker, [this]() {
+        if (prefetchActive) {
+            prefetchToken.cancel();
+            finishPrefetch();
+        }
+    }, Qt::QueuedConnection);
+}
+
+
+void TileCacheServer::beginPrefetch(double north, double west, double south, double east, int minZoom, int maxZoom) {
+    // Yeni bölge öncekinin yerini alır
+    if (prefetchActive) {
+        prefetchToken.cancel();
+        finishPrefetch();
+    }
+    prefetchActive = true;
+    prefetchToken = CancellationToken();
+
+    // Paketteki karolar listeye alınmaz; liste çıkarma arka planda yapılır
+    const std::shared_ptr<TilePack> tilePack = pack;
+    const bool submitted = TaskExecutor::instance().submit(worker, [tilePack, north, west, south, east, minZoom,
+                                                                    maxZoom](const CancellationToken &token) {
+        std::vector<TilePack::TileId> tiles;
+        for (int zoom = minZoom; zoom <= maxZoom && !token.isCancelled(); ++zoom) {
+            for (int y = tileY(north, zoom); y <= tileY(south, zoom); ++y) {
+                for (int x = tileX(west, zoom); x <= tileX(east, zoom); ++x) {
+                    const TilePack::TileId tile{zoom, x, y};
+                    if (!tilePack->contains(tile)) {
+                        tiles.push_back(tile);
+                    }
+                }
+            }
+        }
+        return tiles;
+    }, [this](const std::vector<TilePack::TileId> &tiles) {
+        startPrefetch(tiles);
+    }, TaskExecutor::Priority::Low, prefetchToken);
+
+    if (!submitted) {
+        finishPrefetch();
+    }
+}
+
+
+void TileCacheServer::startPrefetch(std::vector<TilePack::TileId> tiles) {
+    if (!prefetchActive) {
+        return;
+    }
+    prefetchQueue.assign(tiles.begin(), tiles.end());
+    prefetchTotal = static_cast<int>(tiles.size());
+    prefetchCompleted = 0;
+    prefetchFailed = 0;
+    Logger::instance().log(QString("Tile prefetch started: %1 missing tiles.").arg(prefetchTotal), INFO);
+    emit prefetchProgress(0, prefetchTotal);
+    pumpPrefetch();
+}
+
+
+void TileCacheServer::pumpPrefetch() {
+    while (prefetchActive && prefetchInFlight < MaxConcurrentPrefetch && !prefetchQueue.empty()) {
+        const TilePack::TileId tile = prefetchQueue.front();
+        prefetchQueue.pop_front();
+
+        ++prefetchInFlight;
+        const quint64 generation = prefetchGeneration;
+        fetch(tile, true, [this, generation](const QByteArray &data) {
+            --prefetchInFlight;
+            if (generation == prefetchGeneration) {
+                ++prefetchCompleted;
+                if (data.isEmpty()) {
+                    ++prefetchFailed;
+                } else {
+                    std::lock_guard<std::mutex> lock(metricsMutex);
+                    ++counters.prefetched;
+                }
+                if (prefetchCompleted % ProgressInterval == 0 || prefetchCompleted == prefetchTotal) {
+                    emit prefetchProgress(prefetchCompleted, prefetchTotal);
+                }
+            }
+            pumpPrefetch();
+        });
+    }
+
+    if (prefetchActive && prefetchQueue.empty() && prefetchCompleted == prefetchTotal) {
+        finishPrefetch();
+    }
+}
+
+
+void TileCacheServer::finishPrefetch() {
+    const bool cancelled = prefetchToken.isCancelled();
+    const int downloaded = prefetchCompleted - prefetchFailed;
+    prefetchActive = false;
+    prefetchQueue.clear();
+    ++prefetchGeneration;
+
+    Logger::instance().log(QString("Tile prefetch %1: %2 downloaded, %3 failed.")
+                               .arg(cancelled ? "cancelled" : "finished").arg(downloaded).arg(prefetchFailed),
+                           prefetchFailed > 0 ? WARNING : INFO);
+    emit prefetchFinished(downloaded, prefetchFailed, cancelled);
+}
+
+
+void TileCacheServer::recordLatency(bool hit, qint64 elapsedUs) {
+    std::lock_guard<std::mutex> lock(metricsMutex);
+    ++counters.requests;
+    if (hit) {
+        ++counters.hits;
+        counters.hitLatencyUs.add(static_cast<double>(elapsedUs));
+    } else {
+        ++counters.misses;
+        counters.missLatencyUs.add(static_cast<double>(elapsedUs));
+    }
+}
+
+
+TileCacheServer::Metrics TileCacheServer::metrics() const {
+    Metrics result;
+    {
+        std::lock_guard<std::mutex> lock(metricsMutex);
+        result = counters;
+    }
+    result.packTiles = pack->tileCount();
+    result.packBytes = pack->dataBytes();
+    return result;
+}
+
+
+QString TileCacheServer::metricsReport() const {
+    Metrics m = metrics();
+    const double hitRate = m.requests ? 100.0 * static_cast<double>(m.hits) / static_cast<double>(m.requests) : 0.0;
+    QString text = QString("Tile cache: %1 requests, hit rate %2%, %3 upstream failures, %4 prefetched, "
+                           "pack %5 tiles (%6 MB)")
+                       .arg(m.requests).arg(hitRate, 0, 'f', 1).arg(m.upstreamFailures).arg(m.prefetched)
+                       .arg(m.packTiles).arg(m.packBytes / (1024.0 * 1024.0), 0, 'f', 1);
+    if (m.hitLatencyUs.count() > 0) {
+        text += QString(", hit p50 %1 ms p99 %2 ms").arg(m.hitLatencyUs.quantile(0.5) / 1000.0, 0, 'f', 3)
+                    .arg(m.hitLatencyUs.quantile(0.99) / 1000.0, 0, 'f', 3);
+    }
+    if (m.missLatencyUs.count() > 0) {
+        text += QString(", miss p50 %1 ms p99 %2 ms").arg(m.missLatencyUs.quantile(0.5) / 1000.0, 0, 'f', 1)
+                    .arg(m.missLatencyUs.quantile(0.99) / 1000.0, 0, 'f', 1);
+    }
+    return text;
+}
@@ -0,0 +1,119 @@
+#ifndef TILECACHESERVER_H
+#define TILECACHESERVER_H
+
+#include "src/Map/TilePack.h"
+#include "src/Utils/StreamingStatistics.h"
+#include "src/Utils/TaskExecutor.h"
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QThread>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class QNetworkAccessManager;
+class QTcpServer;
+class QTcpSocket;
+
+// QML haritasına karoları yerel bir HTTP sunucusundan verir (osm eklentisinin
+// "osm.mapping.custom.host" parametresi http://127.0.0.1:<port>/ olarak ayarlanır).
+// İstekler önce TilePack'ten karşılanır; yoksa upstream şablonundan ({z}/{x}/{y}) indirilir,
+// pakete yazılır ve istemciye gönderilir. Aynı karoya gelen eşzamanlı istekler tek indirme bekler.
+// Sunucu, indirmeler ve paket yazmaları kendi thread'inde çalışır; GUI thread'i karo trafiği görmez.
+// Bölge önbellekleme: karo listesi TaskExecutor'da çıkarılır, indirmeler düşük öncelikle ve
+// sınırlı paralellikte yapılır; canlı harita istekleri önceliklidir.
+class TileCacheServer : public QObject {
+    Q_OBJECT
+
+public:
+    struct Metrics {
+        quint64 requests = 0;
+        quint64 hits = 0;
+        quint64 misses = 0;
+        quint64 upstreamFailures = 0;
+        quint64 badRequests = 0;
+        quint64 prefetched = 0;
+        std::size_t packTiles = 0;
+        qint64 packBytes = 0;
+        StreamingStatistics hitLatencyUs;   // İstek ayrıştırıldıktan yanıt sokete yazılana kadar
+        StreamingStatistics missLatencyUs;  // Upstream indirmesi dahil
+    };
+
+    static const char *DefaultUpstream;
+    static constexpr int MaxConcurrentPrefetch = 6;
+    static constexpr int MaxPrefetchTiles = 200000;
+    static constexpr int MaxRequestBytes = 8192;
+    static constexpr int UpstreamTimeoutMs = 15000;
+
+    explicit TileCacheServer(QObject *parent = nullptr);
+    ~TileCacheServer();
+
+    // upstreamTemplate boşsa sadece paketteki karolar verilir (çevrimdışı)
+    bool start(const QString &packPath, const QString &upstreamTemplate = DefaultUpstream, quint16 port = 0);
+    void stop();
+    bool isRunning() const;
+    // Sunucu çalışmıyorsa boş
+    QString url() const;
+
+    // Web Mercator karo numaraları
+    static int tileX(double longitudeDeg, int zoom);
+    static int tileY(double latitudeDeg, int zoom);
+
+    // Enlem/boylam kutusundaki karoları [minZoom, maxZoom] aralığında pakete indirir.
+    // Bölge çok büyükse veya upstream yoksa false döner; aksi halde sonuç prefetchFinished ile gelir.
+    Q_INVOKABLE bool prefetchRegion(double north, double west, double south, double east, int minZoom, int maxZoom);
+    Q_INVOKABLE void cancelPrefetch();
+
+    Metrics metrics() const;
+    QString metricsReport() const;
+
+signals:
+    void prefetchProgress(int completed, int total);
+    void prefetchFinished(int downloaded, int failed, bool cancelled);
+
+private:
+    using TileCallback = std::function<void(const QByteArray &data)>;
+    struct Connection;
+
+    // Sunucu thread'inde çalışır
+    void openServer(quint16 port, bool *ok);
+    void closeServer();
+    void acceptConnections();
+    void processRequests(const std::shared_ptr<Connection> &connection);
+    void respond(QTcpSocket *socket, int status, const QByteArray &body, bool keepAlive);
+    void fetch(const TilePack::TileId &tile, bool background, TileCallback callback);
+    void beginPrefetch(double north, double west, double south, double east, int minZoom, int maxZoom);
+    void startPrefetch(std::vector<TilePack::TileId> tiles);
+    void pumpPrefetch();
+    void finishPrefetch();
+
+    void recordLatency(bool hit, qint64 elapsedUs);
+
+    std::shared_ptr<TilePack> pack;  // Arka plan görevleriyle paylaşılır
+    QString upstream;
+    QThread thread;
+    QObject *worker = nullptr;  // Sunucu thread'inde yaşar; soketlerin bağlamı
+    QTcpServer *server = nullptr;
+    QNetworkAccessManager *network = nullptr;
+    QHash<quint64, std::vector<TileCallback>> pendingFetches;
+    std::atomic<quint16> serverPort{0};
+
+    // Bölge önbellekleme (sunucu thread'i)
+    std::deque<TilePack::TileId> prefetchQueue;
+    CancellationToken prefetchToken;
+    quint64 prefetchGeneration = 0;  // Biten işin geç gelen indirmeleri sayılmaz
+    bool prefetchActive = false;
+    int prefetchTotal = 0;
+    int prefetchCompleted = 0;
+    int prefetchFailed = 0;
+    int prefetchInFlight = 0;
+
+    mutable std::mutex metricsMutex;
+    Metrics counters;
+};
+
+#endif // TILECACHESERVER_H
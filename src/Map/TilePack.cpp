@@ -0,0 +1,209 @@
+#include "TilePack.h"
+#include <QtEndian>
+#include <algorithm>
+
+TilePack::~TilePack() {
+    close();
+}
+
+
+bool TilePack::open(const QString &filePath, QString *error) {
+    close();
+    std::lock_guard<std::mutex> lock(mutex);
+
+    writer.setFileName(filePath);
+    if (!writer.open(QIODevice::ReadWrite)) {
+        if (error) {
+            *error = writer.errorString();
+        }
+        return false;
+    }
+
+    if (writer.size() < HeaderBytes) {
+        // Yeni paket
+        dataEnd = HeaderBytes;
+        if (!writer.resize(GrowthBytes) || !writeHeaderLocked()) {
+            if (error) {
+                *error = writer.errorString();
+            }
+            writer.close();
+            return false;
+        }
+    } else {
+        uchar header[HeaderBytes];
+        if (writer.read(reinterpret_cast<char *>(header), HeaderBytes) != HeaderBytes ||
+            qFromLittleEndian<quint32>(header) != Magic || qFromLittleEndian<quint32>(header + 4) != Version) {
+            if (error) {
+                *error = "not a tile pack";
+            }
+            writer.close();
+            return false;
+        }
+        // Kesilmiş dosyada tarama son tam kayıtta durur
+        dataEnd = std::clamp<qint64>(static_cast<qint64>(qFromLittleEndian<quint64>(header + 8)), HeaderBytes,
+                                     writer.size());
+    }
+
+    if (!remapLocked(writer.size(), error)) {
+        writer.close();
+        return false;
+    }
+    scanLocked();
+    return true;
+}
+
+
+void TilePack::close() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!writer.isOpen()) {
+        return;
+    }
+    // Önceden büyütülmüş boş alan atılır; okuyucular sadece veri sonundan önceki baytlara erişir
+    mapping.reset();
+    writer.resize(dataEnd);
+    writer.close();
+    index.clear();
+    dataEnd = HeaderBytes;
+}
+
+
+bool TilePack::isOpen() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return mapping != nullptr;
+}
+
+
+bool TilePack::isValid(const TileId &tile) {
+    if (tile.zoom < 0 || tile.zoom > MaxZoom) {
+        return false;
+    }
+    const int tiles = 1 << tile.zoom;
+    return tile.x >= 0 && tile.x < tiles && tile.y >= 0 && tile.y < tiles;
+}
+
+
+quint64 TilePack::key(const TileId &tile) {
+    return (static_cast<quint64>(tile.zoom) << 58) | (static_cast<quint64>(tile.x) << 29) |
+           static_cast<quint64>(tile.y);
+}
+
+
+bool TilePack::contains(const TileId &tile) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index.find(key(tile)) != index.end();
+}
+
+
+QByteArray TilePack::read(const TileId &tile) const {
+    std::shared_ptr<Mapping> current;
+    Entry entry{};
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = index.find(key(tile));
+        if (it == index.end() || !mapping) {
+            return QByteArray();
+        }
+        entry = it->second;
+        current = mapping;
+    }
+    // Kopya kilit dışında yapılır; eşleme current ile canlı tutulur
+    return QByteArray(reinterpret_cast<const char *>(current->data + entry.offset), static_cast<int>(entry.length));
+}
+
+
+bool TilePack::write(const TileId &tile, const QByteArray &data) {
+    if (!isValid(tile) || data.isEmpty() || static_cast<quint64>(data.size()) > MaxTileBytes) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!mapping) {
+        return false;
+    }
+
+    const qint64 recordBytes = RecordHeaderBytes + data.size();
+    if (dataEnd + recordBytes > mapping->size) {
+        const qint64 capacity = (dataEnd + recordBytes + GrowthBytes - 1) / GrowthBytes * GrowthBytes;
+        if (!writer.resize(capacity) || !remapLocked(capacity, nullptr)) {
+            return false;
+        }
+    }
+
+    uchar header[RecordHeaderBytes];
+    qToLittleEndian<quint32>(RecordMagic, header);
+    qToLittleEndian<quint32>(static_cast<quint32>(data.size()), header + 4);
+    qToLittleEndian<quint64>(key(tile), header + 8);
+    if (!writer.seek(dataEnd) ||
+        writer.write(reinterpret_cast<const char *>(header), RecordHeaderBytes) != RecordHeaderBytes ||
+        writer.write(data) != data.size() || !writer.flush()) {
+        return false;
+    }
+
+    // Kayıt tamamlandıktan sonra görünür olur
+    index[key(tile)] = {dataEnd + RecordHeaderBytes, static_cast<quint32>(data.size())};
+    dataEnd += recordBytes;
+    return writeHeaderLocked();
+}
+
+
+std::size_t TilePack::tileCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index.size();
+}
+
+
+qint64 TilePack::dataBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return dataEnd;
+}
+
+
+bool TilePack::remapLocked(qint64 capacity, QString *error) {
+    auto newMapping = std::make_shared<Mapping>();
+    newMapping->file.setFileName(writer.fileName());
+    if (!newMapping->file.open(QIODevice::ReadOnly)) {
+        if (error) {
+            *error = newMapping->file.errorString();
+        }
+        return false;
+    }
+    newMapping->data = newMapping->file.map(0, capacity);
+    if (!newMapping->data) {
+        if (error) {
+            *error = newMapping->file.errorString();
+        }
+        return false;
+    }
+    newMapping->size = capacity;
+    mapping = std::move(newMapping);
+    return true;
+}
+
+
+void TilePack::scanLocked() {
+    index.clear();
+    const uchar *data = mapping->data;
+    qint64 offset = HeaderBytes;
+    while (offset + RecordHeaderBytes <= dataEnd) {
+        const quint32 magic = qFromLittleEndian<quint32>(data + offset);
+        const quint32 length = qFromLittleEndian<quint32>(data + offset + 4);
+        if (magic != RecordMagic || length == 0 || length > MaxTileBytes ||
+            offset + RecordHeaderBytes + length > dataEnd) {
+            break;  // Bozuk kuyruk: sonraki yazma üzerine yazar
+        }
+        const quint64 tileKey = qFromLittleEndian<quint64>(data + offset + 8);
+        index[tileKey] = {offset + RecordHeaderBytes, length};
+        offset += RecordHeaderBytes + length;
+    }
+    dataEnd = offset;
+}
+
+
+bool TilePack::writeHeaderLocked() {
+    uchar header[HeaderBytes];
+    qToLittleEndian<quint32>(Magic, header);
+    qToLittleEndian<quint32>(Version, header + 4);
+    qToLittleEndian<quint64>(static_cast<quint64>(dataEnd), header + 8);
+    return writer.seek(0) && writer.write(reinterpret_cast<const char *>(header), HeaderBytes) == HeaderBytes &&
+           writer.flush();
+}
@@ -0,0 +1,83 @@
+#ifndef TILEPACK_H
+#define TILEPACK_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Harita karolarını tek dosyada tutan, MBTiles benzeri kap.
+// Dosya: başlık (sihirli sayı, sürüm, veri sonu) + art arda eklenen kayıtlar
+// (sihirli sayı, uzunluk, z/x/y anahtarı, karo baytları). Dosya büyük parçalar halinde
+// önceden büyütülür ve tamamı bir kez mmap edilir; okuma, bellekteki anahtar->konum
+// indeksinde tek arama ve eşlemeden kopyadır. İndeks açılışta kayıt başlıkları taranarak kurulur.
+// Yazmalar sona eklenir, veri sonu başlığa en son yazılır: yarım kalan kayıt bir sonraki
+// açılışta görülmez. Aynı karo tekrar yazılırsa indeks yeni kaydı gösterir (eski yer boşa gider).
+// Bütün fonksiyonlar thread-safe'tir.
+class TilePack {
+public:
+    struct TileId {
+        int zoom = 0;
+        int x = 0;
+        int y = 0;
+    };
+
+    static constexpr quint32 Magic = 0x4b505455;        // "UTPK"
+    static constexpr quint32 RecordMagic = 0x454c4954;  // "TILE"
+    static constexpr quint32 Version = 1;
+    static constexpr qint64 HeaderBytes = 16;
+    static constexpr qint64 RecordHeaderBytes = 16;
+    static constexpr qint64 GrowthBytes = 16 * 1024 * 1024;
+    static constexpr quint32 MaxTileBytes = 4 * 1024 * 1024;
+    static constexpr int MaxZoom = 24;
+
+    TilePack() = default;
+    ~TilePack();
+
+    TilePack(const TilePack &) = delete;
+    TilePack &operator=(const TilePack &) = delete;
+
+    // Dosya yoksa oluşturulur
+    bool open(const QString &filePath, QString *error = nullptr);
+    void close();
+    bool isOpen() const;
+
+    bool contains(const TileId &tile) const;
+    // Karo yoksa boş döner
+    QByteArray read(const TileId &tile) const;
+    bool write(const TileId &tile, const QByteArray &data);
+
+    std::size_t tileCount() const;
+    qint64 dataBytes() const;
+
+    static bool isValid(const TileId &tile);
+    static quint64 key(const TileId &tile);
+
+private:
+    struct Entry {
+        qint64 offset;  // Karo baytlarının başı
+        quint32 length;
+    };
+
+    // Yeniden eşlemede eski eşleme, onu okuyan thread bırakana kadar yaşar
+    struct Mapping {
+        QFile file;
+        const uchar *data = nullptr;
+        qint64 size = 0;
+    };
+
+    bool remapLocked(qint64 capacity, QString *error);
+    void scanLocked();
+    bool writeHeaderLocked();
+
+    mutable std::mutex mutex;
+    QFile writer;
+    std::shared_ptr<Mapping> mapping;
+    std::unordered_map<quint64, Entry> index;
+    qint64 dataEnd = HeaderBytes;
+};
+
+#endif // TILEPACK_H
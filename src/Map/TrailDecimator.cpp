@@ -0,0 +1,223 @@
+#include "TrailDecimator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr double TwoPi = 2.0 * GeoMath::Pi;
+}
+
+TrailDecimator::TrailDecimator() {
+    for (int i = 0; i < LevelCount; ++i) {
+        levels[i].toleranceM = toleranceM(i);
+    }
+}
+
+
+double TrailDecimator::toleranceM(int level) {
+    return BaseToleranceM * std::pow(4.0, level);
+}
+
+
+bool TrailDecimator::append(double latitudeDeg, double longitudeDeg, std::uint32_t *committedLevels) {
+    if (committedLevels) {
+        *committedLevels = 0;
+    }
+    if (!std::isfinite(latitudeDeg) || !std::isfinite(longitudeDeg) || std::abs(latitudeDeg) > 90.0 ||
+        (latitudeDeg == 0.0 && longitudeDeg == 0.0)) {
+        return false;
+    }
+
+    const Point point{static_cast<std::int32_t>(std::lround(latitudeDeg * 1e7)),
+                      static_cast<std::int32_t>(std::lround(longitudeDeg * 1e7))};
+    if (!points.empty() && points.back().latitudeE7 == point.latitudeE7 &&
+        points.back().longitudeE7 == point.longitudeE7) {
+        return false;
+    }
+    if (points.empty()) {
+        projection = GeoMath::LocalProjection(latitudeDeg, longitudeDeg);
+    }
+    points.push_back(point);
+
+    const std::uint32_t index = static_cast<std::uint32_t>(points.size() - 1);
+    double x, y;
+    project(index, x, y);
+    std::uint32_t committed = 0;
+    for (int i = 0; i < LevelCount; ++i) {
+        if (update(levels[i], index, x, y)) {
+            committed |= 1u << i;
+        }
+    }
+    if (committedLevels) {
+        *committedLevels = committed;
+    }
+    return true;
+}
+
+
+void TrailDecimator::clear() {
+    points.clear();
+    points.shrink_to_fit();
+    for (Level &level : levels) {
+        level.vertices.clear();
+        level.vertices.shrink_to_fit();
+        level.hasInterval = false;
+        level.maxDistanceM = 0.0;
+    }
+}
+
+
+std::size_t TrailDecimator::vertexCount(int level) const {
+    return levels[level].vertices.size();
+}
+
+
+std::size_t TrailDecimator::memoryBytes() const {
+    std::size_t bytes = points.capacity() * sizeof(Point);
+    for (const Level &level : levels) {
+        bytes += level.vertices.capacity() * sizeof(std::uint32_t);
+    }
+    return bytes;
+}
+
+
+int TrailDecimator::levelFor(double metersPerPixel, std::size_t maxVertices) const {
+    int level = 0;
+    while (level + 1 < LevelCount && levels[level + 1].toleranceM <= metersPerPixel) {
+        ++level;
+    }
+    while (level + 1 < LevelCount && levels[level].vertices.size() > maxVertices) {
+        ++level;
+    }
+    return level;
+}
+
+
+std::vector<GeoPoint> TrailDecimator::vertices(int level) const {
+    std::vector<GeoPoint> result;
+    result.reserve(levels[level].vertices.size() + 1);
+    appendVertices(level, 0, result);
+    if (!points.empty() && levels[level].vertices.back() != points.size() - 1) {
+        result.push_back(lastPoint());
+    }
+    return result;
+}
+
+
+void TrailDecimator::appendVertices(int level, std::size_t firstVertex, std::vector<GeoPoint> &out) const {
+    const std::vector<std::uint32_t> &indices = levels[level].vertices;
+    for (std::size_t i = firstVertex; i < indices.size(); ++i) {
+        out.push_back(toGeo(points[indices[i]]));
+    }
+}
+
+
+GeoPoint TrailDecimator::lastVertex(int level) const {
+    const std::vector<std::uint32_t> &indices = levels[level].vertices;
+    return indices.empty() ? GeoPoint() : toGeo(points[indices.back()]);
+}
+
+
+GeoPoint TrailDecimator::lastPoint() const {
+    return points.empty() ? GeoPoint() : toGeo(points.back());
+}
+
+
+void TrailDecimator::project(std::uint32_t index, double &x, double &y) const {
+    projection.toLocal(points[index].latitudeE7 * 1e-7, points[index].longitudeE7 * 1e-7, x, y);
+}
+
+
+GeoPoint TrailDecimator::toGeo(const Point &point) {
+    return {point.latitudeE7 * 1e-7, point.longitudeE7 * 1e-7};
+}
+
+
+void TrailDecimator::startSegment(Level &level, std::uint32_t anchor) {
+    project(anchor, level.anchorX, level.anchorY);
+    level.maxDistanceM = 0.0;
+    level.hasInterval = false;
+}
+
+
+// Yeni köşe eklendiyse true
+bool TrailDecimator::update(Level &level, std::uint32_t index, double x, double y) {
+    if (level.vertices.empty()) {
+        level.vertices.push_back(index);
+        startSegment(level, index);
+        return true;
+    }
+
+    const double tolerance = level.toleranceM;
+    double dx = x - level.anchorX;
+    double dy = y - level.anchorY;
+    double distance = std::hypot(dx, dy);
+    double direction = 0.0;
+
+    // Kiriş aradaki noktaların yön aralığının dışındaysa veya araç geri dönüp köşeden en uzak
+    // nokta kirişin ucundan tolerans kadar uzakta kaldıysa önceki nokta köşe olur
+    bool violated = false;
+    if (distance > tolerance) {
+        direction = std::atan2(dy, dx);
+        if (level.hasInterval) {
+            direction = unwrap(direction, 0.5 * (level.low + level.high));
+            violated = direction < level.low || direction > level.high;
+        }
+    }
+    if (!violated && distance < level.maxDistanceM) {
+        violated = std::hypot(level.farthestX - x, level.farthestY - y) > tolerance &&
+                   distanceToChord(level, x, y) > tolerance;
+    }
+
+    if (violated) {
+        level.vertices.push_back(index - 1);
+        startSegment(level, index - 1);
+        dx = x - level.anchorX;
+        dy = y - level.anchorY;
+        distance = std::hypot(dx, dy);
+        direction = std::atan2(dy, dx);
+    }
+
+    // Bu noktanın tolerans içinde kalması için kirişin yön aralığı daraltılır
+    if (distance > tolerance) {
+        const double halfWidth = std::asin(tolerance / distance);
+        if (!level.hasInterval) {
+            level.low = direction - halfWidth;
+            level.high = direction + halfWidth;
+            level.hasInterval = true;
+        } else {
+            direction = unwrap(direction, 0.5 * (level.low + level.high));
+            level.low = std::max(level.low, direction - halfWidth);
+            level.high = std::min(level.high, direction + halfWidth);
+        }
+    }
+    if (distance > level.maxDistanceM) {
+        level.maxDistanceM = distance;
+        level.farthestX = x;
+        level.farthestY = y;
+    }
+    return violated;
+}
+
+
+// Köşeden en uzak noktanın köşe-(x, y) kirişine uzaklığı
+double TrailDecimator::distanceToChord(const Level &level, double x, double y) {
+    const double vx = x - level.anchorX;
+    const double vy = y - level.anchorY;
+    const double px = level.farthestX - level.anchorX;
+    const double py = level.farthestY - level.anchorY;
+    const double lengthSquared = vx * vx + vy * vy;
+    const double t = lengthSquared > 0.0 ? std::clamp((px * vx + py * vy) / lengthSquared, 0.0, 1.0) : 0.0;
+    return std::hypot(px - t * vx, py - t * vy);
+}
+
+
+// Açıyı reference'ın ±pi çevresine taşır
+double TrailDecimator::unwrap(double angle, double reference) {
+    while (angle - reference > GeoMath::Pi) {
+        angle -= TwoPi;
+    }
+    while (angle - reference < -GeoMath::Pi) {
+        angle += TwoPi;
+    }
+    return angle;
+}
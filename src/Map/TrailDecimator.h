@@ -0,0 +1,76 @@
+#ifndef TRAILDECIMATOR_H
+#define TRAILDECIMATOR_H
+
+#include "src/Utils/GeoMath.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Aracın izini tam çözünürlükte (nokta başına 8 bayt, 1e-7 derece) saklar ve her
+// yakınlaştırma seviyesi grubu için sadeleştirilmiş bir çoklu çizgiyi akış halinde günceller.
+// Sadeleştirme "sleeve fitting" (akan Douglas-Peucker eşdeğeri) ile yapılır: son köşeden çıkan
+// kirişin aradaki bütün noktalardan tolerans içinde geçtiği yön aralığı tutulur; yeni nokta
+// bu aralığın dışına düşerse önceki nokta köşe olur. Nokta başına seviye başına O(1) iş,
+// geçmişe bir daha bakılmaz. Seviye k'nin toleransı BaseToleranceM * 4^k metredir; araç kiriş
+// doğrultusunda geri döndüğünde sapma toleransın en fazla √2 katına çıkabilir.
+// Tek thread'den kullanılmalıdır.
+class TrailDecimator {
+public:
+    struct Point {
+        std::int32_t latitudeE7;
+        std::int32_t longitudeE7;
+    };
+
+    static constexpr int LevelCount = 8;
+    static constexpr double BaseToleranceM = 0.5;
+
+    TrailDecimator();
+
+    // Geçersiz veya bir öncekiyle aynı nokta eklenmez (false). committedLevels, yeni köşe
+    // eklenen seviyelerin bit maskesidir.
+    bool append(double latitudeDeg, double longitudeDeg, std::uint32_t *committedLevels = nullptr);
+    void clear();
+
+    std::size_t pointCount() const { return points.size(); }
+    std::size_t vertexCount(int level) const;
+    std::size_t memoryBytes() const;
+    static double toleranceM(int level);
+
+    // metersPerPixel'e göre 1 pikselden kaba olmayan en kaba seviye; maxVertices aşılıyorsa daha kaba
+    int levelFor(double metersPerPixel, std::size_t maxVertices) const;
+
+    // Seviyenin kesinleşmiş köşeleri ve son nokta (izin tamamı)
+    std::vector<GeoPoint> vertices(int level) const;
+    // Sadece kesinleşmiş köşeler; firstVertex'ten itibaren (artımlı güncelleme için)
+    void appendVertices(int level, std::size_t firstVertex, std::vector<GeoPoint> &out) const;
+    GeoPoint lastVertex(int level) const;
+    GeoPoint lastPoint() const;
+
+private:
+    struct Level {
+        double toleranceM = 0.0;
+        std::vector<std::uint32_t> vertices;  // points içine indisler
+        double anchorX = 0.0;
+        double anchorY = 0.0;
+        double maxDistanceM = 0.0;  // Geri dönüşü yakalamak için köşeden en uzak nokta
+        double farthestX = 0.0;
+        double farthestY = 0.0;
+        double low = 0.0;           // İzin verilen kiriş yönleri [low, high] (radyan)
+        double high = 0.0;
+        bool hasInterval = false;
+    };
+
+    void project(std::uint32_t index, double &x, double &y) const;
+    static GeoPoint toGeo(const Point &point);
+    bool update(Level &level, std::uint32_t index, double x, double y);
+    static double distanceToChord(const Level &level, double x, double y);
+    static double unwrap(double angle, double reference);
+    void startSegment(Level &level, std::uint32_t anchor);
+
+    std::vector<Point> points;
+    std::array<Level, LevelCount> levels;
+    GeoMath::LocalProjection projection;  // İlk noktada sabitlenir
+};
+
+#endif // TRAILDECIMATOR_H
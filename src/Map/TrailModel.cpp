@@ -0,0 +1,135 @@
+#include "TrailModel.h"
+#include <QGeoCoordinate>
+#include <cmath>
+
+namespace {
+
+// 256 piksellik Web Mercator karolarında ekvatorda zoom 0 piksel boyu
+constexpr double EquatorMetersPerPixel = 156543.03392;
+
+QVariant toVariant(const GeoPoint &point) {
+    return QVariant::fromValue(QGeoCoordinate(point.latitudeDeg, point.longitudeDeg));
+}
+
+} // namespace
+
+TrailModel::TrailModel(QObject *parent)
+    : QObject(parent) {
+    refreshTimer.setSingleShot(true);
+    refreshTimer.setInterval(RefreshIntervalMs);
+    connect(&refreshTimer, &QTimer::timeout, this, &TrailModel::refreshPath);
+}
+
+
+void TrailModel::append(double latitudeDeg, double longitudeDeg) {
+    std::uint32_t committedLevels = 0;
+    if (!trail.append(latitudeDeg, longitudeDeg, &committedLevels)) {
+        return;
+    }
+
+    const int newLevel = selectLevel();
+    if (newLevel != activeLevel) {
+        setLevel(newLevel);
+    } else if ((committedLevels & (1u << activeLevel)) && !refreshTimer.isActive()) {
+        refreshTimer.start();
+    }
+    emit tailChanged();
+}
+
+
+void TrailModel::clear() {
+    refreshTimer.stop();
+    trail.clear();
+    cachedPath.clear();
+    cachedVertices = 0;
+    emit pathChanged();
+    emit tailChanged();
+}
+
+
+QVariantList TrailModel::path() const {
+    return cachedPath;
+}
+
+
+QVariantList TrailModel::tail() const {
+    if (trail.pointCount() < 2) {
+        return QVariantList();
+    }
+    // Henüz path'e yayınlanmamış köşeler de eklenir; parça son yayınlanan köşeden başlar
+    std::vector<GeoPoint> points;
+    trail.appendVertices(activeLevel, cachedVertices > 0 ? cachedVertices - 1 : 0, points);
+    points.push_back(trail.lastPoint());
+
+    QVariantList coordinates;
+    coordinates.reserve(static_cast<int>(points.size()));
+    for (const GeoPoint &point : points) {
+        coordinates.append(toVariant(point));
+    }
+    return coordinates;
+}
+
+
+double TrailModel::zoomLevel() const {
+    return zoom;
+}
+
+
+void TrailModel::setZoomLevel(double zoomLevel) {
+    if (qFuzzyCompare(zoom, zoomLevel)) {
+        return;
+    }
+    zoom = zoomLevel;
+    emit zoomLevelChanged();
+    setLevel(selectLevel());
+}
+
+
+int TrailModel::pointCount() const {
+    return static_cast<int>(trail.pointCount());
+}
+
+
+int TrailModel::level() const {
+    return activeLevel;
+}
+
+
+const TrailDecimator &TrailModel::decimator() const {
+    return trail;
+}
+
+
+int TrailModel::selectLevel() const {
+    const double latitude = trail.pointCount() > 0 ? trail.lastPoint().latitudeDeg : 0.0;
+    const double metersPerPixel = EquatorMetersPerPixel * std::cos(GeoMath::toRadians(latitude)) / std::pow(2.0, zoom);
+    return trail.levelFor(metersPerPixel, MaxPathVertices);
+}
+
+
+void TrailModel::setLevel(int newLevel) {
+    if (newLevel == activeLevel) {
+        return;
+    }
+    activeLevel = newLevel;
+    cachedPath.clear();
+    cachedVertices = 0;
+    refreshTimer.stop();
+    refreshPath();
+    emit tailChanged();
+}
+
+
+void TrailModel::refreshPath() {
+    std::vector<GeoPoint> added;
+    trail.appendVertices(activeLevel, cachedVertices, added);
+    if (added.empty()) {
+        return;
+    }
+    cachedPath.reserve(cachedPath.size() + static_cast<int>(added.size()));
+    for (const GeoPoint &point : added) {
+        cachedPath.append(toVariant(point));
+    }
+    cachedVertices += added.size();
+    emit pathChanged();
+}
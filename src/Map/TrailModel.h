@@ -0,0 +1,56 @@
+#ifndef TRAILMODEL_H
+#define TRAILMODEL_H
+
+#include "src/Map/TrailDecimator.h"
+#include <QObject>
+#include <QTimer>
+#include <QVariantList>
+
+// Haritadaki araç izi (QML'de "trailModel"). Tam iz C++'ta tutulur; haritaya sadece
+// o anki yakınlaştırmada bir pikselden büyük sapmaları taşıyan köşeler verilir.
+// path kesinleşmiş köşelerdir ve en fazla RefreshIntervalMs'de bir değişir;
+// tail son köşeden aracın anlık konumuna kadar olan tek parçadır ve her konumda güncellenir.
+class TrailModel : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(QVariantList path READ path NOTIFY pathChanged)
+    Q_PROPERTY(QVariantList tail READ tail NOTIFY tailChanged)
+    Q_PROPERTY(double zoomLevel READ zoomLevel WRITE setZoomLevel NOTIFY zoomLevelChanged)
+    Q_PROPERTY(int pointCount READ pointCount NOTIFY tailChanged)
+
+public:
+    // Çok uzun izlerde daha kaba seviyeye geçilir ki harita çizimi sınırlı kalsın
+    static constexpr std::size_t MaxPathVertices = 20000;
+    static constexpr int RefreshIntervalMs = 250;
+
+    explicit TrailModel(QObject *parent = nullptr);
+
+    void append(double latitudeDeg, double longitudeDeg);
+    Q_INVOKABLE void clear();
+
+    QVariantList path() const;
+    QVariantList tail() const;
+    double zoomLevel() const;
+    void setZoomLevel(double zoomLevel);
+    int pointCount() const;
+    int level() const;
+    const TrailDecimator &decimator() const;
+
+signals:
+    void pathChanged();
+    void tailChanged();
+    void zoomLevelChanged();
+
+private:
+    int selectLevel() const;
+    void setLevel(int newLevel);
+    void refreshPath();
+
+    TrailDecimator trail;
+    double zoom = 18.0;
+    int activeLevel = 0;
+    QVariantList cachedPath;
+    std::size_t cachedVertices = 0;  // cachedPath'e eklenmiş köşe sayısı
+    QTimer refreshTimer;
+};
+
+#endif // TRAILMODEL_H
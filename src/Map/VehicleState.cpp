@@ -0,0 +1,76 @@
+#include "VehicleState.h"
+#include "src/Utils/GeoMath.h"
+#include <cmath>
+
+VehicleState::VehicleState(QObject *parent)
+    : QObject(parent) {
+    frameTimer.setSingleShot(true);
+    frameTimer.setInterval(FrameIntervalMs);
+    connect(&frameTimer, &QTimer::timeout, this, &VehicleState::publish);
+}
+
+
+void VehicleState::update(double latitudeDeg, double longitudeDeg, double headingDeg) {
+    // Bir kare içindeki güncellemelerden sadece sonuncusu yayınlanır
+    pendingLatitude = latitudeDeg;
+    pendingLongitude = longitudeDeg;
+    pendingHeading = headingDeg;
+    if (!frameTimer.isActive()) {
+        frameTimer.start();
+    }
+}
+
+
+void VehicleState::reset() {
+    frameTimer.stop();
+    pendingLatitude = pendingLongitude = pendingHeading = qQNaN();
+    if (publishedCoordinate.isValid()) {
+        publishedCoordinate = QGeoCoordinate();
+        emit coordinateChanged();
+    }
+}
+
+
+QGeoCoordinate VehicleState::coordinate() const {
+    return publishedCoordinate;
+}
+
+
+double VehicleState::heading() const {
+    return publishedHeading;
+}
+
+
+bool VehicleState::followVehicle() const {
+    return follow;
+}
+
+
+void VehicleState::setFollowVehicle(bool followVehicle) {
+    if (follow == followVehicle) {
+        return;
+    }
+    follow = followVehicle;
+    emit followVehicleChanged();
+}
+
+
+void VehicleState::publish() {
+    const bool hasFix = std::isfinite(pendingLatitude) && std::isfinite(pendingLongitude) &&
+                        !(pendingLatitude == 0.0 && pendingLongitude == 0.0);
+    if (hasFix && (!publishedCoordinate.isValid() ||
+                   GeoMath::distanceM(publishedCoordinate.latitude(), publishedCoordinate.longitude(),
+                                      pendingLatitude, pendingLongitude) >= PositionThresholdM)) {
+        publishedCoordinate = QGeoCoordinate(pendingLatitude, pendingLongitude);
+        emit coordinateChanged();
+    }
+
+    if (std::isfinite(pendingHeading)) {
+        // 359.9 -> 0.1 geçişi 0.2 derecelik değişimdir
+        const double delta = std::remainder(pendingHeading - publishedHeading, 360.0);
+        if (std::abs(delta) >= HeadingThresholdDeg) {
+            publishedHeading = pendingHeading;
+            emit headingChanged();
+        }
+    }
+}
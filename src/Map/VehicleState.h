@@ -0,0 +1,51 @@
+#ifndef VEHICLESTATE_H
+#define VEHICLESTATE_H
+
+#include <QGeoCoordinate>
+#include <QObject>
+#include <QTimer>
+
+// Haritanın gösterdiği aracın konumu ve yönü (QML'de "vehicleState").
+// Telemetri istediği sıklıkta update() çağırır; değerler bir kare süresi içinde birleştirilir
+// ve sadece eşikten büyük değişiklikler yayınlanır, böylece GPS titremesi harita yerleşimini
+// yeniden tetiklemez. QML tarafı özelliklere bağlanır, JavaScript çağrısı yoktur.
+class VehicleState : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(QGeoCoordinate coordinate READ coordinate NOTIFY coordinateChanged)
+    Q_PROPERTY(double heading READ heading NOTIFY headingChanged)
+    Q_PROPERTY(bool followVehicle READ followVehicle WRITE setFollowVehicle NOTIFY followVehicleChanged)
+
+public:
+    static constexpr int FrameIntervalMs = 16;
+    static constexpr double PositionThresholdM = 0.01;
+    static constexpr double HeadingThresholdDeg = 0.1;
+
+    explicit VehicleState(QObject *parent = nullptr);
+
+    void update(double latitudeDeg, double longitudeDeg, double headingDeg);
+    // Araç değişince eski konum gösterilmez
+    void reset();
+
+    QGeoCoordinate coordinate() const;
+    double heading() const;
+    bool followVehicle() const;
+    void setFollowVehicle(bool follow);
+
+signals:
+    void coordinateChanged();
+    void headingChanged();
+    void followVehicleChanged();
+
+private:
+    void publish();
+
+    QGeoCoordinate publishedCoordinate;
+    double publishedHeading = 0.0;
+    double pendingLatitude = qQNaN();
+    double pendingLongitude = qQNaN();
+    double pendingHeading = qQNaN();
+    bool follow = true;
+    QTimer frameTimer;
+};
+
+#endif // VEHICLESTATE_H
@@ -0,0 +1,220 @@
+#include "MissionModel.h"
+#include <QGeoCoordinate>
+#include <cmath>
+
+namespace {
+// MAVLink sabitleri (common.xml)
+constexpr std::uint32_t MavCmdNavWaypoint = 16;
+constexpr std::uint32_t MavCmdDoChangeSpeed = 178;
+constexpr std::uint32_t MavCmdDoSetCamTriggDist = 206;
+constexpr std::uint32_t MavFrameGlobal = 0;
+constexpr std::uint32_t MavFrameMission = 2;
+constexpr std::uint32_t MavFrameGlobalRelativeAltInt = 6;
+constexpr std::uint32_t MavMissionTypeMission = 0;
+
+std::int32_t toE7(double degrees) {
+    return static_cast<std::int32_t>(std::lround(degrees * 1e7));
+}
+}
+
+MissionModel::MissionModel(QObject *parent)
+    : QAbstractListModel(parent) {}
+
+int MissionModel::rowCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : count();
+}
+
+QVariant MissionModel::data(const QModelIndex &index, int role) const {
+    if (!index.isValid() || index.row() < 0 || index.row() >= count()) {
+        return QVariant();
+    }
+    const MissionWaypoint &waypoint = items[static_cast<std::size_t>(index.row())];
+    switch (role) {
+    case LatitudeRole: return waypoint.latitudeDeg;
+    case LongitudeRole: return waypoint.longitudeDeg;
+    case AltitudeRole: return waypoint.relativeAltitudeM;
+    case SpeedRole: return waypoint.speedMS;
+    case SequenceRole: return index.row() + 1;
+    default: return QVariant();
+    }
+}
+
+QHash<int, QByteArray> MissionModel::roleNames() const {
+    return {
+        {LatitudeRole, "latitude"},
+        {LongitudeRole, "longitude"},
+        {AltitudeRole, "altitude"},
+        {SpeedRole, "speed"},
+        {SequenceRole, "sequence"},
+    };
+}
+
+int MissionModel::count() const {
+    return static_cast<int>(items.size());
+}
+
+const std::vector<MissionWaypoint> &MissionModel::waypoints() const {
+    return items;
+}
+
+QVariantList MissionModel::path() const {
+    QVariantList coordinates;
+    coordinates.reserve(count());
+    for (const MissionWaypoint &waypoint : items) {
+        coordinates.append(QVariant::fromValue(QGeoCoordinate(waypoint.latitudeDeg, waypoint.longitudeDeg)));
+    }
+    return coordinates;
+}
+
+void MissionModel::appendWaypoint(double latitude, double longitude, double altitude, double speed) {
+    insertWaypoint(count(), latitude, longitude, altitude, speed);
+}
+
+void MissionModel::insertWaypoint(int index, double latitude, double longitude, double altitude, double speed) {
+    if (index < 0 || index > count() || std::isnan(latitude) || std::isnan(longitude)) {
+        return;
+    }
+    MissionWaypoint waypoint;
+    waypoint.latitudeDeg = latitude;
+    waypoint.longitudeDeg = longitude;
+    waypoint.relativeAltitudeM = static_cast<float>(altitude);
+    waypoint.speedMS = static_cast<float>(speed);
+
+    beginInsertRows(QModelIndex(), index, index);
+    items.insert(items.begin() + index, waypoint);
+    endInsertRows();
+    notifyEdited(true);
+}
+
+void MissionModel::moveWaypoint(int index, double latitude, double longitude) {
+    if (index < 0 || index >= count()) {
+        return;
+    }
+    MissionWaypoint &waypoint = items[static_cast<std::size_t>(index)];
+    waypoint.latitudeDeg = latitude;
+    waypoint.longitudeDeg = longitude;
+    const QModelIndex changed = this->index(index);
+    emit dataChanged(changed, changed, {LatitudeRole, LongitudeRole});
+    notifyEdited(false);
+}
+
+void MissionModel::setWaypointAltitude(int index, double altitude) {
+    if (index < 0 || index >= count()) {
+        return;
+    }
+    items[static_cast<std::size_t>(index)].relativeAltitudeM = static_cast<float>(altitude);
+    const QModelIndex changed = this->index(index);
+    emit dataChanged(changed, changed, {AltitudeRole});
+    emit missionEdited();
+}
+
+void MissionModel::removeWaypoint(int index) {
+    if (index < 0 || index >= count()) {
+        return;
+    }
+    beginRemoveRows(QModelIndex(), index, index);
+    items.erase(items.begin() + index);
+    endRemoveRows();
+    notifyEdited(true);
+}
+
+void MissionModel::clear() {
+    if (items.empty()) {
+        return;
+    }
+    beginResetModel();
+    items.clear();
+    cameraTriggerDistanceM = 0.0;
+    endResetModel();
+    notifyEdited(true);
+}
+
+void MissionModel::setWaypoints(std::vector<MissionWaypoint> newWaypoints) {
+    beginResetModel();
+    items = std::move(newWaypoints);
+    endResetModel();
+    notifyEdited(true);
+}
+
+void MissionModel::setCameraTriggerDistance(double distanceM) {
+    cameraTriggerDistanceM = distanceM > 0.0 ? distanceM : 0.0;
+}
+
+double MissionModel::cameraTriggerDistance() const {
+    return cameraTriggerDistanceM;
+}
+
+void MissionModel::notifyEdited(bool countChanged) {
+    if (countChanged) {
+        emit this->countChanged();
+    }
+    emit pathChanged();
+    emit missionEdited();
+}
+
+std::vector<mavsdk::MissionRaw::MissionItem> MissionModel::toMissionItems(const std::vector<MissionWaypoint> &waypoints,
+                                                                          const ItemOptions &options) {
+    std::vector<mavsdk::MissionRaw::MissionItem> result;
+    result.reserve(waypoints.size() + 2);
+
+    auto append = [&result](mavsdk::MissionRaw::MissionItem item) {
+        item.seq = static_cast<std::uint32_t>(result.size());
+        item.current = result.empty() ? 1 : 0;
+        item.autocontinue = 1;
+        item.mission_type = MavMissionTypeMission;
+        result.push_back(item);
+    };
+
+    if (options.homePlaceholder) {
+        mavsdk::MissionRaw::MissionItem home;
+        home.frame = MavFrameGlobal;
+        home.command = MavCmdNavWaypoint;
+        home.x = toE7(options.homeLatitudeDeg);
+        home.y = toE7(options.homeLongitudeDeg);
+        append(home);
+    }
+
+    auto appendTrigger = [&append](double distanceM) {
+        mavsdk::MissionRaw::MissionItem trigger;
+        trigger.frame = MavFrameMission;
+        trigger.command = MavCmdDoSetCamTriggDist;
+        trigger.param1 = static_cast<float>(distanceM);
+        trigger.param3 = distanceM > 0.0 ? 1.0f : 0.0f;  // Başlarken hemen bir kare
+        append(trigger);
+    };
+
+    float currentSpeed = 0.0f;
+    bool triggering = false;
+    for (const MissionWaypoint &waypoint : waypoints) {
+        if (waypoint.speedMS > 0.0f && waypoint.speedMS != currentSpeed) {
+            mavsdk::MissionRaw::MissionItem speed;
+            speed.frame = MavFrameMission;
+            speed.command = MavCmdDoChangeSpeed;
+            speed.param1 = 1.0f;  // Yer hızı
+            speed.param2 = waypoint.speedMS;
+            speed.param3 = -1.0f;  // Gaz değişmez
+            append(speed);
+            currentSpeed = waypoint.speedMS;
+        }
+
+        mavsdk::MissionRaw::MissionItem item;
+        item.frame = MavFrameGlobalRelativeAltInt;
+        item.command = MavCmdNavWaypoint;
+        item.param1 = waypoint.holdTimeS;
+        item.param2 = waypoint.acceptanceRadiusM;
+        item.param4 = waypoint.yawDeg;
+        item.x = toE7(waypoint.latitudeDeg);
+        item.y = toE7(waypoint.longitudeDeg);
+        item.z = waypoint.relativeAltitudeM;
+        append(item);
+
+        if (!triggering && options.cameraTriggerDistanceM > 0.0) {
+            appendTrigger(options.cameraTriggerDistanceM);
+            triggering = true;
+        }
+    }
+    if (triggering) {
+        appendTrigger(0.0);
+    }
+    return result;
+}
@@ -0,0 +1,84 @@
+#ifndef MISSIONMODEL_H
+#define MISSIONMODEL_H
+
+#include <QAbstractListModel>
+#include <QVariantList>
+#include <limits>
+#include <vector>
+#include <mavsdk/plugins/mission_raw/mission_raw.h>
+
+// Görev noktası; irtifa kalkış noktasına göredir
+struct MissionWaypoint {
+    double latitudeDeg = 0.0;
+    double longitudeDeg = 0.0;
+    float relativeAltitudeM = 0.0f;
+    float speedMS = 0.0f;  // 0: hız değiştirilmez
+    float acceptanceRadiusM = 1.0f;
+    float holdTimeS = 0.0f;
+    float yawDeg = std::numeric_limits<float>::quiet_NaN();  // NaN: otopilot seçer
+};
+
+// Haritadan tıklamalarla oluşturulan ve düzenlenen sıralı görev noktaları (QML'de "missionModel").
+// MAVLink'e dönüşüm kararlı bir yapı üretir: nokta taşıma/irtifa değişikliği sadece o noktanın
+// öğesini değiştirir, böylece MissionUploader değişen öğeleri kısmi olarak yükleyebilir.
+class MissionModel : public QAbstractListModel {
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(QVariantList path READ path NOTIFY pathChanged)
+
+public:
+    enum Role {
+        LatitudeRole = Qt::UserRole + 1,
+        LongitudeRole,
+        AltitudeRole,
+        SpeedRole,
+        SequenceRole
+    };
+
+    struct ItemOptions {
+        // ArduPilot görevde 0. öğeyi ev konumu olarak ayırır
+        bool homePlaceholder = false;
+        double homeLatitudeDeg = 0.0;
+        double homeLongitudeDeg = 0.0;
+        // 0'dan büyükse ilk noktadan sonra mesafeye göre fotoğraf tetiklenir, son noktada durdurulur
+        double cameraTriggerDistanceM = 0.0;
+    };
+
+    explicit MissionModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    int count() const;
+    const std::vector<MissionWaypoint> &waypoints() const;
+    QVariantList path() const;
+
+    Q_INVOKABLE void appendWaypoint(double latitude, double longitude, double altitude, double speed);
+    Q_INVOKABLE void insertWaypoint(int index, double latitude, double longitude, double altitude, double speed);
+    Q_INVOKABLE void moveWaypoint(int index, double latitude, double longitude);
+    Q_INVOKABLE void setWaypointAltitude(int index, double altitude);
+    Q_INVOKABLE void removeWaypoint(int index);
+    Q_INVOKABLE void clear();
+    void setWaypoints(std::vector<MissionWaypoint> newWaypoints);
+    // Tarama görevlerinin kamera tetikleme mesafesi; clear() ile sıfırlanır
+    void setCameraTriggerDistance(double distanceM);
+    double cameraTriggerDistance() const;
+
+    // Hız sadece değiştiği noktada DO_CHANGE_SPEED öğesiyle eklenir
+    static std::vector<mavsdk::MissionRaw::MissionItem> toMissionItems(const std::vector<MissionWaypoint> &waypoints,
+                                                                       const ItemOptions &options);
+
+signals:
+    void countChanged();
+    void pathChanged();
+    void missionEdited();
+
+private:
+    void notifyEdited(bool countChanged);
+
+    std::vector<MissionWaypoint> items;
+    double cameraTriggerDistanceM = 0.0;
+};
+
+#endif // MISSIONMODEL_H
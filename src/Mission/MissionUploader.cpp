@@ -0,0 +1,415 @@
+#include "MissionUploader.h"
+#include "src/Utils/Logger.h"
+#include <QPointer>
+#include <cstring>
+#include <sstream>
+
+using namespace mavsdk;
+
+namespace {
+QString missionResultToString(MissionRaw::Result result) {
+    std::ostringstream stream;
+    stream << result;
+    return QString::fromStdString(stream.str());
+}
+
+bool sameFloat(float a, float b) {
+    // NaN alanlar (ör. yaw) de eşit sayılsın diye bit düzeyinde karşılaştırılır
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+}
+
+MissionUploader::MissionUploader(QObject *parent)
+    : QObject(parent),
+    stepTimer(new QTimer(this)) {
+    stepTimer->setSingleShot(true);
+    connect(stepTimer, &QTimer::timeout, this, &MissionUploader::onStepTimeout);
+}
+
+MissionUploader::~MissionUploader() {
+    unsubscribePartialMessages();
+    unsubscribeMissionChanged();
+}
+
+void MissionUploader::setPlugins(std::shared_ptr<MissionRaw> newMissionRaw,
+                                 std::shared_ptr<MavlinkPassthrough> newPassthrough,
+                                 bool supportsPartialUpload) {
+    if (busy) {
+        // Yarım kalan yüklemeden sonra araçtaki görev bilinmez
+        finish(false, "Vehicle link changed during upload");
+    }
+    // Bağlantı kopmuşken görev başka bir yerden değişmiş olabilir: kopyaya güvenilmez
+    invalidate();
+    unsubscribePartialMessages();
+    unsubscribeMissionChanged();
+    missionRaw = std::move(newMissionRaw);
+    passthrough = std::move(newPassthrough);
+    partialSupported = supportsPartialUpload;
+    subscribeMissionChanged();
+}
+
+bool MissionUploader::upload(Items items) {
+    if (busy) {
+        Logger::instance().log("Mission upload already in progress.", WARNING);
+        return false;
+    }
+    if (!missionRaw) {
+        Logger::instance().log("MissionRaw plugin not initialized.", ERROR);
+        return false;
+    }
+
+    busy = true;
+    invalidatedDuringUpload = false;
+    ++uploadGeneration;
+    pendingItems = std::move(items);
+    report = Report();
+    report.totalItems = static_cast<int>(pendingItems.size());
+    clock.start();
+
+    if (!vehicleItemsValid) {
+        startFull("no copy of the vehicle mission");
+        return true;
+    }
+    if (!partialSupported || !passthrough) {
+        startFull("autopilot does not support partial upload");
+        return true;
+    }
+    if (vehicleItems.size() != pendingItems.size()) {
+        startFull("item count changed");
+        return true;
+    }
+
+    ranges = changedRanges(vehicleItems, pendingItems, RangeMergeGap);
+    if (ranges.empty()) {
+        report.method = Method::Unchanged;
+        emit uploadStarted(report.totalItems, report.method);
+        finish(true);
+        return true;
+    }
+
+    report.method = Method::Partial;
+    report.ranges = static_cast<int>(ranges.size());
+    rangeIndex = 0;
+    subscribePartialMessages();
+    emit uploadStarted(report.totalItems, report.method);
+    startNextRange();
+    return true;
+}
+
+void MissionUploader::startFull(const QString &reason) {
+    report.method = Method::Full;
+    // Kısmi denemeden geri dönüldüyse rapor sadece tam yüklemeyi anlatır
+    report.sentItems = report.totalItems;
+    report.retransmittedItems = 0;
+    report.ranges = 0;
+    Logger::instance().log("Full mission upload (" + QString::number(report.totalItems) + " items): " + reason, INFO);
+    emit uploadStarted(report.totalItems, report.method);
+
+    QPointer<MissionUploader> self(this);
+    const quint64 generation = uploadGeneration;
+    missionRaw->upload_mission_async(pendingItems, [self, generation](MissionRaw::Result result) {
+        if (!self) {
+            return;
+        }
+        QMetaObject::invokeMethod(self, [self, generation, result]() {
+            if (!self || self->uploadGeneration != generation || !self->busy) {
+                return;
+            }
+            if (result == MissionRaw::Result::Success) {
+                self->finish(true);
+            } else {
+                self->finish(false, missionResultToString(result));
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+void MissionUploader::startNextRange() {
+    if (rangeIndex >= ranges.size()) {
+        finish(true);
+        return;
+    }
+    lastSentSeq = -1;
+    retries = 0;
+    sentInRange.assign(pendingItems.size(), false);
+    sendPartialList();
+}
+
+void MissionUploader::sendPartialList() {
+    const std::pair<int, int> range = ranges[rangeIndex];
+    const std::uint8_t targetSystem = passthrough->get_target_sysid();
+    const std::uint8_t targetComponent = passthrough->get_target_compid();
+    passthrough->queue_message([range, targetSystem, targetComponent](MavlinkAddress address, std::uint8_t channel) {
+        mavlink_message_t message;
+        mavlink_msg_mission_write_partial_list_pack_chan(address.system_id, address.component_id, channel, &message,
+                                                         targetSystem, targetComponent,
+                                                         static_cast<std::int16_t>(range.first),
+                                                         static_cast<std::int16_t>(range.second),
+                                                         MAV_MISSION_TYPE_MISSION);
+        return message;
+    });
+    stepTimer->start(ItemTimeoutMs);
+}
+
+void MissionUploader::sendItem(int seq) {
+    const MissionRaw::MissionItem item = pendingItems[static_cast<std::size_t>(seq)];
+    const std::uint8_t targetSystem = passthrough->get_target_sysid();
+    const std::uint8_t targetComponent = passthrough->get_target_compid();
+    passthrough->queue_message([item, targetSystem, targetComponent](MavlinkAddress address, std::uint8_t channel) {
+        mavlink_message_t message;
+        mavlink_msg_mission_item_int_pack_chan(address.system_id, address.component_id, channel, &message,
+                                               targetSystem, targetComponent,
+                                               static_cast<std::uint16_t>(item.seq),
+                                               static_cast<std::uint8_t>(item.frame),
+                                               static_cast<std::uint16_t>(item.command),
+                                               static_cast<std::uint8_t>(item.current),
+                                               static_cast<std::uint8_t>(item.autocontinue),
+                                               item.param1, item.param2, item.param3, item.param4,
+                                               item.x, item.y, item.z,
+                                               static_cast<std::uint8_t>(item.mission_type));
+        return message;
+    });
+    if (sentInRange[static_cast<std::size_t>(seq)]) {
+        ++report.retransmittedItems;
+    } else {
+        sentInRange[static_cast<std::size_t>(seq)] = true;
+        ++report.sentItems;
+    }
+    stepTimer->start(ItemTimeoutMs);
+}
+
+void MissionUploader::onItemRequested(int seq) {
+    if (!busy || report.method != Method::Partial || rangeIndex >= ranges.size()) {
+        return;
+    }
+    const std::pair<int, int> range = ranges[rangeIndex];
+    if (seq < range.first || seq > range.second) {
+        LOG_STRUCTURED(WARNING, "Ignoring mission item request %1 outside partial range", seq);
+        return;
+    }
+    lastSentSeq = seq;
+    retries = 0;
+    sendItem(seq);
+}
+
+void MissionUploader::onAck(int result) {
+    if (!busy || report.method != Method::Partial) {
+        return;
+    }
+    stepTimer->stop();
+    if (result != MAV_MISSION_ACCEPTED) {
+        unsubscribePartialMessages();
+        startFull("partial upload rejected (MAV_MISSION_RESULT " + QString::number(result) + ")");
+        return;
+    }
+    ++rangeIndex;
+    startNextRange();
+}
+
+void MissionUploader::onStepTimeout() {
+    if (!busy || report.method != Method::Partial) {
+        return;
+    }
+    if (++retries > MaxRetries) {
+        unsubscribePartialMessages();
+        startFull("partial upload timed out");
+        return;
+    }
+    if (lastSentSeq < 0) {
+        sendPartialList();
+    } else {
+        sendItem(lastSentSeq);
+    }
+}
+
+void MissionUploader::onMissionChanged() {
+    // Kendi yüklememizin ACK'i: yükleme sürerken veya bittikten hemen sonra gelir
+    if (busy || (lastUploadFinished.isValid() && lastUploadFinished.elapsed() < OwnAckGraceMs)) {
+        return;
+    }
+    if (vehicleItemsValid) {
+        Logger::instance().log("Vehicle mission changed outside this uploader; next upload will be full.", INFO);
+    }
+    invalidate();
+}
+
+void MissionUploader::subscribeMissionChanged() {
+    if (missionChangedSubscribed || !missionRaw) {
+        return;
+    }
+    missionChangedSubscribed = true;
+
+    // MAVSDK thread'inden gelir
+    QPointer<MissionUploader> self(this);
+    missionChangedHandle = missionRaw->subscribe_mission_changed([self](bool) {
+        if (!self) {
+            return;
+        }
+        QMetaObject::invokeMethod(self, [self]() {
+            if (self) {
+                self->onMissionChanged();
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+void MissionUploader::unsubscribeMissionChanged() {
+    if (!missionChangedSubscribed) {
+        return;
+    }
+    missionChangedSubscribed = false;
+    if (missionRaw) {
+        missionRaw->unsubscribe_mission_changed(missionChangedHandle);
+    }
+}
+
+void MissionUploader::subscribePartialMessages() {
+    if (partialSubscribed || !passthrough) {
+        return;
+    }
+    partialSubscribed = true;
+
+    // MAVSDK thread'inden gelir; sadece bize ait görev mesajları GUI thread'ine taşınır
+    QPointer<MissionUploader> self(this);
+    const quint64 generation = uploadGeneration;
+    const std::uint8_t ourSystem = passthrough->get_our_sysid();
+    auto deliverRequest = [self, generation](int seq) {
+        QMetaObject::invokeMethod(self, [self, generation, seq]() {
+            if (self && self->uploadGeneration == generation) {
+                self->onItemRequested(seq);
+            }
+        }, Qt::QueuedConnection);
+    };
+
+    requestIntHandle = passthrough->subscribe_message(MAVLINK_MSG_ID_MISSION_REQUEST_INT,
+                                                      [self, ourSystem, deliverRequest](const mavlink_message_t &message) {
+        mavlink_mission_request_int_t request;
+        mavlink_msg_mission_request_int_decode(&message, &request);
+        if (self && request.target_system == ourSystem && request.mission_type == MAV_MISSION_TYPE_MISSION) {
+            deliverRequest(request.seq);
+        }
+    });
+    requestHandle = passthrough->subscribe_message(MAVLINK_MSG_ID_MISSION_REQUEST,
+                                                   [self, ourSystem, deliverRequest](const mavlink_message_t &message) {
+        mavlink_mission_request_t request;
+        mavlink_msg_mission_request_decode(&message, &request);
+        if (self && request.target_system == ourSystem && request.mission_type == MAV_MISSION_TYPE_MISSION) {
+            deliverRequest(request.seq);
+        }
+    });
+    ackHandle = passthrough->subscribe_message(MAVLINK_MSG_ID_MISSION_ACK,
+                                               [self, generation, ourSystem](const mavlink_message_t &message) {
+        mavlink_mission_ack_t ack;
+        mavlink_msg_mission_ack_decode(&message, &ack);
+        if (!self || ack.target_system != ourSystem || ack.mission_type != MAV_MISSION_TYPE_MISSION) {
+            return;
+        }
+        const int result = ack.type;
+        QMetaObject::invokeMethod(self, [self, generation, result]() {
+            if (self && self->uploadGeneration == generation) {
+                self->onAck(result);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+void MissionUploader::unsubscribePartialMessages() {
+    if (!partialSubscribed) {
+        return;
+    }
+    partialSubscribed = false;
+    if (passthrough) {
+        passthrough->unsubscribe_message(MAVLINK_MSG_ID_MISSION_REQUEST_INT, requestIntHandle);
+        passthrough->unsubscribe_message(MAVLINK_MSG_ID_MISSION_REQUEST, requestHandle);
+        passthrough->unsubscribe_message(MAVLINK_MSG_ID_MISSION_ACK, ackHandle);
+    }
+}
+
+void MissionUploader::finish(bool success, const QString &error) {
+    stepTimer->stop();
+    unsubscribePartialMessages();
+    busy = false;
+    ++uploadGeneration;
+    lastUploadFinished.start();
+
+    report.success = success;
+    report.error = error;
+    report.elapsedMs = clock.elapsed();
+    if (success && !invalidatedDuringUpload) {
+        vehicleItems = std::move(pendingItems);
+        vehicleItemsValid = true;
+        if (report.method == Method::Full) {
+            lastFullMs = report.elapsedMs;
+        }
+    } else {
+        vehicleItemsValid = false;
+        vehicleItems.clear();
+    }
+    invalidatedDuringUpload = false;
+    pendingItems.clear();
+    sentInRange.clear();
+
+    Logger::instance().log(QString("Mission upload %1 (%2): %3/%4 items sent (%5 retransmitted) in %6 ms%7")
+                               .arg(success ? "succeeded" : "failed")
+                               .arg(methodToString(report.method))
+                               .arg(report.sentItems)
+                               .arg(report.totalItems)
+                               .arg(report.retransmittedItems)
+                               .arg(report.elapsedMs)
+                               .arg(error.isEmpty() ? QString() : ", " + error),
+                           success ? INFO : ERROR);
+    emit uploadFinished(report);
+}
+
+void MissionUploader::invalidate() {
+    invalidatedDuringUpload = busy;
+    vehicleItemsValid = false;
+    vehicleItems.clear();
+}
+
+bool MissionUploader::isBusy() const {
+    return busy;
+}
+
+bool MissionUploader::hasVehicleMission() const {
+    return vehicleItemsValid;
+}
+
+qint64 MissionUploader::lastFullUploadMs() const {
+    return lastFullMs;
+}
+
+bool MissionUploader::sameItem(const MissionRaw::MissionItem &a, const MissionRaw::MissionItem &b) {
+    return a.seq == b.seq && a.frame == b.frame && a.command == b.command && a.current == b.current &&
+           a.autocontinue == b.autocontinue && sameFloat(a.param1, b.param1) && sameFloat(a.param2, b.param2) &&
+           sameFloat(a.param3, b.param3) && sameFloat(a.param4, b.param4) && a.x == b.x && a.y == b.y &&
+           sameFloat(a.z, b.z) && a.mission_type == b.mission_type;
+}
+
+std::vector<std::pair<int, int>> MissionUploader::changedRanges(const Items &before, const Items &after, int mergeGap) {
+    std::vector<std::pair<int, int>> result;
+    if (before.size() != after.size()) {
+        return result;
+    }
+    for (std::size_t i = 0; i < after.size(); ++i) {
+        if (sameItem(before[i], after[i])) {
+            continue;
+        }
+        const int seq = static_cast<int>(i);
+        if (!result.empty() && seq - result.back().second - 1 < mergeGap) {
+            result.back().second = seq;
+        } else {
+            result.emplace_back(seq, seq);
+        }
+    }
+    return result;
+}
+
+QString MissionUploader::methodToString(Method method) {
+    switch (method) {
+    case Method::Full: return "full";
+    case Method::Partial: return "partial";
+    case Method::Unchanged: return "unchanged";
+    }
+    return "unknown";
+}
@@ -0,0 +1,118 @@
+#ifndef MISSIONUPLOADER_H
+#define MISSIONUPLOADER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
+#include <mavsdk/plugins/mission_raw/mission_raw.h>
+
+// Bir aracın görevini MissionRaw ile yükler ve araçtaki son başarılı görevin kopyasını tutar.
+// Öğe sayısı değişmediyse ve otopilot MISSION_WRITE_PARTIAL_LIST destekliyorsa (ArduPilot)
+// sadece değişen aralıklar gönderilir; diğer durumlarda, veya kısmi yükleme başarısız olursa,
+// tam yükleme yapılır. 57600 baud radyoda 500+ öğelik görevde fark dakikalar mertebesindedir.
+// Kopya sadece bu oturumda yüklenen ve o zamandan beri değişmeyen görev için geçerlidir: plugin
+// değişimi (link/yeniden bağlantı), bağlantı kopması ve araçtaki görevin başka bir yoldan
+// değişmesi (mission_changed) kopyayı geçersiz kılar, sonraki yükleme tam yapılır.
+// GUI thread'inde yaşar; MAVLink cevapları MAVSDK thread'inden GUI thread'ine taşınır.
+class MissionUploader : public QObject {
+    Q_OBJECT
+
+public:
+    using Items = std::vector<mavsdk::MissionRaw::MissionItem>;
+    enum class Method { Full, Partial, Unchanged };
+
+    struct Report {
+        bool success = false;
+        Method method = Method::Full;
+        int totalItems = 0;
+        int sentItems = 0;           // Farklı öğe sayısı (kısmi yüklemede aralık başına bir kez)
+        int retransmittedItems = 0;  // Zaman aşımı veya tekrar istek nedeniyle yeniden gönderilen
+        int ranges = 0;
+        qint64 elapsedMs = 0;
+        QString error;
+    };
+
+    static constexpr int ItemTimeoutMs = 1500;
+    static constexpr int MaxRetries = 3;
+    // Aradaki değişmemiş öğe sayısı bundan azsa aralıklar birleştirilir (el sıkışma tasarrufu)
+    static constexpr int RangeMergeGap = 4;
+    // Kendi yüklememizin ACK'i de mission_changed tetikler; yükleme bittikten sonra bu süre yok sayılır
+    static constexpr int OwnAckGraceMs = 2000;
+
+    explicit MissionUploader(QObject *parent = nullptr);
+    ~MissionUploader();
+
+    void setPlugins(std::shared_ptr<mavsdk::MissionRaw> missionRaw,
+                    std::shared_ptr<mavsdk::MavlinkPassthrough> passthrough,
+                    bool supportsPartialUpload);
+
+    // Yükleme sürüyorsa false döner; sonuç uploadFinished ile gelir
+    bool upload(Items items);
+    // Araçtaki görev başka bir yoldan değişti veya bilinmiyor; sonraki yükleme tam yapılır.
+    // Yükleme sürerken çağrılırsa biten yükleme de kopyayı geçerli saymaz.
+    void invalidate();
+    bool isBusy() const;
+    bool hasVehicleMission() const;
+    qint64 lastFullUploadMs() const;
+
+    // Aynı uzunluktaki iki görevde farklı öğelerin [başlangıç, bitiş] aralıkları
+    static std::vector<std::pair<int, int>> changedRanges(const Items &before, const Items &after, int mergeGap);
+    static bool sameItem(const mavsdk::MissionRaw::MissionItem &a, const mavsdk::MissionRaw::MissionItem &b);
+    static QString methodToString(Method method);
+
+signals:
+    void uploadStarted(int totalItems, MissionUploader::Method method);
+    void uploadFinished(const MissionUploader::Report &report);
+
+private:
+    void startFull(const QString &reason);
+    void startNextRange();
+    void sendPartialList();
+    void sendItem(int seq);
+    void onItemRequested(int seq);
+    void onAck(int result);
+    void onStepTimeout();
+    void onMissionChanged();
+    void subscribeMissionChanged();
+    void unsubscribeMissionChanged();
+    void subscribePartialMessages();
+    void unsubscribePartialMessages();
+    void finish(bool success, const QString &error = QString());
+
+    std::shared_ptr<mavsdk::MissionRaw> missionRaw;
+    std::shared_ptr<mavsdk::MavlinkPassthrough> passthrough;
+    bool partialSupported = false;
+
+    Items vehicleItems;  // Araçta olduğu bilinen görev
+    bool vehicleItemsValid = false;
+    bool invalidatedDuringUpload = false;
+    QElapsedTimer lastUploadFinished;
+    mavsdk::MissionRaw::MissionChangedHandle missionChangedHandle;
+    bool missionChangedSubscribed = false;
+
+    // Sürmekte olan yükleme
+    bool busy = false;
+    Items pendingItems;
+    Report report;
+    QElapsedTimer clock;
+    qint64 lastFullMs = 0;
+    quint64 uploadGeneration = 0;  // Eski yüklemeden gelen geç cevapları ayıklar
+
+    // Kısmi yükleme durumu
+    std::vector<std::pair<int, int>> ranges;
+    std::size_t rangeIndex = 0;
+    std::vector<bool> sentInRange;  // Bu aralıkta gönderilmiş seq'ler (öğe sayısı kadar)
+    int lastSentSeq = -1;  // -1: henüz öğe istenmedi, tekrar gönderimde liste mesajı yollanır
+    int retries = 0;
+    QTimer *stepTimer;
+    bool partialSubscribed = false;
+    mavsdk::MavlinkPassthrough::MessageHandle requestIntHandle;
+    mavsdk::MavlinkPassthrough::MessageHandle requestHandle;
+    mavsdk::MavlinkPassthrough::MessageHandle ackHandle;
+};
+
+#endif // MISSIONUPLOADER_H
@@ -0,0 +1,344 @@
+#include "SurveyGenerator.h"
+#include "src/Utils/GeoMath.h"
+#include "src/Utils/TaskExecutor.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace {
+
+// Yerel düzlemden hat eksenlerine dönüşüm: u hat boyunca, v hatlara dik
+struct SweepFrame {
+    GeoMath::LocalProjection projection;
+    double sinAngle = 0.0;
+    double cosAngle = 1.0;
+
+    void toSweep(double east, double north, double &u, double &v) const {
+        u = east * sinAngle + north * cosAngle;
+        v = -east * cosAngle + north * sinAngle;
+    }
+
+    void toGeo(double u, double v, double &lat, double &lon) const {
+        projection.toGeo(u * sinAngle - v * cosAngle, u * cosAngle + v * sinAngle, lat, lon);
+    }
+};
+
+// v0 <= v < v1 aralığındaki tarama hatlarını kesen kenar (yarı açık aralık köşelerin iki kez sayılmasını önler)
+struct Edge {
+    double v0;
+    double v1;
+    double u0;
+    double dudv;
+};
+
+struct LocalRing {
+    std::vector<double> east;
+    std::vector<double> north;
+};
+
+// Bir tarama geçişinin thread'ler arasında paylaşılan durumu; geç başlayan yardımcı görev
+// generate() döndükten sonra da erişebileceği için shared_ptr ile tutulur
+struct SweepJob {
+    SweepFrame frame;
+    std::vector<Edge> edges;  // v0'a göre sıralı
+    SurveyParameters parameters;
+    double photoSpacingM = 0.0;
+    double firstV = 0.0;
+    double spacing = 0.0;
+    int lineCount = 0;
+    int blockCount = 0;
+    CancellationToken token;
+
+    std::vector<std::vector<MissionWaypoint>> blocks;
+    std::atomic<int> nextBlock{0};
+    std::atomic<int> doneBlocks{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+
+    void runBlocks() {
+        for (int block = nextBlock.fetch_add(1); block < blockCount; block = nextBlock.fetch_add(1)) {
+            if (!token.isCancelled()) {
+                processBlock(block);
+            }
+            if (doneBlocks.fetch_add(1) + 1 == blockCount) {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.notify_all();
+            }
+        }
+    }
+
+    void waitAll() {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this]() { return doneBlocks.load() == blockCount; });
+    }
+
+    void processBlock(int block) {
+        const int first = block * SurveyGenerator::LinesPerBlock;
+        const int last = std::min(first + SurveyGenerator::LinesPerBlock, lineCount);
+        std::vector<MissionWaypoint> &output = blocks[static_cast<std::size_t>(block)];
+
+        std::vector<const Edge *> active;
+        std::vector<double> crossings;
+        std::size_t nextEdge = 0;
+
+        for (int line = first; line < last; ++line) {
+            const double v = firstV + line * spacing;
+
+            // Aktif kenar tablosu: hattın üstünde başlayanlar eklenir, altında bitenler çıkarılır
+            while (nextEdge < edges.size() && edges[nextEdge].v0 <= v) {
+                if (edges[nextEdge].v1 > v) {
+                    active.push_back(&edges[nextEdge]);
+                }
+                ++nextEdge;
+            }
+            active.erase(std::remove_if(active.begin(), active.end(), [v](const Edge *edge) { return edge->v1 <= v; }),
+                         active.end());
+
+            crossings.clear();
+            for (const Edge *edge : active) {
+                crossings.push_back(edge->u0 + (v - edge->v0) * edge->dudv);
+            }
+            std::sort(crossings.begin(), crossings.end());
+
+            // Çift hatlar ileri, tek hatlar geri uçulur (boustrophedon)
+            const bool forward = (line % 2) == 0;
+            const std::size_t segments = crossings.size() / 2;
+            for (std::size_t i = 0; i < segments; ++i) {
+                const std::size_t segment = forward ? i : segments - 1 - i;
+                double start = crossings[2 * segment];
+                double end = crossings[2 * segment + 1];
+                if (!forward) {
+                    std::swap(start, end);
+                }
+                const double direction = forward ? 1.0 : -1.0;
+                start -= direction * parameters.turnaroundM;
+                end += direction * parameters.turnaroundM;
+                appendSegment(output, start, end, v, direction);
+            }
+        }
+    }
+
+    void appendSegment(std::vector<MissionWaypoint> &output, double start, double end, double v, double direction) const {
+        append(output, start, v);
+        if (parameters.waypointPerPhoto && photoSpacingM > 0.0) {
+            const double length = std::abs(end - start);
+            for (double along = photoSpacingM; along < length; along += photoSpacingM) {
+                append(output, start + direction * along, v);
+            }
+        }
+        append(output, end, v);
+    }
+
+    void append(std::vector<MissionWaypoint> &output, double u, double v) const {
+        MissionWaypoint waypoint;
+        frame.toGeo(u, v, waypoint.latitudeDeg, waypoint.longitudeDeg);
+        waypoint.relativeAltitudeM = static_cast<float>(parameters.altitudeM);
+        waypoint.speedMS = static_cast<float>(parameters.speedMS);
+        output.push_back(waypoint);
+    }
+};
+
+double ringArea(const LocalRing &ring) {
+    double twiceArea = 0.0;
+    const std::size_t count = ring.east.size();
+    for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+        twiceArea += ring.east[j] * ring.north[i] - ring.east[i] * ring.north[j];
+    }
+    return std::abs(twiceArea) / 2.0;
+}
+
+LocalRing toLocal(const std::vector<GeoPoint> &points, const GeoMath::LocalProjection &projection) {
+    LocalRing ring;
+    ring.east.resize(points.size());
+    ring.north.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        projection.toLocal(points[i].latitudeDeg, points[i].longitudeDeg, ring.east[i], ring.north[i]);
+    }
+    return ring;
+}
+
+// Bir hat yönü için tarama; hat sayısı yeterince büyükse bloklar paralel işlenir
+bool sweep(const std::vector<LocalRing> &rings, const GeoMath::LocalProjection &projection, double angleDeg,
+           double lineSpacingM, double photoSpacingM, const SurveyParameters &parameters,
+           const CancellationToken &token, SurveyResult &result) {
+    auto job = std::make_shared<SweepJob>();
+    job->frame.projection = projection;
+    job->frame.sinAngle = std::sin(GeoMath::toRadians(angleDeg));
+    job->frame.cosAngle = std::cos(GeoMath::toRadians(angleDeg));
+    job->parameters = parameters;
+    job->photoSpacingM = photoSpacingM;
+    job->spacing = lineSpacingM;
+    job->token = token;
+
+    double minV = std::numeric_limits<double>::max();
+    double maxV = std::numeric_limits<double>::lowest();
+    for (const LocalRing &ring : rings) {
+        const std::size_t count = ring.east.size();
+        for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+            double u0, v0, u1, v1;
+            job->frame.toSweep(ring.east[j], ring.north[j], u0, v0);
+            job->frame.toSweep(ring.east[i], ring.north[i], u1, v1);
+            minV = std::min(minV, v0);
+            maxV = std::max(maxV, v0);
+            if (v0 == v1) {
+                continue;  // Hatlara paralel kenar kesişim üretmez
+            }
+            if (v0 > v1) {
+                std::swap(u0, u1);
+                std::swap(v0, v1);
+            }
+            job->edges.push_back({v0, v1, u0, (u1 - u0) / (v1 - v0)});
+        }
+    }
+    if (job->edges.empty()) {
+        return true;
+    }
+    std::sort(job->edges.begin(), job->edges.end(), [](const Edge &a, const Edge &b) { return a.v0 < b.v0; });
+
+    // Hatlar alana ortalanır; alan bir hat aralığından darsa tek hat ortadan geçer
+    const double height = maxV - minV;
+    job->lineCount = std::max(1, static_cast<int>(std::ceil(height / lineSpacingM)));
+    job->firstV = minV + (height - (job->lineCount - 1) * lineSpacingM) / 2.0;
+    job->blockCount = (job->lineCount + SurveyGenerator::LinesPerBlock - 1) / SurveyGenerator::LinesPerBlock;
+    job->blocks.resize(static_cast<std::size_t>(job->blockCount));
+
+    int helpers = 0;
+    if (job->lineCount >= SurveyGenerator::ParallelMinLines) {
+        helpers = static_cast<int>(std::min<std::size_t>(TaskExecutor::instance().workerCount(),
+                                                         static_cast<std::size_t>(job->blockCount - 1)));
+        for (int i = 0; i < helpers; ++i) {
+            TaskExecutor::instance().submit([job](const CancellationToken &) { job->runBlocks(); },
+                                            TaskExecutor::Priority::Normal, token);
+        }
+    }
+    job->runBlocks();
+    job->waitAll();
+
+    if (token.isCancelled()) {
+        result.error = "Survey generation cancelled";
+        return false;
+    }
+
+    std::size_t total = result.waypoints.size();
+    for (const auto &block : job->blocks) {
+        total += block.size();
+    }
+    result.waypoints.reserve(total);
+    for (const auto &block : job->blocks) {
+        result.waypoints.insert(result.waypoints.end(), block.begin(), block.end());
+    }
+    result.lines += job->lineCount;
+    result.threads = std::max(result.threads, helpers + 1);
+    return true;
+}
+
+} // namespace
+
+
+SurveyResult SurveyGenerator::footprint(const SurveyParameters &parameters) {
+    SurveyResult result;
+    const CameraParameters &camera = parameters.camera;
+    if (camera.focalLengthMm <= 0.0 || camera.sensorWidthMm <= 0.0 || camera.sensorHeightMm <= 0.0 ||
+        camera.imageWidthPx <= 0 || parameters.altitudeM <= 0.0) {
+        result.error = "Invalid camera parameters or altitude";
+        return result;
+    }
+    if (parameters.frontOverlap < 0.0 || parameters.frontOverlap >= 1.0 ||
+        parameters.sideOverlap < 0.0 || parameters.sideOverlap >= 1.0) {
+        result.error = "Overlap must be in [0, 1)";
+        return result;
+    }
+
+    result.groundWidthM = camera.sensorWidthMm * parameters.altitudeM / camera.focalLengthMm;
+    result.groundHeightM = camera.sensorHeightMm * parameters.altitudeM / camera.focalLengthMm;
+    result.gsdCmPerPx = result.groundWidthM * 100.0 / camera.imageWidthPx;
+    result.lineSpacingM = result.groundWidthM * (1.0 - parameters.sideOverlap);
+    result.triggerDistanceM = result.groundHeightM * (1.0 - parameters.frontOverlap);
+    result.success = true;
+    return result;
+}
+
+
+double SurveyGenerator::longestEdgeBearing(const SurveyPolygon &polygon) {
+    double longest = -1.0;
+    double bearing = 0.0;
+    const std::size_t count = polygon.outer.size();
+    for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+        const GeoPoint &from = polygon.outer[j];
+        const GeoPoint &to = polygon.outer[i];
+        const double length = GeoMath::distanceM(from.latitudeDeg, from.longitudeDeg, to.latitudeDeg, to.longitudeDeg);
+        if (length > longest) {
+            longest = length;
+            bearing = GeoMath::bearingDeg(from.latitudeDeg, from.longitudeDeg, to.latitudeDeg, to.longitudeDeg);
+        }
+    }
+    return bearing;
+}
+
+
+SurveyResult SurveyGenerator::generate(const SurveyPolygon &polygon, const SurveyParameters &parameters) {
+    return generate(polygon, parameters, CancellationToken());
+}
+
+
+SurveyResult SurveyGenerator::generate(const SurveyPolygon &polygon, const SurveyParameters &parameters,
+                                       const CancellationToken &token) {
+    const auto startTime = std::chrono::steady_clock::now();
+    SurveyResult result = footprint(parameters);
+    if (!result.success) {
+        return result;
+    }
+    result.success = false;
+    if (polygon.outer.size() < 3) {
+        result.error = "Survey polygon needs at least 3 vertices";
+        return result;
+    }
+
+    // Küçük alan yaklaşımı: projeksiyon merkezi dış sınırın köşe ortalaması
+    double originLat = 0.0;
+    double originLon = 0.0;
+    for (const GeoPoint &point : polygon.outer) {
+        originLat += point.latitudeDeg;
+        originLon += point.longitudeDeg;
+    }
+    const GeoMath::LocalProjection projection(originLat / polygon.outer.size(), originLon / polygon.outer.size());
+
+    std::vector<LocalRing> rings;
+    rings.reserve(polygon.holes.size() + 1);
+    rings.push_back(toLocal(polygon.outer, projection));
+    result.areaM2 = ringArea(rings.front());
+    for (const auto &hole : polygon.holes) {
+        if (hole.size() < 3) {
+            continue;
+        }
+        rings.push_back(toLocal(hole, projection));
+        result.areaM2 -= ringArea(rings.back());
+    }
+
+    if (!sweep(rings, projection, parameters.angleDeg, result.lineSpacingM, result.triggerDistanceM,
+               parameters, token, result)) {
+        return result;
+    }
+    if (parameters.pattern == SurveyParameters::Pattern::Crosshatch &&
+        !sweep(rings, projection, parameters.angleDeg + 90.0, result.lineSpacingM, result.triggerDistanceM,
+               parameters, token, result)) {
+        return result;
+    }
+
+    if (result.waypoints.size() > MaxWaypoints) {
+        result.error = QString("Survey produced %1 waypoints, limit is %2; increase spacing or disable per-photo waypoints")
+                           .arg(result.waypoints.size()).arg(MaxWaypoints);
+        result.waypoints.clear();
+        return result;
+    }
+
+    result.elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - startTime).count();
+    result.success = true;
+    return result;
+}
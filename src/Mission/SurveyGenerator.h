@@ -0,0 +1,78 @@
+#ifndef SURVEYGENERATOR_H
+#define SURVEYGENERATOR_H
+
+#include <QString>
+#include <vector>
+#include "src/Mission/MissionModel.h"
+#include "src/Utils/GeoMath.h"
+
+class CancellationToken;
+
+// Taranacak alan: dış sınır ve içindeki boşluklar (bina, göl vb.); halkaların yönü önemsizdir
+struct SurveyPolygon {
+    std::vector<GeoPoint> outer;
+    std::vector<std::vector<GeoPoint>> holes;
+};
+
+struct CameraParameters {
+    double sensorWidthMm = 13.2;  // Görüntü genişliği hatta dik kabul edilir
+    double sensorHeightMm = 8.8;
+    double focalLengthMm = 8.8;
+    int imageWidthPx = 5472;
+    int imageHeightPx = 3648;
+};
+
+struct SurveyParameters {
+    enum class Pattern { Lawnmower, Crosshatch };
+
+    CameraParameters camera;
+    double altitudeM = 60.0;      // Kalkış noktasına göre
+    double frontOverlap = 0.75;   // Hat boyunca, 0..1
+    double sideOverlap = 0.65;    // Hatlar arası, 0..1
+    double angleDeg = 0.0;        // Hat yönü, kuzeyden saat yönünde
+    double speedMS = 0.0;         // 0: hız değiştirilmez
+    double turnaroundM = 0.0;     // Sabit kanatta dönüş için hat uçlarının alan dışına uzatılması
+    Pattern pattern = Pattern::Lawnmower;
+    // true: her fotoğraf noktası ayrı görev noktası olur (mesafe tetiklemesi olmayan otopilotlar için);
+    // false: sadece hat uçları, fotoğraf DO_SET_CAM_TRIGG_DIST ile tetiklenir
+    bool waypointPerPhoto = false;
+};
+
+struct SurveyResult {
+    bool success = false;
+    QString error;
+    std::vector<MissionWaypoint> waypoints;
+    double groundWidthM = 0.0;    // Tek karenin yerdeki izi
+    double groundHeightM = 0.0;
+    double gsdCmPerPx = 0.0;
+    double lineSpacingM = 0.0;
+    double triggerDistanceM = 0.0;
+    double areaM2 = 0.0;
+    int lines = 0;
+    int threads = 1;
+    qint64 elapsedUs = 0;
+};
+
+// Çokgen alan için tarama (lawnmower / crosshatch) görevi üretir.
+// Çokgen yerel düzleme izdüşürülüp hatlar yatay olacak şekilde döndürülür; her tarama hattı
+// aktif kenar tablosu ile çokgene kırpılır (çift-tek kuralı boşlukları kendiliğinden dışarıda bırakır).
+// Hatlar bloklara bölünür; hat sayısı ParallelMinLines'ı geçerse bloklar TaskExecutor işçileri ve
+// çağıran thread tarafından paralel işlenir. Çağıran thread boş durmadığı için executor
+// görevinin içinden çağrılması güvenlidir. Sonuç MissionModel::setWaypoints ile görev yoluna verilir.
+class SurveyGenerator {
+public:
+    static constexpr int ParallelMinLines = 128;
+    static constexpr int LinesPerBlock = 32;
+    static constexpr std::size_t MaxWaypoints = 60000;  // MAVLink görev sıra numarası 16 bit
+
+    static SurveyResult generate(const SurveyPolygon &polygon, const SurveyParameters &parameters);
+    static SurveyResult generate(const SurveyPolygon &polygon, const SurveyParameters &parameters,
+                                 const CancellationToken &token);
+
+    // Kamera izi, hat aralığı ve tetikleme mesafesi (waypoint üretmeden)
+    static SurveyResult footprint(const SurveyParameters &parameters);
+    // Hatları en uzun kenara paralel uçmak dönüş sayısını azaltır
+    static double longestEdgeBearing(const SurveyPolygon &polygon);
+};
+
+#endif // SURVEYGENERATOR_H
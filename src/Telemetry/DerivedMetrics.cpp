@@ -0,0 +1,320 @@
+#include "DerivedMetrics.h"
+#include "src/Terrain/TerrainDatabase.h"
+#include "src/Utils/GeoMath.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+bool hasFix(const mavsdk::Telemetry::Position &position) {
+    return std::isfinite(position.latitude_deg) && std::isfinite(position.longitude_deg) &&
+           !(position.latitude_deg == 0.0 && position.longitude_deg == 0.0);
+}
+
+double secondsBetween(std::int64_t fromUs, std::int64_t toUs) {
+    return static_cast<double>(toUs - fromUs) / 1e6;
+}
+
+// Arm'dan beri kat edilen yatay mesafe. Havada asılı dururken GPS gürültüsü birikmesin
+// diye son kabul edilen noktadan MinStepM kadar uzaklaşınca toplanır.
+class DistanceFlownMetric : public DerivedMetric {
+public:
+    const char *name() const override { return "distance_flown"; }
+    quint32 inputFields() const override { return TelemetryField::Position; }
+
+    void update(TelemetrySnapshot &snapshot, quint32, std::int64_t) override {
+        const auto &position = snapshot.position;
+        if (!snapshot.armed || !hasFix(position)) {
+            return;
+        }
+        if (!hasLast) {
+            lastLat = position.latitude_deg;
+            lastLon = position.longitude_deg;
+            hasLast = true;
+            return;
+        }
+        const double step = GeoMath::distanceM(lastLat, lastLon, position.latitude_deg, position.longitude_deg);
+        if (step >= MinStepM) {
+            snapshot.derived.distanceFlownM += step;
+            lastLat = position.latitude_deg;
+            lastLon = position.longitude_deg;
+        }
+    }
+
+    void reset(TelemetrySnapshot &snapshot) override {
+        hasLast = false;
+        snapshot.derived.distanceFlownM = 0.0;
+    }
+
+private:
+    static constexpr double MinStepM = 1.0;
+    double lastLat = 0.0;
+    double lastLon = 0.0;
+    bool hasLast = false;
+};
+
+// Ev noktası arm anındaki konumdur; arm edilmeden önce ilk geçerli konum kullanılır
+class HomeMetric : public DerivedMetric {
+public:
+    const char *name() const override { return "home"; }
+    quint32 inputFields() const override { return TelemetryField::Position | TelemetryField::Armed; }
+
+    void update(TelemetrySnapshot &snapshot, quint32, std::int64_t) override {
+        const auto &position = snapshot.position;
+        auto &derived = snapshot.derived;
+        if (!hasFix(position)) {
+            return;
+        }
+        if (!std::isfinite(derived.homeLatitudeDeg)) {
+            derived.homeLatitudeDeg = position.latitude_deg;
+            derived.homeLongitudeDeg = position.longitude_deg;
+        }
+        derived.homeDistanceM = GeoMath::distanceM(position.latitude_deg, position.longitude_deg,
+                                                   derived.homeLatitudeDeg, derived.homeLongitudeDeg);
+        derived.homeBearingDeg = GeoMath::bearingDeg(position.latitude_deg, position.longitude_deg,
+                                                     derived.homeLatitudeDeg, derived.homeLongitudeDeg);
+    }
+
+    void reset(TelemetrySnapshot &snapshot) override {
+        auto &derived = snapshot.derived;
+        derived.homeLatitudeDeg = DerivedTelemetry::NaN;
+        derived.homeLongitudeDeg = DerivedTelemetry::NaN;
+        derived.homeDistanceM = DerivedTelemetry::NaN;
+        derived.homeBearingDeg = DerivedTelemetry::NaN;
+    }
+};
+
+// GUI'de seçilen hedefe (togoLat/togoLon) mesafe ve kerteriz
+class TargetMetric : public DerivedMetric {
+public:
+    const char *name() const override { return "target"; }
+    quint32 inputFields() const override { return TelemetryField::Position | TelemetryField::Target; }
+
+    void update(TelemetrySnapshot &snapshot, quint32, std::int64_t) override {
+        const auto &position = snapshot.position;
+        auto &derived = snapshot.derived;
+        if (!hasFix(position) || !std::isfinite(snapshot.targetLatitudeDeg) || !std::isfinite(snapshot.targetLongitudeDeg)) {
+            derived.targetDistanceM = DerivedTelemetry::NaN;
+            derived.targetBearingDeg = DerivedTelemetry::NaN;
+            return;
+        }
+        derived.targetDistanceM = GeoMath::distanceM(position.latitude_deg, position.longitude_deg,
+                                                     snapshot.targetLatitudeDeg, snapshot.targetLongitudeDeg);
+        derived.targetBearingDeg = GeoMath::bearingDeg(position.latitude_deg, position.longitude_deg,
+                                                       snapshot.targetLatitudeDeg, snapshot.targetLongitudeDeg);
+    }
+
+    // Hedef uçuştan bağımsızdır, arm ile sıfırlanmaz
+    void reset(TelemetrySnapshot &) override {}
+};
+
+// Anlık tırmanma hızı NED hızından, toplam tırmanış/iniş göreli irtifadan hesaplanır
+class ClimbMetric : public DerivedMetric {
+public:
+    const char *name() const override { return "climb"; }
+    quint32 inputFields() const override { return TelemetryField::Position | TelemetryField::TotalSpeed; }
+
+    void update(TelemetrySnapshot &snapshot, quint32 changedFields, std::int64_t) override {
+        auto &derived = snapshot.derived;
+
+        if ((changedFields & TelemetryField::TotalSpeed) && std::isfinite(snapshot.velocityNed.down_m_s)) {
+            const double climb = -static_cast<double>(snapshot.velocityNed.down_m_s);
+            derived.climbRateMS = climb;
+            if (snapshot.armed) {
+                derived.maxClimbRateMS = std::max(derived.maxClimbRateMS, climb);
+                derived.maxSinkRateMS = std::max(derived.maxSinkRateMS, -climb);
+            }
+        }
+
+        const double altitude = snapshot.position.relative_altitude_m;
+        if ((changedFields & TelemetryField::Position) && snapshot.armed && std::isfinite(altitude)) {
+            if (!hasReference) {
+                referenceAltitude = altitude;
+                hasReference = true;
+            } else if (std::abs(altitude - referenceAltitude) >= DeadbandM) {
+                // Ölü bant, irtifa gürültüsünün tırmanış olarak birikmesini engeller
+                if (altitude > referenceAltitude) {
+                    derived.totalAscentM += altitude - referenceAltitude;
+                } else {
+                    derived.totalDescentM += referenceAltitude - altitude;
+                }
+                referenceAltitude = altitude;
+            }
+        }
+    }
+
+    void reset(TelemetrySnapshot &snapshot) override {
+        auto &derived = snapshot.derived;
+        derived.maxClimbRateMS = 0.0;
+        derived.maxSinkRateMS = 0.0;
+        derived.totalAscentM = 0.0;
+        derived.totalDescentM = 0.0;
+        hasReference = false;
+    }
+
+private:
+    static constexpr double DeadbandM = 0.5;
+    double referenceAltitude = 0.0;
+    bool hasReference = false;
+};
+
+// Harcanan enerji: gerilim x akım, yamuk kuralı ile zamana göre integre edilir
+class EnergyMetric : public DerivedMetric {
+public:
+    const char *name() const override { return "energy"; }
+    quint32 inputFields() const override { return TelemetryField::Battery; }
+
+    void update(TelemetrySnapshot &snapshot, quint32, std::int64_t timestampUs) override {
+        const auto &battery = snapshot.battery;
+        auto &derived = snapshot.derived;
+        if (!std::isfinite(battery.voltage_v) || !std::isfinite(battery.current_battery_a) || battery.current_battery_a < 0) {
+            derived.powerW = DerivedTelemetry::NaN;
+            hasLast = false;
+            return;
+        }
+
+        const double power = static_cast<double>(battery.voltage_v) * battery.current_battery_a;
+        derived.powerW = power;
+
+        if (hasLast) {
+            const double dt = secondsBetween(lastTimestampUs, timestampUs);
+            // Uzun veri boşlukları tahmin edilmez, integral o aralığı atlar
+            if (dt > 0 && dt <= MaxGapSeconds) {
+                derived.energyUsedWh += 0.5 * (power + lastPower) * dt / 3600.0;
+            }
+        }
+        lastPower = power;
+        lastTimestampUs = timestampUs;
+        hasLast = true;
+    }
+
+    void reset(TelemetrySnapshot &snapshot) override {
+        snapshot.derived.energyUsedWh = 0.0;
+    }
+
+private:
+    static constexpr double MaxGapSeconds = 10.0;
+    double lastPower = 0.0;
+    std::int64_t lastTimestampUs = 0;
+    bool hasLast = false;
+};
+
+// Rüzgar tahmini: yer hızı vektörü - hava hızı vektörü (burun yönünde).
+// Yandan kayma ihmal edildiği için anlık değer gürültülüdür, üstel ortalama ile yumuşatılır.
+class WindMetric : public DerivedMetric {
+public:
+    const char *name() const override { return "wind"; }
+    quint32 inputFields() const override { return TelemetryField::TotalSpeed; }
+
+    void update(TelemetrySnapshot &snapshot, quint32, std::int64_t timestampUs) override {
+        const double airspeed = snapshot.fixedwingMetrics.airspeed_m_s;
+        const double heading = snapshot.heading.heading_deg;
+        const auto &velocity = snapshot.velocityNed;
+        if (!std::isfinite(airspeed) || airspeed < MinAirspeedMS || !std::isfinite(heading) ||
+            !std::isfinite(velocity.north_m_s) || !std::isfinite(velocity.east_m_s)) {
+            return;
+        }
+
+        const double headingRad = GeoMath::toRadians(heading);
+        const double windNorth = velocity.north_m_s - airspeed * std::cos(headingRad);
+        const double windEast = velocity.east_m_s - airspeed * std::sin(headingRad);
+
+        auto &derived = snapshot.derived;
+        if (!std::isfinite(derived.windNorthMS)) {
+            derived.windNorthMS = windNorth;
+            derived.windEastMS = windEast;
+        } else {
+            const double dt = std::max(0.0, secondsBetween(lastTimestampUs, timestampUs));
+            const double alpha = 1.0 - std::exp(-dt / SmoothingSeconds);
+            derived.windNorthMS += alpha * (windNorth - derived.windNorthMS);
+            derived.windEastMS += alpha * (windEast - derived.windEastMS);
+        }
+        lastTimestampUs = timestampUs;
+
+        derived.windSpeedMS = std::hypot(derived.windNorthMS, derived.windEastMS);
+        double from = GeoMath::toDegrees(std::atan2(-derived.windEastMS, -derived.windNorthMS));
+        derived.windFromDeg = from < 0 ? from + 360.0 : from;
+    }
+
+    // Rüzgar uçuştan bağımsızdır, tahmin korunur
+    void reset(TelemetrySnapshot &) override {}
+
+private:
+    static constexpr double MinAirspeedMS = 3.0;
+    static constexpr double SmoothingSeconds = 5.0;
+    std::int64_t lastTimestampUs = 0;
+};
+
+// Arazi üstü irtifa. Telemetri thread'i diske beklemesin diye sadece açık karolardan okunur;
+// karo henüz açık değilse arka planda açılır ve sonraki konum örneğinden itibaren değer gelir.
+class AglMetric : public DerivedMetric {
+public:
+    const char *name() const override { return "agl"; }
+    quint32 inputFields() const override { return TelemetryField::Position; }
+
+    void update(TelemetrySnapshot &snapshot, quint32, std::int64_t) override {
+        const auto &position = snapshot.position;
+        auto &derived = snapshot.derived;
+        if (!hasFix(position)) {
+            return;
+        }
+        derived.terrainElevationM = TerrainDatabase::instance().elevationM(
+            position.latitude_deg, position.longitude_deg, TerrainDatabase::LoadPolicy::CachedOnly);
+        derived.aglM = std::isfinite(position.absolute_altitude_m)
+                           ? position.absolute_altitude_m - derived.terrainElevationM
+                           : DerivedTelemetry::NaN;
+    }
+
+    // Arazi uçuştan bağımsızdır, arm ile sıfırlanmaz
+    void reset(TelemetrySnapshot &) override {}
+};
+
+} // namespace
+
+DerivedMetricsEngine::DerivedMetricsEngine() {
+    addMetric(std::make_unique<DistanceFlownMetric>());
+    addMetric(std::make_unique<HomeMetric>());
+    addMetric(std::make_unique<TargetMetric>());
+    addMetric(std::make_unique<ClimbMetric>());
+    addMetric(std::make_unique<EnergyMetric>());
+    addMetric(std::make_unique<WindMetric>());
+    addMetric(std::make_unique<AglMetric>());
+}
+
+void DerivedMetricsEngine::addMetric(std::unique_ptr<DerivedMetric> metric) {
+    inputMask |= metric->inputFields();
+    metrics.push_back(std::move(metric));
+}
+
+bool DerivedMetricsEngine::update(TelemetrySnapshot &snapshot, quint32 changedFields, std::int64_t timestampUs) {
+    if ((changedFields & TelemetryField::Armed) && snapshot.armed != wasArmed) {
+        wasArmed = snapshot.armed;
+        // Her arm yeni bir uçuş başlatır
+        if (snapshot.armed) {
+            reset(snapshot);
+        }
+    }
+
+    if ((changedFields & inputMask) == 0) {
+        return false;
+    }
+
+    bool updated = false;
+    for (const auto &metric : metrics) {
+        if (metric->inputFields() & changedFields) {
+            metric->update(snapshot, changedFields, timestampUs);
+            updated = true;
+        }
+    }
+    return updated;
+}
+
+void DerivedMetricsEngine::reset(TelemetrySnapshot &snapshot) {
+    for (const auto &metric : metrics) {
+        metric->reset(snapshot);
+    }
+}
+
+std::size_t DerivedMetricsEngine::metricCount() const {
+    return metrics.size();
+}
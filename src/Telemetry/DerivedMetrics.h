@@ -0,0 +1,53 @@
+#ifndef DERIVEDMETRICS_H
+#define DERIVEDMETRICS_H
+
+#include "src/Telemetry/TelemetrySnapshot.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Türetilmiş bir metrik. Girdi alanlarından biri değiştiğinde snapshot'ın yeni hali ile
+// çağrılır ve sadece kendi çıktılarını snapshot.derived içine yazar. Geçmişi yeniden
+// taramak yerine ihtiyaç duyduğu durumu (önceki örnek, integral vb.) kendisi tutar,
+// böylece her güncelleme O(1) kalır.
+class DerivedMetric {
+public:
+    virtual ~DerivedMetric() = default;
+
+    virtual const char *name() const = 0;
+
+    // TelemetryField bit maskesi
+    virtual quint32 inputFields() const = 0;
+
+    virtual void update(TelemetrySnapshot &snapshot, quint32 changedFields, std::int64_t timestampUs) = 0;
+
+    // Arm anında (yeni uçuş) birikmiş durum sıfırlanır
+    virtual void reset(TelemetrySnapshot &snapshot) = 0;
+};
+
+// Metrikleri girdi maskelerine göre çalıştırır.
+// update() snapshot'ın SeqLock yazma bölgesi içinden çağrılır: metriklerin iç durumu
+// yazma hakkı ile serileşir ve çıktılar girdilerle aynı anda yayınlanır. Bu yüzden
+// metrikler kısa ve bloklamayan olmalıdır.
+class DerivedMetricsEngine {
+public:
+    // Yerleşik metrikler (mesafe, ev, hedef, tırmanma, enerji, rüzgar, arazi) ile başlar
+    DerivedMetricsEngine();
+
+    // Sadece telemetri akışları başlamadan önce çağrılmalıdır
+    void addMetric(std::unique_ptr<DerivedMetric> metric);
+
+    // En az bir metrik çalıştıysa true döner (snapshot.derived değişmiş olabilir)
+    bool update(TelemetrySnapshot &snapshot, quint32 changedFields, std::int64_t timestampUs);
+
+    void reset(TelemetrySnapshot &snapshot);
+
+    std::size_t metricCount() const;
+
+private:
+    std::vector<std::unique_ptr<DerivedMetric>> metrics;
+    quint32 inputMask = 0;
+    bool wasArmed = false;
+};
+
+#endif // DERIVEDMETRICS_H
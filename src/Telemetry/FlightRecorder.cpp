@@ -0,0 +1,173 @@
+#include "FlightRecorder.h"
+#include "src/Telemetry/TelemetryTimeSeries.h"
+#include "src/Utils/Crc32.h"
+#include "src/Utils/Logger.h"
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <chrono>
+
+FlightRecorder::FlightRecorder()
+    : queue(QueueCapacity) {
+    chunkRecords.reserve(ChunkTargetBytes + sizeof(TelemetryRecord::RecordHeader) + MaxPayloadSize);
+    chunkIndex.reserve(ChunkTargetBytes / sizeof(TelemetryRecord::RecordHeader) + 1);
+}
+
+FlightRecorder::~FlightRecorder() {
+    stop();
+}
+
+bool FlightRecorder::start(const QString &path) {
+    stop();
+
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    file.setFileName(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        Logger::instance().log("Uçuş kayıt dosyası açılamadı: " + path, ERROR);
+        return false;
+    }
+
+    TelemetryRecord::FileHeader header{};
+    std::memcpy(header.magic, TelemetryRecord::FileMagic, sizeof(header.magic));
+    header.version = TelemetryRecord::FileVersion;
+    header.headerSize = sizeof(header);
+    header.startWallClockMs = QDateTime::currentMSecsSinceEpoch();
+    header.startMonotonicUs = TelemetryTimeSeries::now();
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.flush();
+
+    // Önceki kayıttan kuyrukta kalmış olabilecek örnekleri at
+    Slot discarded;
+    while (queue.tryPop(discarded)) {
+    }
+
+    chunkRecords.clear();
+    chunkIndex.clear();
+    chunkSequence = 0;
+    recordedRecords.store(0, std::memory_order_relaxed);
+    droppedRecords.store(0, std::memory_order_relaxed);
+    writtenChunks.store(0, std::memory_order_relaxed);
+
+    stopRequested.store(false, std::memory_order_relaxed);
+    writerThread = std::thread(&FlightRecorder::writerLoop, this);
+    recording.store(true, std::memory_order_release);
+
+    Logger::instance().log("Uçuş kaydı başlatıldı: " + path, INFO);
+    return true;
+}
+
+void FlightRecorder::stop() {
+    if (!writerThread.joinable()) {
+        return;
+    }
+
+    recording.store(false, std::memory_order_release);
+    stopRequested.store(true, std::memory_order_release);
+    writerThread.join();
+
+    file.close();
+    Logger::instance().log("Uçuş kaydı durduruldu. Kayıt: " + QString::number(getRecordedCount()) +
+                               ", chunk: " + QString::number(getChunkCount()) +
+                               ", atılan: " + QString::number(getDroppedCount()), INFO);
+}
+
+bool FlightRecorder::isRecording() const {
+    return recording.load(std::memory_order_acquire);
+}
+
+QString FlightRecorder::filePath() const {
+    return file.fileName();
+}
+
+quint64 FlightRecorder::getRecordedCount() const {
+    return recordedRecords.load(std::memory_order_relaxed);
+}
+
+quint64 FlightRecorder::getDroppedCount() const {
+    return droppedRecords.load(std::memory_order_relaxed);
+}
+
+quint64 FlightRecorder::getChunkCount() const {
+    return writtenChunks.load(std::memory_order_relaxed);
+}
+
+void FlightRecorder::writerLoop() {
+    Slot slot;
+    for (;;) {
+        const bool stopping = stopRequested.load(std::memory_order_acquire);
+
+        bool drained = false;
+        while (queue.tryPop(slot)) {
+            appendToChunk(slot);
+            drained = true;
+        }
+
+        if (!chunkIndex.empty() && (stopping || TelemetryTimeSeries::now() - chunkOpenedAtUs >= ChunkMaxAgeMs * 1000LL)) {
+            flushChunk();
+        }
+
+        if (stopping) {
+            break;
+        }
+
+        if (!drained) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+}
+
+void FlightRecorder::appendToChunk(const Slot &slot) {
+    if (chunkIndex.empty()) {
+        chunkFirstTimestampUs = slot.timestampUs;
+        chunkOpenedAtUs = TelemetryTimeSeries::now();
+    }
+    chunkLastTimestampUs = slot.timestampUs;
+
+    TelemetryRecord::RecordHeader header{};
+    header.timestampUs = slot.timestampUs;
+    header.type = slot.type;
+    header.size = slot.size;
+
+    chunkIndex.push_back(static_cast<std::uint32_t>(chunkRecords.size()));
+    const auto *headerBytes = reinterpret_cast<const std::uint8_t *>(&header);
+    chunkRecords.insert(chunkRecords.end(), headerBytes, headerBytes + sizeof(header));
+    chunkRecords.insert(chunkRecords.end(), slot.payload, slot.payload + slot.size);
+
+    if (chunkRecords.size() >= ChunkTargetBytes) {
+        flushChunk();
+    }
+}
+
+bool FlightRecorder::flushChunk() {
+    if (chunkIndex.empty()) {
+        return true;
+    }
+
+    const std::size_t indexBytes = chunkIndex.size() * sizeof(std::uint32_t);
+
+    TelemetryRecord::ChunkHeader header{};
+    header.magic = TelemetryRecord::ChunkMagic;
+    header.sequence = chunkSequence++;
+    header.recordCount = static_cast<std::uint32_t>(chunkIndex.size());
+    header.bodySize = static_cast<std::uint32_t>(indexBytes + chunkRecords.size());
+    header.firstTimestampUs = chunkFirstTimestampUs;
+    header.lastTimestampUs = chunkLastTimestampUs;
+    header.crc32 = Crc32::update(Crc32::compute(chunkIndex.data(), indexBytes), chunkRecords.data(), chunkRecords.size());
+
+    bool ok = file.write(reinterpret_cast<const char *>(&header), sizeof(header)) == sizeof(header);
+    ok = ok && file.write(reinterpret_cast<const char *>(chunkIndex.data()), indexBytes) == static_cast<qint64>(indexBytes);
+    ok = ok && file.write(reinterpret_cast<const char *>(chunkRecords.data()), chunkRecords.size()) == static_cast<qint64>(chunkRecords.size());
+    ok = ok && file.flush();
+
+    if (ok) {
+        recordedRecords.fetch_add(chunkIndex.size(), std::memory_order_relaxed);
+        writtenChunks.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        droppedRecords.fetch_add(chunkIndex.size(), std::memory_order_relaxed);
+        Logger::instance().log("Uçuş kaydı chunk'ı yazılamadı: " + file.errorString(), ERROR);
+    }
+
+    chunkIndex.clear();
+    chunkRecords.clear();
+    return ok;
+}
@@ -0,0 +1,92 @@
+#ifndef FLIGHTRECORDER_H
+#define FLIGHTRECORDER_H
+
+#include "src/Telemetry/TelemetryRecord.h"
+#include "src/Utils/BoundedMpscQueue.h"
+#include <QFile>
+#include <QString>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Tüm telemetri callback'lerini ham ikili formatta (.uavrec) kaydeden uçuş kaydedici.
+// Callback yolu sadece önceden ayrılmış kuyruğa bir slot kopyalar; dosya işlemleri,
+// chunk oluşturma ve CRC hesaplama arka plandaki yazıcı thread'inde yapılır.
+class FlightRecorder {
+public:
+    static constexpr std::size_t MaxPayloadSize = 112;
+    static constexpr std::size_t QueueCapacity = 16384;
+    static constexpr std::size_t ChunkTargetBytes = 64 * 1024;
+    static constexpr int ChunkMaxAgeMs = 1000;  // Çökmede kaybedilebilecek en uzun süre
+
+    FlightRecorder();
+    ~FlightRecorder();
+
+    FlightRecorder(const FlightRecorder &) = delete;
+    FlightRecorder &operator=(const FlightRecorder &) = delete;
+
+    bool start(const QString &filePath);
+    void stop();
+    bool isRecording() const;
+    QString filePath() const;
+
+    // Callback thread'inden çağrılır; bellek ayırmaz, bloklamaz. Kuyruk doluysa örnek sayılıp atılır.
+    template <typename T>
+    void record(TelemetryRecord::Type type, std::int64_t timestampUs, const T &value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Kaydedilen tipler trivially copyable olmalı");
+        static_assert(sizeof(T) <= MaxPayloadSize, "Kayıt payload boyutu aşıldı");
+
+        if (!recording.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        const bool queued = queue.tryEmplace([&](Slot &slot) {
+            slot.timestampUs = timestampUs;
+            slot.type = static_cast<std::uint16_t>(type);
+            slot.size = static_cast<std::uint16_t>(sizeof(T));
+            std::memcpy(slot.payload, &value, sizeof(T));
+        });
+
+        if (!queued) {
+            droppedRecords.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    quint64 getRecordedCount() const;
+    quint64 getDroppedCount() const;
+    quint64 getChunkCount() const;
+
+private:
+    struct Slot {
+        std::int64_t timestampUs;
+        std::uint16_t type;
+        std::uint16_t size;
+        std::uint8_t payload[MaxPayloadSize];
+    };
+
+    BoundedMpscQueue<Slot> queue;
+    std::thread writerThread;
+    std::atomic<bool> recording{false};
+    std::atomic<bool> stopRequested{false};
+
+    std::atomic<quint64> recordedRecords{0};
+    std::atomic<quint64> droppedRecords{0};
+    std::atomic<quint64> writtenChunks{0};
+
+    // Sadece yazıcı thread'i tarafından kullanılır
+    QFile file;
+    std::vector<std::uint8_t> chunkRecords;
+    std::vector<std::uint32_t> chunkIndex;
+    std::int64_t chunkFirstTimestampUs = 0;
+    std::int64_t chunkLastTimestampUs = 0;
+    std::int64_t chunkOpenedAtUs = 0;
+    std::uint32_t chunkSequence = 0;
+
+    void writerLoop();
+    void appendToChunk(const Slot &slot);
+    bool flushChunk();
+};
+
+#endif // FLIGHTRECORDER_H
@@ -0,0 +1,129 @@
+#include "FlightRecordingReader.h"
+#include "src/Utils/Crc32.h"
+#include <algorithm>
+#include <cstring>
+
+FlightRecordingReader::FlightRecordingReader() = default;
+
+FlightRecordingReader::~FlightRecordingReader() {
+    close();
+}
+
+bool FlightRecordingReader::open(const QString &filePath) {
+    close();
+
+    file.setFileName(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        lastError = "Kayıt dosyası açılamadı: " + file.errorString();
+        return false;
+    }
+
+    dataSize = file.size();
+    data = dataSize > 0 ? file.map(0, dataSize) : nullptr;
+    if (!data || dataSize < static_cast<qint64>(sizeof(TelemetryRecord::FileHeader))) {
+        lastError = "Kayıt dosyası eşlenemedi ya da çok kısa";
+        close();
+        return false;
+    }
+
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, TelemetryRecord::FileMagic, sizeof(header.magic)) != 0 ||
+        header.version != TelemetryRecord::FileVersion) {
+        lastError = "Geçersiz kayıt dosyası başlığı";
+        close();
+        return false;
+    }
+
+    // Sadece chunk başlıkları taranır; yarım kalmış son chunk dizine alınmaz
+    qint64 offset = header.headerSize;
+    while (offset + static_cast<qint64>(sizeof(TelemetryRecord::ChunkHeader)) <= dataSize) {
+        TelemetryRecord::ChunkHeader chunk;
+        std::memcpy(&chunk, data + offset, sizeof(chunk));
+        const qint64 end = offset + static_cast<qint64>(sizeof(chunk)) + chunk.bodySize;
+        if (chunk.magic != TelemetryRecord::ChunkMagic || end > dataSize) {
+            break;
+        }
+
+        chunkDirectory.push_back({offset, chunk.recordCount, chunk.bodySize, chunk.firstTimestampUs, chunk.lastTimestampUs});
+        offset = end;
+    }
+
+    return true;
+}
+
+void FlightRecordingReader::close() {
+    if (data) {
+        file.unmap(const_cast<uchar *>(data));
+        data = nullptr;
+    }
+    if (file.isOpen()) {
+        file.close();
+    }
+    dataSize = 0;
+    chunkDirectory.clear();
+}
+
+bool FlightRecordingReader::isOpen() const {
+    return data != nullptr;
+}
+
+QString FlightRecordingReader::errorString() const {
+    return lastError;
+}
+
+std::int64_t FlightRecordingReader::firstTimestampUs() const {
+    return chunkDirectory.empty() ? 0 : chunkDirectory.front().firstTimestampUs;
+}
+
+std::int64_t FlightRecordingReader::lastTimestampUs() const {
+    return chunkDirectory.empty() ? 0 : chunkDirectory.back().lastTimestampUs;
+}
+
+std::size_t FlightRecordingReader::findChunk(std::int64_t timestampUs) const {
+    const auto it = std::lower_bound(chunkDirectory.begin(), chunkDirectory.end(), timestampUs,
+                                     [](const ChunkInfo &chunk, std::int64_t t) { return chunk.lastTimestampUs < t; });
+    return static_cast<std::size_t>(it - chunkDirectory.begin());
+}
+
+bool FlightRecordingReader::readChunk(std::size_t index, const RecordVisitor &visitor) const {
+    if (index >= chunkDirectory.size()) {
+        return false;
+    }
+
+    const ChunkInfo &info = chunkDirectory[index];
+    TelemetryRecord::ChunkHeader chunk;
+    std::memcpy(&chunk, data + info.offset, sizeof(chunk));
+
+    const uchar *body = data + info.offset + sizeof(chunk);
+    if (Crc32::compute(body, chunk.bodySize) != chunk.crc32) {
+        return false;
+    }
+
+    const std::size_t indexBytes = static_cast<std::size_t>(chunk.recordCount) * sizeof(std::uint32_t);
+    if (indexBytes > chunk.bodySize) {
+        return false;
+    }
+
+    const uchar *records = body + indexBytes;
+    const std::size_t recordBytes = chunk.bodySize - indexBytes;
+
+    for (std::uint32_t i = 0; i < chunk.recordCount; ++i) {
+        std::uint32_t recordOffset;
+        std::memcpy(&recordOffset, body + i * sizeof(std::uint32_t), sizeof(recordOffset));
+        if (recordOffset + sizeof(TelemetryRecord::RecordHeader) > recordBytes) {
+            return false;
+        }
+
+        TelemetryRecord::RecordHeader record;
+        std::memcpy(&record, records + recordOffset, sizeof(record));
+        if (recordOffset + sizeof(record) + record.size > recordBytes) {
+            return false;
+        }
+
+        if (!visitor(record, records + recordOffset + sizeof(record))) {
+            break;
+        }
+    }
+
+    return true;
+}
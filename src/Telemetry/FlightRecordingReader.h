@@ -0,0 +1,56 @@
+#ifndef FLIGHTRECORDINGREADER_H
+#define FLIGHTRECORDINGREADER_H
+
+#include "src/Telemetry/TelemetryRecord.h"
+#include <QFile>
+#include <QString>
+#include <functional>
+#include <vector>
+
+// .uavrec dosyalarını okur. Dosya belleğe eşlenir (mmap), açılışta sadece chunk
+// başlıkları taranarak bir chunk dizini çıkarılır. Kayıtlar chunk chunk, CRC
+// doğrulandıktan sonra kopyalanmadan ziyaret edilir.
+class FlightRecordingReader {
+public:
+    struct ChunkInfo {
+        qint64 offset;              // ChunkHeader'ın dosyadaki yeri
+        std::uint32_t recordCount;
+        std::uint32_t bodySize;
+        std::int64_t firstTimestampUs;
+        std::int64_t lastTimestampUs;
+    };
+
+    // Payload ChunkHeader ile aynı eşlenmiş bellekten gösterilir, ziyaret süresince geçerlidir
+    using RecordVisitor = std::function<bool(const TelemetryRecord::RecordHeader &header, const void *payload)>;
+
+    FlightRecordingReader();
+    ~FlightRecordingReader();
+
+    bool open(const QString &filePath);
+    void close();
+    bool isOpen() const;
+    QString errorString() const;
+
+    const TelemetryRecord::FileHeader &fileHeader() const { return header; }
+    const std::vector<ChunkInfo> &chunks() const { return chunkDirectory; }
+
+    std::int64_t firstTimestampUs() const;
+    std::int64_t lastTimestampUs() const;
+
+    // timestampUs anını içeren (ya da ondan sonraki ilk) chunk'ın indeksi, O(log n)
+    std::size_t findChunk(std::int64_t timestampUs) const;
+
+    // Chunk'ı doğrular ve kayıtlarını sırayla ziyaret eder. Ziyaretçi false dönerse durur.
+    // CRC uyuşmazsa hiçbir kayıt ziyaret edilmez ve false döner.
+    bool readChunk(std::size_t index, const RecordVisitor &visitor) const;
+
+private:
+    QFile file;
+    const uchar *data = nullptr;
+    qint64 dataSize = 0;
+    TelemetryRecord::FileHeader header{};
+    std::vector<ChunkInfo> chunkDirectory;
+    QString lastError;
+};
+
+#endif // FLIGHTRECORDINGREADER_H
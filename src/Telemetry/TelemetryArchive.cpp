@@ -0,0 +1,354 @@
+#include "TelemetryArchive.h"
+#include "src/Telemetry/FlightRecordingReader.h"
+#include "src/Telemetry/TelemetryArchiveCodec.h"
+#include "src/Utils/Crc32.h"
+#include <mavsdk/plugins/telemetry/telemetry.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace TelemetryArchiveFormat;
+
+TelemetryArchiveWriter::TelemetryArchiveWriter() {
+    for (std::size_t i = 0; i < TelemetryChannelCount; ++i) {
+        const auto &info = telemetryChannelInfo(static_cast<TelemetryChannel>(i));
+        pending[i].timestamps.reserve(BlockSamples);
+        pending[i].columns.resize(info.columnCount);
+        for (auto &column : pending[i].columns) {
+            column.reserve(BlockSamples);
+        }
+    }
+}
+
+TelemetryArchiveWriter::~TelemetryArchiveWriter() {
+    if (file.isOpen()) {
+        close();
+    }
+}
+
+bool TelemetryArchiveWriter::open(const QString &filePath) {
+    file.setFileName(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, FileMagic, sizeof(header.magic));
+    header.version = FileVersion;
+    writeFailed = file.write(reinterpret_cast<const char *>(&header), sizeof(header)) != sizeof(header);
+
+    directory.clear();
+    samples = 0;
+    return !writeFailed;
+}
+
+void TelemetryArchiveWriter::append(TelemetryChannel channel, std::int64_t timestampUs, std::initializer_list<double> values) {
+    PendingBlock &block = pending[static_cast<std::size_t>(channel)];
+    block.timestamps.push_back(timestampUs);
+
+    std::size_t column = 0;
+    for (double value : values) {
+        if (column >= block.columns.size()) {
+            break;
+        }
+        block.columns[column++].push_back(value);
+    }
+    for (; column < block.columns.size(); ++column) {
+        block.columns[column].push_back(0.0);
+    }
+
+    ++samples;
+    if (block.timestamps.size() >= BlockSamples) {
+        flushBlock(channel);
+    }
+}
+
+void TelemetryArchiveWriter::flushBlock(TelemetryChannel channel) {
+    PendingBlock &block = pending[static_cast<std::size_t>(channel)];
+    if (block.timestamps.empty()) {
+        return;
+    }
+
+    encoded.clear();
+    TelemetryArchiveCodec::encodeBlock(telemetryChannelInfo(channel), block.timestamps, block.columns, encoded);
+
+    DirectoryEntry entry{};
+    entry.channel = static_cast<std::uint8_t>(channel);
+    entry.sampleCount = static_cast<std::uint32_t>(block.timestamps.size());
+    entry.firstTimestampUs = block.timestamps.front();
+    entry.lastTimestampUs = block.timestamps.back();
+    entry.offset = static_cast<std::uint64_t>(file.pos());
+    entry.size = static_cast<std::uint32_t>(encoded.size());
+    entry.crc32 = Crc32::compute(encoded.data(), encoded.size());
+
+    if (file.write(reinterpret_cast<const char *>(encoded.data()), encoded.size()) != static_cast<qint64>(encoded.size())) {
+        writeFailed = true;
+    }
+    directory.push_back(entry);
+
+    block.timestamps.clear();
+    for (auto &column : block.columns) {
+        column.clear();
+    }
+}
+
+bool TelemetryArchiveWriter::close() {
+    if (!file.isOpen()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < TelemetryChannelCount; ++i) {
+        flushBlock(static_cast<TelemetryChannel>(i));
+    }
+
+    // Dizin kanal ve zamana göre sıralanır; okuyucu her kanal için ikili arama yapar
+    std::stable_sort(directory.begin(), directory.end(), [](const DirectoryEntry &a, const DirectoryEntry &b) {
+        return a.channel != b.channel ? a.channel < b.channel : a.firstTimestampUs < b.firstTimestampUs;
+    });
+
+    Footer footer{};
+    footer.directoryOffset = static_cast<std::uint64_t>(file.pos());
+    footer.entryCount = static_cast<std::uint32_t>(directory.size());
+    footer.directoryCrc32 = Crc32::compute(directory.data(), directory.size() * sizeof(DirectoryEntry));
+    std::memcpy(footer.magic, FooterMagic, sizeof(footer.magic));
+
+    const qint64 directoryBytes = static_cast<qint64>(directory.size() * sizeof(DirectoryEntry));
+    writeFailed |= file.write(reinterpret_cast<const char *>(directory.data()), directoryBytes) != directoryBytes;
+    writeFailed |= file.write(reinterpret_cast<const char *>(&footer), sizeof(footer)) != sizeof(footer);
+    file.close();
+    return !writeFailed;
+}
+
+quint64 TelemetryArchiveWriter::bytesWritten() const {
+    return static_cast<quint64>(file.isOpen() ? file.pos() : file.size());
+}
+
+
+
+TelemetryArchiveReader::TelemetryArchiveReader() = default;
+
+TelemetryArchiveReader::~TelemetryArchiveReader() {
+    close();
+}
+
+bool TelemetryArchiveReader::open(const QString &filePath) {
+    close();
+
+    file.setFileName(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        lastError = "Arşiv dosyası açılamadı: " + file.errorString();
+        return false;
+    }
+
+    dataSize = file.size();
+    data = dataSize > 0 ? file.map(0, dataSize) : nullptr;
+    if (!data || dataSize < static_cast<qint64>(sizeof(FileHeader) + sizeof(Footer))) {
+        lastError = "Arşiv dosyası eşlenemedi ya da çok kısa";
+        close();
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    Footer footer;
+    std::memcpy(&footer, data + dataSize - sizeof(footer), sizeof(footer));
+
+    const std::uint64_t directoryBytes = static_cast<std::uint64_t>(footer.entryCount) * sizeof(DirectoryEntry);
+    if (std::memcmp(header.magic, FileMagic, sizeof(header.magic)) != 0 ||
+        std::memcmp(footer.magic, FooterMagic, sizeof(footer.magic)) != 0 ||
+        footer.directoryOffset + directoryBytes + sizeof(footer) != static_cast<std::uint64_t>(dataSize) ||
+        Crc32::compute(data + footer.directoryOffset, directoryBytes) != footer.directoryCrc32) {
+        lastError = "Arşiv dizini geçersiz (dosya eksik yazılmış olabilir)";
+        close();
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < footer.entryCount; ++i) {
+        DirectoryEntry entry;
+        std::memcpy(&entry, data + footer.directoryOffset + i * sizeof(DirectoryEntry), sizeof(entry));
+        if (entry.channel < TelemetryChannelCount && entry.offset + entry.size <= footer.directoryOffset) {
+            directory[entry.channel].push_back(entry);
+        }
+    }
+
+    return true;
+}
+
+void TelemetryArchiveReader::close() {
+    if (data) {
+        file.unmap(const_cast<uchar *>(data));
+        data = nullptr;
+    }
+    if (file.isOpen()) {
+        file.close();
+    }
+    dataSize = 0;
+    for (auto &entries : directory) {
+        entries.clear();
+    }
+}
+
+QString TelemetryArchiveReader::errorString() const {
+    return lastError;
+}
+
+const std::vector<DirectoryEntry> &TelemetryArchiveReader::blocks(TelemetryChannel channel) const {
+    return directory[static_cast<std::size_t>(channel)];
+}
+
+std::size_t TelemetryArchiveReader::query(TelemetryChannel channel, std::int64_t fromUs, std::int64_t toUs, std::uint32_t columnMask,
+                                          std::vector<std::int64_t> &timestamps, std::vector<std::vector<double>> &values) const {
+    const auto &info = telemetryChannelInfo(channel);
+    const auto &entries = blocks(channel);
+
+    timestamps.clear();
+    values.assign(info.columnCount, {});
+
+    std::vector<std::int64_t> blockTimestamps;
+    std::vector<std::vector<double>> blockValues;
+
+    auto it = std::lower_bound(entries.begin(), entries.end(), fromUs,
+                               [](const DirectoryEntry &entry, std::int64_t t) { return entry.lastTimestampUs < t; });
+    for (; it != entries.end() && it->firstTimestampUs <= toUs; ++it) {
+        const uchar *block = data + it->offset;
+        if (Crc32::compute(block, it->size) != it->crc32) {
+            continue;
+        }
+
+        blockTimestamps.clear();
+        blockValues.clear();
+        if (!TelemetryArchiveCodec::decodeBlock(info, block, it->size, columnMask, blockTimestamps, blockValues)) {
+            continue;
+        }
+
+        // Blok içinde aralığın sınırlarını da ikili aramayla bul
+        const auto first = std::lower_bound(blockTimestamps.begin(), blockTimestamps.end(), fromUs) - blockTimestamps.begin();
+        const auto last = std::upper_bound(blockTimestamps.begin(), blockTimestamps.end(), toUs) - blockTimestamps.begin();
+
+        timestamps.insert(timestamps.end(), blockTimestamps.begin() + first, blockTimestamps.begin() + last);
+        for (std::size_t c = 0; c < info.columnCount; ++c) {
+            if (!blockValues[c].empty()) {
+                values[c].insert(values[c].end(), blockValues[c].begin() + first, blockValues[c].begin() + last);
+            }
+        }
+    }
+
+    return timestamps.size();
+}
+
+
+
+namespace TelemetryArchive {
+
+namespace {
+template <typename T>
+bool readPayload(const void *payload, std::size_t size, T &value) {
+    if (size != sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, payload, sizeof(T));
+    return true;
+}
+
+// Kayıttaki ham struct'ı TelemetryHandler'ın geçmişe yazdığı sütunlarla aynı şekilde kanala çevirir
+void appendRecord(TelemetryArchiveWriter &writer, const TelemetryRecord::RecordHeader &record, const void *payload) {
+    using Type = TelemetryRecord::Type;
+    const std::int64_t t = record.timestampUs;
+
+    switch (static_cast<Type>(record.type)) {
+    case Type::Position: {
+        mavsdk::Telemetry::Position v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::Position, t, {v.latitude_deg, v.longitude_deg, v.absolute_altitude_m, v.relative_altitude_m});
+        break;
+    }
+    case Type::Heading: {
+        mavsdk::Telemetry::Heading v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::Heading, t, {v.heading_deg});
+        break;
+    }
+    case Type::Attitude: {
+        mavsdk::Telemetry::EulerAngle v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::Attitude, t, {v.roll_deg, v.pitch_deg, v.yaw_deg});
+        break;
+    }
+    case Type::FixedwingMetrics: {
+        mavsdk::Telemetry::FixedwingMetrics v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::FixedwingMetrics, t, {v.airspeed_m_s, v.throttle_percentage, v.climb_rate_m_s});
+        break;
+    }
+    case Type::FlightMode: {
+        mavsdk::Telemetry::FlightMode v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::FlightMode, t, {static_cast<double>(v)});
+        break;
+    }
+    case Type::GpsInfo: {
+        mavsdk::Telemetry::GpsInfo v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::GpsInfo, t, {static_cast<double>(v.num_satellites), static_cast<double>(v.fix_type)});
+        break;
+    }
+    case Type::Battery: {
+        mavsdk::Telemetry::Battery v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::Battery, t, {v.voltage_v, v.remaining_percent});
+        break;
+    }
+    case Type::Armed: {
+        bool v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::Armed, t, {v ? 1.0 : 0.0});
+        break;
+    }
+    case Type::VelocityNed: {
+        mavsdk::Telemetry::VelocityNed v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::TotalSpeed, t,
+                          {std::sqrt(v.north_m_s * v.north_m_s + v.east_m_s * v.east_m_s + v.down_m_s * v.down_m_s)});
+        break;
+    }
+    case Type::RcStatus: {
+        mavsdk::Telemetry::RcStatus v;
+        if (readPayload(payload, record.size, v))
+            writer.append(TelemetryChannel::RcStatus, t, {v.signal_strength_percent});
+        break;
+    }
+    case Type::Health:
+        // Sağlık bayrakları arşiv kanallarında tutulmaz
+        break;
+    }
+}
+} // namespace
+
+bool convertRecording(const QString &recordingPath, const QString &archivePath, QString *error) {
+    FlightRecordingReader reader;
+    if (!reader.open(recordingPath)) {
+        if (error) *error = reader.errorString();
+        return false;
+    }
+
+    TelemetryArchiveWriter writer;
+    if (!writer.open(archivePath)) {
+        if (error) *error = "Arşiv dosyası oluşturulamadı: " + archivePath;
+        return false;
+    }
+
+    for (std::size_t i = 0; i < reader.chunks().size(); ++i) {
+        reader.readChunk(i, [&writer](const TelemetryRecord::RecordHeader &record, const void *payload) {
+            appendRecord(writer, record, payload);
+            return true;
+        });
+    }
+
+    if (!writer.close()) {
+        if (error) *error = "Arşiv dosyası yazılamadı: " + archivePath;
+        return false;
+    }
+    return true;
+}
+
+} // namespace TelemetryArchive
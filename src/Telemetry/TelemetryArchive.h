@@ -0,0 +1,115 @@
+#ifndef TELEMETRYARCHIVE_H
+#define TELEMETRYARCHIVE_H
+
+#include "src/Telemetry/TelemetryChannel.h"
+#include <QFile>
+#include <QString>
+#include <array>
+#include <initializer_list>
+#include <vector>
+
+// Sıkıştırılmış, sütun bazlı telemetri arşivi (.uavarc).
+//
+//   FileHeader | blok* | DirectoryEntry[entryCount] | Footer
+//
+// Her blok tek bir kanalın ardışık örneklerini TelemetryArchiveCodec ile saklar.
+// Dosya sonundaki dizin kanal ve zaman aralığına göre blokları bulur; bir sorgu
+// O(log n) ile ilk bloğa gider ve sadece istenen kanal/sütunları çözer.
+namespace TelemetryArchiveFormat {
+
+constexpr char FileMagic[8] = {'U', 'A', 'V', 'A', 'R', 'C', '0', '1'};
+constexpr char FooterMagic[8] = {'U', 'A', 'V', 'A', 'R', 'C', 'F', 'T'};
+constexpr std::uint32_t FileVersion = 1;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t reserved;
+};
+
+struct DirectoryEntry {
+    std::uint8_t channel;
+    std::uint8_t reserved[3];
+    std::uint32_t sampleCount;
+    std::int64_t firstTimestampUs;
+    std::int64_t lastTimestampUs;
+    std::uint64_t offset;
+    std::uint32_t size;
+    std::uint32_t crc32;
+};
+
+struct Footer {
+    std::uint64_t directoryOffset;
+    std::uint32_t entryCount;
+    std::uint32_t directoryCrc32;
+    char magic[8];
+};
+
+static_assert(sizeof(FileHeader) == 16, "FileHeader düzeni değişmemeli");
+static_assert(sizeof(DirectoryEntry) == 40, "DirectoryEntry düzeni değişmemeli");
+static_assert(sizeof(Footer) == 24, "Footer düzeni değişmemeli");
+
+} // namespace TelemetryArchiveFormat
+
+class TelemetryArchiveWriter {
+public:
+    static constexpr std::size_t BlockSamples = 4096;
+
+    TelemetryArchiveWriter();
+    ~TelemetryArchiveWriter();
+
+    bool open(const QString &filePath);
+    void append(TelemetryChannel channel, std::int64_t timestampUs, std::initializer_list<double> values);
+    // Yarım blokları, dizini ve footer'ı yazar
+    bool close();
+
+    quint64 sampleCount() const { return samples; }
+    quint64 bytesWritten() const;
+
+private:
+    struct PendingBlock {
+        std::vector<std::int64_t> timestamps;
+        std::vector<std::vector<double>> columns;
+    };
+
+    QFile file;
+    std::array<PendingBlock, TelemetryChannelCount> pending;
+    std::vector<TelemetryArchiveFormat::DirectoryEntry> directory;
+    std::vector<std::uint8_t> encoded;
+    quint64 samples = 0;
+    bool writeFailed = false;
+
+    void flushBlock(TelemetryChannel channel);
+};
+
+class TelemetryArchiveReader {
+public:
+    TelemetryArchiveReader();
+    ~TelemetryArchiveReader();
+
+    bool open(const QString &filePath);
+    void close();
+    QString errorString() const;
+
+    // [fromUs, toUs] aralığındaki örnekleri, columnMask'taki sütunlar için çözer.
+    std::size_t query(TelemetryChannel channel, std::int64_t fromUs, std::int64_t toUs, std::uint32_t columnMask,
+                      std::vector<std::int64_t> &timestamps, std::vector<std::vector<double>> &values) const;
+
+    const std::vector<TelemetryArchiveFormat::DirectoryEntry> &blocks(TelemetryChannel channel) const;
+
+private:
+    QFile file;
+    const uchar *data = nullptr;
+    qint64 dataSize = 0;
+    std::array<std::vector<TelemetryArchiveFormat::DirectoryEntry>, TelemetryChannelCount> directory;
+    QString lastError;
+};
+
+namespace TelemetryArchive {
+
+// Bir .uavrec uçuş kaydını .uavarc arşivine dönüştürür
+bool convertRecording(const QString &recordingPath, const QString &archivePath, QString *error = nullptr);
+
+} // namespace TelemetryArchive
+
+#endif // TELEMETRYARCHIVE_H
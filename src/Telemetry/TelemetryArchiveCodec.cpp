@@ -0,0 +1,299 @@
+#include "TelemetryArchiveCodec.h"
+#include "src/Utils/BitStream.h"
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+std::uint64_t zigzagEncode(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+std::int64_t zigzagDecode(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1u);
+}
+
+int bitsNeeded(std::uint64_t value) {
+    return value == 0 ? 0 : 64 - __builtin_clzll(value);
+}
+
+std::uint64_t doubleBits(double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double bitsDouble(std::uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Delta-of-delta zaman damgaları: düzenli örneklemede çoğu örnek tek bit tutar
+void encodeTimestamps(BitWriter &writer, const std::vector<std::int64_t> &timestamps) {
+    writer.writeBits(static_cast<std::uint64_t>(timestamps[0]), 64);
+
+    std::int64_t previousDelta = 0;
+    for (std::size_t i = 1; i < timestamps.size(); ++i) {
+        const std::int64_t delta = timestamps[i] - timestamps[i - 1];
+        const std::uint64_t dod = zigzagEncode(delta - previousDelta);
+        previousDelta = delta;
+
+        const int width = bitsNeeded(dod);
+        if (dod == 0) {
+            writer.writeBits(0b0, 1);
+        } else if (width <= 8) {
+            writer.writeBits(0b10, 2);
+            writer.writeBits(dod, 8);
+        } else if (width <= 14) {
+            writer.writeBits(0b110, 3);
+            writer.writeBits(dod, 14);
+        } else if (width <= 24) {
+            writer.writeBits(0b1110, 4);
+            writer.writeBits(dod, 24);
+        } else {
+            writer.writeBits(0b1111, 4);
+            writer.writeBits(dod, 64);
+        }
+    }
+}
+
+void decodeTimestamps(BitReader &reader, std::size_t count, std::vector<std::int64_t> &timestamps) {
+    std::int64_t previous = static_cast<std::int64_t>(reader.readBits(64));
+    timestamps.push_back(previous);
+
+    std::int64_t previousDelta = 0;
+    for (std::size_t i = 1; i < count; ++i) {
+        std::uint64_t dod = 0;
+        if (reader.readBit()) {
+            if (!reader.readBit()) {
+                dod = reader.readBits(8);
+            } else if (!reader.readBit()) {
+                dod = reader.readBits(14);
+            } else if (!reader.readBit()) {
+                dod = reader.readBits(24);
+            } else {
+                dod = reader.readBits(64);
+            }
+        }
+
+        previousDelta += zigzagDecode(dod);
+        previous += previousDelta;
+        timestamps.push_back(previous);
+    }
+}
+
+std::uint64_t floatBits(double value) {
+    const float narrowed = static_cast<float>(value);
+    std::uint32_t bits;
+    std::memcpy(&bits, &narrowed, sizeof(bits));
+    return bits;
+}
+
+double bitsFloat(std::uint64_t bits) {
+    const std::uint32_t narrowed = static_cast<std::uint32_t>(bits);
+    float value;
+    std::memcpy(&value, &narrowed, sizeof(value));
+    return value;
+}
+
+// Gorilla XOR: ardışık değerler benzer olduğunda sadece farklı olan anlamlı bitler yazılır.
+// width 64 (double) ya da 32 (MAVSDK'da float olan alanlar) olabilir; float kaynaklı
+// değerler 32 bit üzerinde çalışarak double mantisinin boş bitlerini taşımaz.
+void encodeXor(BitWriter &writer, const std::vector<double> &values, int width) {
+    const auto toBits = width == 64 ? doubleBits : floatBits;
+    const int lengthBits = width == 64 ? 6 : 5;
+
+    std::uint64_t previous = toBits(values[0]);
+    writer.writeBits(previous, width);
+
+    int previousLeading = -1;
+    int previousTrailing = 0;
+    for (std::size_t i = 1; i < values.size(); ++i) {
+        const std::uint64_t current = toBits(values[i]);
+        const std::uint64_t x = current ^ previous;
+        previous = current;
+
+        if (x == 0) {
+            writer.writeBits(0b0, 1);
+            continue;
+        }
+
+        int leading = __builtin_clzll(x) - (64 - width);
+        const int trailing = __builtin_ctzll(x);
+        if (leading > 31) {
+            leading = 31;
+        }
+
+        if (previousLeading >= 0 && leading >= previousLeading && trailing >= previousTrailing) {
+            writer.writeBits(0b10, 2);
+            writer.writeBits(x >> previousTrailing, width - previousLeading - previousTrailing);
+        } else {
+            const int meaningful = width - leading - trailing;
+            writer.writeBits(0b11, 2);
+            writer.writeBits(static_cast<std::uint64_t>(leading), 5);
+            writer.writeBits(static_cast<std::uint64_t>(meaningful) & BitWriter::mask(lengthBits), lengthBits);  // width -> 0
+            writer.writeBits(x >> trailing, meaningful);
+            previousLeading = leading;
+            previousTrailing = trailing;
+        }
+    }
+}
+
+void decodeXor(BitReader &reader, std::size_t count, std::vector<double> &values, int width) {
+    const auto fromBits = width == 64 ? bitsDouble : bitsFloat;
+    const int lengthBits = width == 64 ? 6 : 5;
+
+    std::uint64_t previous = reader.readBits(width);
+    values.push_back(fromBits(previous));
+
+    int previousLeading = 0;
+    int previousTrailing = 0;
+    for (std::size_t i = 1; i < count; ++i) {
+        if (reader.readBit()) {
+            if (reader.readBit()) {
+                previousLeading = static_cast<int>(reader.readBits(5));
+                int meaningful = static_cast<int>(reader.readBits(lengthBits));
+                if (meaningful == 0) {
+                    meaningful = width;
+                }
+                previousTrailing = width - previousLeading - meaningful;
+            }
+            const int meaningful = width - previousLeading - previousTrailing;
+            previous ^= reader.readBits(meaningful) << previousTrailing;
+        }
+        values.push_back(fromBits(previous));
+    }
+}
+
+// Enum sütunları blok içindeki en büyük değere göre seçilen sabit genişlikle paketlenir
+void encodeEnums(BitWriter &writer, const std::vector<double> &values) {
+    std::uint64_t maximum = 0;
+    for (double value : values) {
+        const std::uint64_t encoded = zigzagEncode(std::llround(value));
+        if (encoded > maximum) {
+            maximum = encoded;
+        }
+    }
+
+    const int width = bitsNeeded(maximum);
+    writer.writeBits(static_cast<std::uint64_t>(width), 7);
+    for (double value : values) {
+        writer.writeBits(zigzagEncode(std::llround(value)), width);
+    }
+}
+
+void decodeEnums(BitReader &reader, std::size_t count, std::vector<double> &values) {
+    const int width = static_cast<int>(reader.readBits(7));
+    for (std::size_t i = 0; i < count; ++i) {
+        values.push_back(static_cast<double>(zigzagDecode(reader.readBits(width))));
+    }
+}
+
+template <typename T>
+void appendRaw(std::vector<std::uint8_t> &output, const T &value) {
+    const auto *bytes = reinterpret_cast<const std::uint8_t *>(&value);
+    output.insert(output.end(), bytes, bytes + sizeof(T));
+}
+
+constexpr std::size_t FixedHeaderSize = sizeof(std::uint32_t) + 4;
+
+} // namespace
+
+namespace TelemetryArchiveCodec {
+
+void encodeBlock(const TelemetryChannelInfo &info,
+                 const std::vector<std::int64_t> &timestamps,
+                 const std::vector<std::vector<double>> &columns,
+                 std::vector<std::uint8_t> &output) {
+    const std::size_t count = timestamps.size();
+    const std::size_t columnCount = info.columnCount;
+
+    std::vector<std::uint8_t> stream;
+    std::vector<std::uint32_t> sectionOffsets;
+    sectionOffsets.reserve(columnCount + 1);
+
+    BitWriter writer(stream);
+    if (count > 0) {
+        sectionOffsets.push_back(static_cast<std::uint32_t>(writer.bitCount()));
+        encodeTimestamps(writer, timestamps);
+
+        for (std::size_t c = 0; c < columnCount; ++c) {
+            sectionOffsets.push_back(static_cast<std::uint32_t>(writer.bitCount()));
+            switch (info.kinds[c]) {
+            case TelemetryColumnKind::Enum: encodeEnums(writer, columns[c]); break;
+            case TelemetryColumnKind::Float: encodeXor(writer, columns[c], 32); break;
+            case TelemetryColumnKind::Double: encodeXor(writer, columns[c], 64); break;
+            }
+        }
+    }
+    writer.flush();
+    sectionOffsets.resize(columnCount + 1, 0);
+
+    appendRaw(output, static_cast<std::uint32_t>(count));
+    output.push_back(static_cast<std::uint8_t>(columnCount));
+    output.insert(output.end(), 3, 0);
+    for (std::uint32_t offset : sectionOffsets) {
+        appendRaw(output, offset);
+    }
+    output.insert(output.end(), stream.begin(), stream.end());
+}
+
+bool decodeBlock(const TelemetryChannelInfo &info,
+                 const std::uint8_t *data, std::size_t size,
+                 std::uint32_t columnMask,
+                 std::vector<std::int64_t> &timestamps,
+                 std::vector<std::vector<double>> &columns) {
+    if (size < FixedHeaderSize) {
+        return false;
+    }
+
+    std::uint32_t count;
+    std::memcpy(&count, data, sizeof(count));
+    const std::size_t columnCount = data[sizeof(count)];
+    if (columnCount != info.columnCount) {
+        return false;
+    }
+
+    const std::size_t headerSize = FixedHeaderSize + (columnCount + 1) * sizeof(std::uint32_t);
+    if (size < headerSize) {
+        return false;
+    }
+
+    std::vector<std::uint32_t> sectionOffsets(columnCount + 1);
+    std::memcpy(sectionOffsets.data(), data + FixedHeaderSize, sectionOffsets.size() * sizeof(std::uint32_t));
+
+    const std::uint8_t *stream = data + headerSize;
+    const std::size_t streamSize = size - headerSize;
+
+    columns.resize(columnCount);
+    if (count == 0) {
+        return true;
+    }
+
+    BitReader timestampReader(stream, streamSize, sectionOffsets[0]);
+    decodeTimestamps(timestampReader, count, timestamps);
+    if (timestampReader.hasOverrun()) {
+        return false;
+    }
+
+    for (std::size_t c = 0; c < columnCount; ++c) {
+        if ((columnMask & (1u << c)) == 0) {
+            continue;
+        }
+
+        BitReader reader(stream, streamSize, sectionOffsets[c + 1]);
+        switch (info.kinds[c]) {
+        case TelemetryColumnKind::Enum: decodeEnums(reader, count, columns[c]); break;
+        case TelemetryColumnKind::Float: decodeXor(reader, count, columns[c], 32); break;
+        case TelemetryColumnKind::Double: decodeXor(reader, count, columns[c], 64); break;
+        }
+        if (reader.hasOverrun()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace TelemetryArchiveCodec
@@ -0,0 +1,35 @@
+#ifndef TELEMETRYARCHIVECODEC_H
+#define TELEMETRYARCHIVECODEC_H
+
+#include "src/Telemetry/TelemetryChannel.h"
+#include <cstdint>
+#include <vector>
+
+// Telemetri arşivindeki tek bir kanal bloğunun sıkıştırılması.
+//
+// Blok düzeni:
+//   u32 sampleCount | u8 columnCount | u8[3] | u32 sectionBitOffset[columnCount + 1] | bit akışı
+//
+// Bit akışında önce zaman damgaları (delta-of-delta), sonra her sütun ayrı bir bölüm
+// olarak yer alır: Float/Double sütunlar Gorilla tarzı XOR, Enum sütunlar blok başına
+// seçilen bit genişliğiyle paketlenir. Bölüm ofsetleri sayesinde istenmeyen
+// sütunlar çözülmeden atlanır.
+namespace TelemetryArchiveCodec {
+
+// columns[c][i]: c sütununun i. örneği. Her sütunda timestamps ile aynı sayıda örnek olmalı.
+void encodeBlock(const TelemetryChannelInfo &info,
+                 const std::vector<std::int64_t> &timestamps,
+                 const std::vector<std::vector<double>> &columns,
+                 std::vector<std::uint8_t> &output);
+
+// columnMask'taki sütunları çözer (bit c = sütun c). İstenmeyen sütunlar boş bırakılır.
+// Çıktılar mevcut içeriğin sonuna eklenir.
+bool decodeBlock(const TelemetryChannelInfo &info,
+                 const std::uint8_t *data, std::size_t size,
+                 std::uint32_t columnMask,
+                 std::vector<std::int64_t> &timestamps,
+                 std::vector<std::vector<double>> &columns);
+
+} // namespace TelemetryArchiveCodec
+
+#endif // TELEMETRYARCHIVECODEC_H
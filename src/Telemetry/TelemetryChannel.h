@@ -0,0 +1,60 @@
+#ifndef TELEMETRYCHANNEL_H
+#define TELEMETRYCHANNEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Geçmişi tutulan telemetri kanalları. Her kanal bir MAVSDK akışına karşılık gelir
+// ve sabit sayıda sayısal sütundan oluşur.
+enum class TelemetryChannel : std::uint8_t {
+    Position,
+    Heading,
+    Attitude,
+    FixedwingMetrics,
+    FlightMode,
+    GpsInfo,
+    Battery,
+    Armed,
+    TotalSpeed,
+    RcStatus,
+
+    Count
+};
+
+constexpr std::size_t TelemetryChannelCount = static_cast<std::size_t>(TelemetryChannel::Count);
+constexpr std::size_t TelemetryChannelMaxColumns = 4;
+
+// Sütun türü: MAVSDK'da float olan değerler Float, double olanlar (enlem/boylam) Double,
+// durum/enum değerleri Enum olarak yorumlanır. Arşiv formatı sıkıştırmayı buna göre seçer.
+enum class TelemetryColumnKind : std::uint8_t {
+    Float,
+    Double,
+    Enum
+};
+
+struct TelemetryChannelInfo {
+    const char *name;
+    std::size_t columnCount;
+    const char *columns[TelemetryChannelMaxColumns];
+    TelemetryColumnKind kinds[TelemetryChannelMaxColumns];
+    int defaultRateHz;  // Bellek ön ayırma için beklenen örnekleme hızı
+};
+
+inline const TelemetryChannelInfo &telemetryChannelInfo(TelemetryChannel channel) {
+    using K = TelemetryColumnKind;
+    static const TelemetryChannelInfo infos[TelemetryChannelCount] = {
+        {"position", 4, {"latitude_deg", "longitude_deg", "absolute_altitude_m", "relative_altitude_m"}, {K::Double, K::Double, K::Float, K::Float}, 10},
+        {"heading", 1, {"heading_deg"}, {K::Double}, 10},
+        {"attitude", 3, {"roll_deg", "pitch_deg", "yaw_deg"}, {K::Float, K::Float, K::Float}, 50},
+        {"fixedwing_metrics", 3, {"airspeed_m_s", "throttle_percentage", "climb_rate_m_s"}, {K::Float, K::Float, K::Float}, 10},
+        {"flight_mode", 1, {"flight_mode"}, {K::Enum}, 1},
+        {"gps_info", 2, {"num_satellites", "fix_type"}, {K::Enum, K::Enum}, 1},
+        {"battery", 2, {"voltage_v", "remaining_percent"}, {K::Float, K::Float}, 1},
+        {"armed", 1, {"armed"}, {K::Enum}, 1},
+        {"total_speed", 1, {"speed_m_s"}, {K::Double}, 10},
+        {"rc_status", 1, {"signal_strength_percent"}, {K::Float}, 1},
+    };
+    return infos[static_cast<std::size_t>(channel)];
+}
+
+#endif // TELEMETRYCHANNEL_H
@@ -1,17 +1,32 @@
 #include "TelemetryHandler.h"
 #include "qdebug.h"
 #include "src/Utils/Logger.h"
+#include <QGuiApplication>
+#include <QScreen>
 #include <cmath>
+#include <cstring>
 
 // Constructor
 TelemetryHandler::TelemetryHandler(std::shared_ptr<mavsdk::Telemetry> telemetry, QObject *parent)
-    : QObject(parent), telemetry(std::move(telemetry)) {
+    : QObject(parent), telemetry(std::move(telemetry)), dispatchTimer(new QTimer(this)),
+    subscriptions(new TelemetrySubscriptionRegistry(this)),
+    timeSeries(std::make_unique<TelemetryTimeSeries>()) {
+    // Zamanlayıcı GUI thread'inde yaşar; callback'ler sadece kirli bitleri işaretler
+    dispatchTimer->setSingleShot(true);
+    dispatchTimer->setTimerType(Qt::PreciseTimer);
+    connect(dispatchTimer, &QTimer::timeout, this, &TelemetryHandler::dispatchSnapshot);
+
     Logger::instance().log("TelemetryHandler başlatıldı", INFO);  // Log: Başlatıldı
 }
 
 // Destructor
 TelemetryHandler::~TelemetryHandler() {
-    Logger::instance().log("TelemetryHandler sonlandırıldı", INFO);  // Log: Sonlandırıldı
+    // MAVSDK callback'leri bu nesneye erişmeden önce kesilir
+    stop();
+    recorder.stop();
+    Logger::instance().log("TelemetryHandler sonlandırıldı. Alınan güncelleme: " + QString::number(getReceivedUpdateCount()) +
+                               ", GUI karesi: " + QString::number(getDispatchedFrameCount()) +
+                               ", birleştirilen: " + QString::number(getCoalescedUpdateCount()), INFO);  // Log: Sonlandırıldı
 }
 
 // Telemetry verilerini başlat
@@ -35,132 +50,470 @@ void TelemetryHandler::start() {
     subscribeTotalSpeed();
     subscribeHealth(); // Sağlık durumu aboneliği
     subscribeConnnectionState();
-    subscribeLog();
+    subscribed = true;
+}
+
+void TelemetryHandler::stop() {
+    if (!subscribed || !telemetry) {
+        return;
+    }
+    subscribed = false;
+
+    telemetry->unsubscribe_position(handles.position);
+    telemetry->unsubscribe_heading(handles.heading);
+    telemetry->unsubscribe_attitude_euler(handles.attitude);
+    telemetry->unsubscribe_fixedwing_metrics(handles.fixedwingMetrics);
+    telemetry->unsubscribe_flight_mode(handles.flightMode);
+    telemetry->unsubscribe_gps_info(handles.gpsInfo);
+    telemetry->unsubscribe_battery(handles.battery);
+    telemetry->unsubscribe_armed(handles.armed);
+    telemetry->unsubscribe_velocity_ned(handles.velocityNed);
+    telemetry->unsubscribe_health(handles.health);
+    telemetry->unsubscribe_rc_status(handles.rcStatus);
+}
+
+void TelemetryHandler::rebind(std::shared_ptr<mavsdk::Telemetry> newTelemetry) {
+    const bool wasSubscribed = subscribed;
+    stop();
+    telemetry = std::move(newTelemetry);
+    if (wasSubscribed) {
+        start();
+    }
+    Logger::instance().log("TelemetryHandler yeni bağlantıya bağlandı", INFO);
 }
 
 // Getter fonksiyonları
 mavsdk::Telemetry::Position TelemetryHandler::getPosition() const {
-    return position;
+    return getSnapshot().position;
 }
 
 mavsdk::Telemetry::Heading TelemetryHandler::getHeading() const {
-    return heading;
+    return getSnapshot().heading;
 }
 
 mavsdk::Telemetry::EulerAngle TelemetryHandler::getAttitude() const {
-    return attitude;
+    return getSnapshot().attitude;
 }
 
 mavsdk::Telemetry::FixedwingMetrics TelemetryHandler::getFixedwingMetrics() const {
-    return fixedwingMetrics;
+    return getSnapshot().fixedwingMetrics;
 }
 
 QString TelemetryHandler::getFlightMode() const {
-    return flightMode;
+    return flightModeToString(getSnapshot().flightMode);
 }
 
 mavsdk::Telemetry::GpsInfo TelemetryHandler::getGpsInfo() const {
-    return gpsInfo;
+    return getSnapshot().gpsInfo;
 }
 
 mavsdk::Telemetry::Battery TelemetryHandler::getBattery() const {
-    return battery;
+    return getSnapshot().battery;
 }
 
 bool TelemetryHandler::isArmed() const {
-    return armed;
+    return getSnapshot().armed;
 }
 
 double TelemetryHandler::getTotalSpeed() const {
-    return totalSpeed;
+    return getSnapshot().totalSpeed;
 }
 
 mavsdk::Telemetry::Health TelemetryHandler::getHealth() const {
-    return health;
+    return getSnapshot().health;
 }
 
 mavsdk::Telemetry::RcStatus TelemetryHandler::getRcStatus() const {
-    return rcStatus;
+    return getSnapshot().rcStatus;
+}
+
+TelemetrySnapshot TelemetryHandler::getSnapshot() const {
+    return snapshot.load();
+}
+
+void TelemetryHandler::setMaxDispatchRate(int hz) {
+    maxDispatchRate = hz;
+
+    int rate = hz;
+    if (rate <= 0) {
+        // vsync: birincil ekranın yenileme hızına kilitlen
+        QScreen *screen = QGuiApplication::primaryScreen();
+        rate = screen ? qRound(screen->refreshRate()) : 60;
+    }
+    dispatchIntervalMs = qMax(1, 1000 / qMax(1, rate));
+}
+
+int TelemetryHandler::getMaxDispatchRate() const {
+    return maxDispatchRate;
+}
+
+TelemetrySubscriptionRegistry::SubscriptionId TelemetryHandler::subscribe(quint32 fields, int maxRateHz, QObject *context,
+                                                                         TelemetrySubscriptionRegistry::Callback callback) {
+    return subscriptions->subscribe(fields, maxRateHz, context, std::move(callback));
+}
+
+void TelemetryHandler::unsubscribe(TelemetrySubscriptionRegistry::SubscriptionId id) {
+    subscriptions->unsubscribe(id);
+}
+
+void TelemetryHandler::setTimeSeriesConfig(const TelemetryTimeSeries::Config &config) {
+    // Tamponlar önceden ayrıldığı için sadece abonelikler başlamadan değiştirilebilir
+    timeSeries = std::make_unique<TelemetryTimeSeries>(config);
+    Logger::instance().log("Telemetri geçmişi " + QString::number(config.retention.count()) + " sn için ayrıldı (" +
+                               QString::number(timeSeries->memoryUsage() / 1024) + " KB)", INFO);
+}
+
+const TelemetryTimeSeries &TelemetryHandler::getTimeSeries() const {
+    return *timeSeries;
+}
+
+bool TelemetryHandler::startRecording(const QString &filePath) {
+    return recorder.start(filePath);
+}
+
+void TelemetryHandler::stopRecording() {
+    recorder.stop();
+}
+
+const FlightRecorder &TelemetryHandler::getRecorder() const {
+    return recorder;
+}
+
+const TelemetryStatistics &TelemetryHandler::getStatistics() const {
+    return statistics;
+}
+
+void TelemetryHandler::resetStatistics() {
+    statistics.reset();
+    Logger::instance().log("Telemetri istatistikleri sıfırlandı", INFO);
+}
+
+void TelemetryHandler::addDerivedMetric(std::unique_ptr<DerivedMetric> metric) {
+    derivedMetrics.addMetric(std::move(metric));
+}
+
+void TelemetryHandler::setTarget(double latitudeDeg, double longitudeDeg) {
+    updateField(TelemetryField::Target, TelemetryTimeSeries::now(), [&](TelemetrySnapshot &s) {
+        s.targetLatitudeDeg = latitudeDeg;
+        s.targetLongitudeDeg = longitudeDeg;
+    });
+}
+
+void TelemetryHandler::clearTarget() {
+    setTarget(DerivedTelemetry::NaN, DerivedTelemetry::NaN);
+}
+
+quint64 TelemetryHandler::getReceivedUpdateCount() const {
+    return receivedUpdates.load(std::memory_order_relaxed);
+}
+
+quint64 TelemetryHandler::getDispatchedFrameCount() const {
+    return dispatchedFrames.load(std::memory_order_relaxed);
+}
+
+quint64 TelemetryHandler::getCoalescedUpdateCount() const {
+    const quint64 received = getReceivedUpdateCount();
+    const quint64 dispatched = getDispatchedFrameCount();
+    return received > dispatched ? received - dispatched : 0;
+}
+
+
+
+// MAVSDK callback thread'inde çalışır: alanı günceller ve kirli olarak işaretler.
+// Türetilmiş metrikler aynı yazma içinde güncellenir, okuyucu girdiyle tutarsız çıktı görmez.
+// Sadece ilk kirli alan GUI thread'ine bir dağıtım isteği gönderir, diğerleri ona katılır.
+template <typename Mutator>
+void TelemetryHandler::updateField(quint32 field, std::int64_t timestampUs, Mutator &&mutate) {
+    bool derivedChanged = false;
+    snapshot.write([&](TelemetrySnapshot &s) {
+        mutate(s);
+        derivedChanged = derivedMetrics.update(s, field, timestampUs);
+    });
+
+    receivedUpdates.fetch_add(1, std::memory_order_relaxed);
+
+    const quint32 changed = field | (derivedChanged ? quint32(TelemetryField::Derived) : 0u);
+    if (dirtyFields.fetch_or(changed, std::memory_order_acq_rel) == 0) {
+        QMetaObject::invokeMethod(this, &TelemetryHandler::scheduleDispatch, Qt::QueuedConnection);
+    }
+}
+
+// GUI thread'inde çalışır: son dağıtımdan bu yana aralık dolduysa hemen, dolmadıysa kalan sürede gönderir
+void TelemetryHandler::scheduleDispatch() {
+    if (dispatchTimer->isActive()) {
+        return;
+    }
+
+    const qint64 elapsed = lastDispatch.isValid() ? lastDispatch.elapsed() : dispatchIntervalMs;
+    if (elapsed >= dispatchIntervalMs) {
+        dispatchSnapshot();
+    } else {
+        dispatchTimer->start(static_cast<int>(dispatchIntervalMs - elapsed));
+    }
+}
+
+void TelemetryHandler::dispatchSnapshot() {
+    const quint32 changedFields = dirtyFields.exchange(0, std::memory_order_acq_rel);
+    if (changedFields == 0) {
+        return;
+    }
+
+    const TelemetrySnapshot current = getSnapshot();
+    lastDispatch.start();
+    dispatchedFrames.fetch_add(1, std::memory_order_relaxed);
+
+    subscriptions->publish(current, changedFields);
+
+    emit telemetrySnapshotUpdated(current, changedFields);
+    emit telemetryDataUpdated();
+}
+
+
+// Sayısal örnek hem geçmişe hem akan istatistiklere eklenir
+void TelemetryHandler::appendSample(TelemetryChannel channel, std::int64_t timestampUs, std::initializer_list<double> values) {
+    timeSeries->append(channel, timestampUs, values);
+    statistics.add(channel, values);
+}
+
+
+// Her akış için tek giriş noktası: snapshot, geçmiş ve uçuş kaydı aynı örnekle güncellenir
+void TelemetryHandler::ingestPosition(std::int64_t timestampUs, const mavsdk::Telemetry::Position &pos) {
+    updateField(TelemetryField::Position, timestampUs, [&](TelemetrySnapshot &s) { s.position = pos; });
+    appendSample(TelemetryChannel::Position, timestampUs,
+                       {pos.latitude_deg, pos.longitude_deg, pos.absolute_altitude_m, pos.relative_altitude_m});
+    recorder.record(TelemetryRecord::Type::Position, timestampUs, pos);
+}
+
+void TelemetryHandler::ingestHeading(std::int64_t timestampUs, const mavsdk::Telemetry::Heading &head) {
+    updateField(TelemetryField::Heading, timestampUs, [&](TelemetrySnapshot &s) { s.heading = head; });
+    appendSample(TelemetryChannel::Heading, timestampUs, {head.heading_deg});
+    recorder.record(TelemetryRecord::Type::Heading, timestampUs, head);
+}
+
+void TelemetryHandler::ingestAttitude(std::int64_t timestampUs, const mavsdk::Telemetry::EulerAngle &att) {
+    updateField(TelemetryField::Attitude, timestampUs, [&](TelemetrySnapshot &s) { s.attitude = att; });
+    appendSample(TelemetryChannel::Attitude, timestampUs, {att.roll_deg, att.pitch_deg, att.yaw_deg});
+    recorder.record(TelemetryRecord::Type::Attitude, timestampUs, att);
+}
+
+void TelemetryHandler::ingestFixedwingMetrics(std::int64_t timestampUs, const mavsdk::Telemetry::FixedwingMetrics &metrics) {
+    updateField(TelemetryField::FixedwingMetrics, timestampUs, [&](TelemetrySnapshot &s) { s.fixedwingMetrics = metrics; });
+    appendSample(TelemetryChannel::FixedwingMetrics, timestampUs,
+                       {metrics.airspeed_m_s, metrics.throttle_percentage, metrics.climb_rate_m_s});
+    recorder.record(TelemetryRecord::Type::FixedwingMetrics, timestampUs, metrics);
+}
+
+void TelemetryHandler::ingestFlightMode(std::int64_t timestampUs, mavsdk::Telemetry::FlightMode mode) {
+    updateField(TelemetryField::FlightMode, timestampUs, [&](TelemetrySnapshot &s) { s.flightMode = mode; });
+    appendSample(TelemetryChannel::FlightMode, timestampUs, {static_cast<double>(mode)});
+    recorder.record(TelemetryRecord::Type::FlightMode, timestampUs, mode);
+}
+
+void TelemetryHandler::ingestGpsInfo(std::int64_t timestampUs, const mavsdk::Telemetry::GpsInfo &info) {
+    updateField(TelemetryField::GpsInfo, timestampUs, [&](TelemetrySnapshot &s) { s.gpsInfo = info; });
+    appendSample(TelemetryChannel::GpsInfo, timestampUs,
+                       {static_cast<double>(info.num_satellites), static_cast<double>(info.fix_type)});
+    recorder.record(TelemetryRecord::Type::GpsInfo, timestampUs, info);
+}
+
+void TelemetryHandler::ingestBattery(std::int64_t timestampUs, const mavsdk::Telemetry::Battery &batt) {
+    updateField(TelemetryField::Battery, timestampUs, [&](TelemetrySnapshot &s) { s.battery = batt; });
+    appendSample(TelemetryChannel::Battery, timestampUs, {batt.voltage_v, batt.remaining_percent});
+    recorder.record(TelemetryRecord::Type::Battery, timestampUs, batt);
+}
+
+void TelemetryHandler::ingestArmed(std::int64_t timestampUs, bool armStatus) {
+    // Her arm yeni bir uçuş: istatistikler bu uçuşu yansıtsın
+    if (armStatus && !statisticsArmed) {
+        statistics.reset();
+    }
+    statisticsArmed = armStatus;
+
+    updateField(TelemetryField::Armed, timestampUs, [&](TelemetrySnapshot &s) { s.armed = armStatus; });
+    appendSample(TelemetryChannel::Armed, timestampUs, {armStatus ? 1.0 : 0.0});
+    recorder.record(TelemetryRecord::Type::Armed, timestampUs, armStatus);
+}
+
+void TelemetryHandler::ingestVelocityNed(std::int64_t timestampUs, const mavsdk::Telemetry::VelocityNed &velocityNed) {
+    const double speed = std::sqrt(
+        velocityNed.north_m_s * velocityNed.north_m_s +
+        velocityNed.east_m_s * velocityNed.east_m_s +
+        velocityNed.down_m_s * velocityNed.down_m_s
+        );
+    updateField(TelemetryField::TotalSpeed, timestampUs, [&](TelemetrySnapshot &s) {
+        s.velocityNed = velocityNed;
+        s.totalSpeed = speed;
+    });
+    appendSample(TelemetryChannel::TotalSpeed, timestampUs, {speed});
+    recorder.record(TelemetryRecord::Type::VelocityNed, timestampUs, velocityNed);
+}
+
+void TelemetryHandler::ingestHealth(std::int64_t timestampUs, const mavsdk::Telemetry::Health &healthData) {
+    updateField(TelemetryField::Health, timestampUs, [&](TelemetrySnapshot &s) { s.health = healthData; });
+    recorder.record(TelemetryRecord::Type::Health, timestampUs, healthData);
+}
+
+void TelemetryHandler::ingestRcStatus(std::int64_t timestampUs, const mavsdk::Telemetry::RcStatus &rcStatus) {
+    updateField(TelemetryField::RcStatus, timestampUs, [&](TelemetrySnapshot &s) { s.rcStatus = rcStatus; });
+    appendSample(TelemetryChannel::RcStatus, timestampUs, {rcStatus.signal_strength_percent});
+    recorder.record(TelemetryRecord::Type::RcStatus, timestampUs, rcStatus);
+}
+
+
+
+namespace {
+template <typename T>
+bool readPayload(const void *payload, std::size_t size, T &value) {
+    if (size != sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, payload, sizeof(T));
+    return true;
+}
+}
+
+bool TelemetryHandler::ingestRecord(TelemetryRecord::Type type, std::int64_t timestampUs, const void *payload, std::size_t size) {
+    using Type = TelemetryRecord::Type;
+    switch (type) {
+    case Type::Position: {
+        mavsdk::Telemetry::Position value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestPosition(timestampUs, value);
+        return true;
+    }
+    case Type::Heading: {
+        mavsdk::Telemetry::Heading value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestHeading(timestampUs, value);
+        return true;
+    }
+    case Type::Attitude: {
+        mavsdk::Telemetry::EulerAngle value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestAttitude(timestampUs, value);
+        return true;
+    }
+    case Type::FixedwingMetrics: {
+        mavsdk::Telemetry::FixedwingMetrics value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestFixedwingMetrics(timestampUs, value);
+        return true;
+    }
+    case Type::FlightMode: {
+        mavsdk::Telemetry::FlightMode value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestFlightMode(timestampUs, value);
+        return true;
+    }
+    case Type::GpsInfo: {
+        mavsdk::Telemetry::GpsInfo value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestGpsInfo(timestampUs, value);
+        return true;
+    }
+    case Type::Battery: {
+        mavsdk::Telemetry::Battery value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestBattery(timestampUs, value);
+        return true;
+    }
+    case Type::Armed: {
+        bool value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestArmed(timestampUs, value);
+        return true;
+    }
+    case Type::VelocityNed: {
+        mavsdk::Telemetry::VelocityNed value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestVelocityNed(timestampUs, value);
+        return true;
+    }
+    case Type::Health: {
+        mavsdk::Telemetry::Health value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestHealth(timestampUs, value);
+        return true;
+    }
+    case Type::RcStatus: {
+        mavsdk::Telemetry::RcStatus value;
+        if (!readPayload(payload, size, value)) return false;
+        ingestRcStatus(timestampUs, value);
+        return true;
+    }
+    }
+    return false;
 }
 
-std::pair<QString, mavsdk::log::Level> TelemetryHandler::getLastLog() const {
-    return {lastLogMessage, lastLogLevel};
+void TelemetryHandler::resetHistory() {
+    timeSeries->clear();
+    statistics.reset();
+    snapshot.write([&](TelemetrySnapshot &s) { derivedMetrics.reset(s); });
+    if (dirtyFields.fetch_or(TelemetryField::Derived, std::memory_order_acq_rel) == 0) {
+        QMetaObject::invokeMethod(this, &TelemetryHandler::scheduleDispatch, Qt::QueuedConnection);
+    }
 }
 
 
 
 // Telemetry verileri için abonelik fonksiyonları
 void TelemetryHandler::subscribePosition() {
-    telemetry->subscribe_position([this](const mavsdk::Telemetry::Position &pos) {
-        position = pos;
-        emit telemetryDataUpdated();
+    handles.position = telemetry->subscribe_position([this](const mavsdk::Telemetry::Position &pos) {
+        ingestPosition(TelemetryTimeSeries::now(), pos);
     });
 }
 
 void TelemetryHandler::subscribeheading() {
-    telemetry->subscribe_heading([this](const mavsdk::Telemetry::Heading &head) {
-        heading = head;
-        emit telemetryDataUpdated();
+    handles.heading = telemetry->subscribe_heading([this](const mavsdk::Telemetry::Heading &head) {
+        ingestHeading(TelemetryTimeSeries::now(), head);
     });
 }
 
 void TelemetryHandler::subscribeAttitude() {
-    telemetry->subscribe_attitude_euler([this](const mavsdk::Telemetry::EulerAngle &att) {
-        attitude = att;
-        emit telemetryDataUpdated();
+    handles.attitude = telemetry->subscribe_attitude_euler([this](const mavsdk::Telemetry::EulerAngle &att) {
+        ingestAttitude(TelemetryTimeSeries::now(), att);
     });
 }
 
 void TelemetryHandler::subscribeFixedwingMetrics() {
-    telemetry->subscribe_fixedwing_metrics([this](const mavsdk::Telemetry::FixedwingMetrics &metrics) {
-        fixedwingMetrics = metrics;
-        emit telemetryDataUpdated();
+    handles.fixedwingMetrics = telemetry->subscribe_fixedwing_metrics([this](const mavsdk::Telemetry::FixedwingMetrics &metrics) {
+        ingestFixedwingMetrics(TelemetryTimeSeries::now(), metrics);
     });
 }
 
 void TelemetryHandler::subscribeFlightMode() {
-    telemetry->subscribe_flight_mode([this](mavsdk::Telemetry::FlightMode mode) {
-        flightMode = flightModeToString(mode);
-        emit telemetryDataUpdated();
+    handles.flightMode = telemetry->subscribe_flight_mode([this](mavsdk::Telemetry::FlightMode mode) {
+        ingestFlightMode(TelemetryTimeSeries::now(), mode);
     });
 }
 
 void TelemetryHandler::subscribeGpsInfo() {
-    telemetry->subscribe_gps_info([this](const mavsdk::Telemetry::GpsInfo &info) {
-        gpsInfo = info;
-        emit telemetryDataUpdated();
+    handles.gpsInfo = telemetry->subscribe_gps_info([this](const mavsdk::Telemetry::GpsInfo &info) {
+        ingestGpsInfo(TelemetryTimeSeries::now(), info);
     });
 }
 
 void TelemetryHandler::subscribeBattery() {
-    telemetry->subscribe_battery([this](const mavsdk::Telemetry::Battery &batt) {
-        battery = batt;
-        emit telemetryDataUpdated();
+    handles.battery = telemetry->subscribe_battery([this](const mavsdk::Telemetry::Battery &batt) {
+        ingestBattery(TelemetryTimeSeries::now(), batt);
     });
 }
 
 void TelemetryHandler::subscribeArmed() {
-    telemetry->subscribe_armed([this](bool arm_status) {
-        armed = arm_status;
-        emit telemetryDataUpdated();
+    handles.armed = telemetry->subscribe_armed([this](bool arm_status) {
+        ingestArmed(TelemetryTimeSeries::now(), arm_status);
     });
 }
 
 void TelemetryHandler::subscribeTotalSpeed() {
-    telemetry->subscribe_velocity_ned([this](const mavsdk::Telemetry::VelocityNed &velocityNed) {
-        totalSpeed = std::sqrt(
-            velocityNed.north_m_s * velocityNed.north_m_s +
-            velocityNed.east_m_s * velocityNed.east_m_s +
-            velocityNed.down_m_s * velocityNed.down_m_s
-            );
-        emit telemetryDataUpdated();
+    handles.velocityNed = telemetry->subscribe_velocity_ned([this](const mavsdk::Telemetry::VelocityNed &velocityNed) {
+        ingestVelocityNed(TelemetryTimeSeries::now(), velocityNed);
     });
 }
 
 void TelemetryHandler::subscribeHealth() {
-    telemetry->subscribe_health([this](const mavsdk::Telemetry::Health& healthData) {
-        health = healthData;
-        emit telemetryDataUpdated();
+    handles.health = telemetry->subscribe_health([this](const mavsdk::Telemetry::Health& healthData) {
+        ingestHealth(TelemetryTimeSeries::now(), healthData);
     });
 }
 
@@ -168,39 +521,9 @@ void TelemetryHandler::subscribeHealth() {
 
 // USB telemetry dene, simülasyonda is_available hep false geliyor
 void TelemetryHandler::subscribeConnnectionState() {
-    telemetry->subscribe_rc_status([this](mavsdk::Telemetry::RcStatus rc_status) {
-
-
-        if (rc_status.is_available) {
-            emit telemetryDataUpdated();
-        } else {
-
-        }
-    });
-}
-
-void TelemetryHandler::subscribeLog() {
-
-    mavsdk::log::subscribe([this](mavsdk::log::Level level,   // message severity level
-                              const std::string& message, // message text
-                              const std::string& file,    // source file from which the message was sent
-                              int line) {                 // line number in the source file
-        // process the log message in a way you like
-
-
-
-        // Mesajı QString'e çevir ve kaydet
-        lastLogMessage = QString::fromStdString(message);
-        lastLogLevel = level;
-
-        Logger::instance().log("MAVSDK: " + lastLogMessage, level);
-
-        emit UavLogDataUpdated();
-
-        // returning true from the callback disables printing the message to stdout
-        return true;
+    handles.rcStatus = telemetry->subscribe_rc_status([this](mavsdk::Telemetry::RcStatus rc_status) {
+        ingestRcStatus(TelemetryTimeSeries::now(), rc_status);
     });
-
 }
 
 
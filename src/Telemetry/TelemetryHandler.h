@@ -1,10 +1,19 @@
 #ifndef TELEMETRYHANDLER_H
 #define TELEMETRYHANDLER_H
 
+#include "src/Telemetry/DerivedMetrics.h"
+#include "src/Telemetry/FlightRecorder.h"
+#include "src/Telemetry/TelemetrySnapshot.h"
+#include "src/Telemetry/TelemetryStatistics.h"
+#include "src/Telemetry/TelemetrySubscriptionRegistry.h"
+#include "src/Telemetry/TelemetryTimeSeries.h"
+#include "src/Utils/SeqLock.h"
 #include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
 #include <mavsdk/plugins/telemetry/telemetry.h>
+#include <atomic>
 #include <memory>
-#include <mavsdk/log_callback.h>
 
 // TelemetryHandler sınıfı
 class TelemetryHandler : public QObject {
@@ -15,9 +24,15 @@ public:
     explicit TelemetryHandler(std::shared_ptr<mavsdk::Telemetry> telemetry, QObject *parent = nullptr);
     ~TelemetryHandler();
 
-    // Telemetry verilerini başlat
+    // Telemetry verilerini başlat. start/stop/rebind kilitsizdir, sadece GUI thread'inden çağrılır.
     void start();
 
+    // MAVSDK aboneliklerini kaldırır; snapshot, geçmiş ve kayıt korunur
+    void stop();
+
+    // Link değişiminde aynı aracın başka bir bağlantıdaki Telemetry plugin'ine geçer
+    void rebind(std::shared_ptr<mavsdk::Telemetry> newTelemetry);
+
     // Getter fonksiyonları
     mavsdk::Telemetry::Heading getHeading() const;
     mavsdk::Telemetry::Position getPosition() const;
@@ -30,33 +45,118 @@ public:
     double getTotalSpeed() const;
     mavsdk::Telemetry::Health getHealth() const;  // Sağlık durumu getter'ı
     mavsdk::Telemetry::RcStatus getRcStatus() const;
-    std::pair<QString, mavsdk::log::Level> getLastLog() const; // Tek fonksiyonla hem mesaj hem seviyeyi almak
+
+    // Tüm alanların tutarlı bir kopyası (kilitsiz, her thread'den çağrılabilir)
+    TelemetrySnapshot getSnapshot() const;
+
+    static QString flightModeToString(mavsdk::Telemetry::FlightMode mode);
+
+    // GUI'ye dağıtım hızının üst sınırı (Hz). 0 verilirse ekran yenileme hızı (vsync) kullanılır.
+    void setMaxDispatchRate(int hz);
+    int getMaxDispatchRate() const;
+
+    // Alan bazlı abonelik: tüketici sadece fields maskesindeki alanlar değiştiğinde,
+    // en fazla maxRateHz hızında ve sadece değişen alanların maskesiyle uyandırılır.
+    TelemetrySubscriptionRegistry::SubscriptionId subscribe(quint32 fields, int maxRateHz, QObject *context,
+                                                            TelemetrySubscriptionRegistry::Callback callback);
+    void unsubscribe(TelemetrySubscriptionRegistry::SubscriptionId id);
+
+    // Kanal bazlı bellek sınırlı geçmiş. Config sadece start() çağrılmadan önce değiştirilebilir.
+    void setTimeSeriesConfig(const TelemetryTimeSeries::Config &config);
+    const TelemetryTimeSeries &getTimeSeries() const;
+
+    // Kanal sütunları için uçuş boyu istatistik (min/max/ortalama/std/yüzdelik).
+    // Her arm'da otomatik sıfırlanır; görev bacağı başında elle de sıfırlanabilir.
+    const TelemetryStatistics &getStatistics() const;
+    void resetStatistics();
+
+    // Türetilmiş metrikler snapshot.derived içinde yayınlanır. Ek metrikler sadece
+    // start() çağrılmadan önce eklenebilir.
+    void addDerivedMetric(std::unique_ptr<DerivedMetric> metric);
+
+    // Hedef noktaya mesafe/kerteriz hesabı için (her thread'den çağrılabilir)
+    void setTarget(double latitudeDeg, double longitudeDeg);
+    void clearTarget();
+
+    // Kayıttan okunan ham bir örneği canlı callback'lerle aynı yoldan işler (replay).
+    // Payload boyutu beklenen struct ile uyuşmazsa örnek atlanır ve false döner.
+    bool ingestRecord(TelemetryRecord::Type type, std::int64_t timestampUs, const void *payload, std::size_t size);
+    // Replay kaydın geri bir noktasına atlarken geçmiş, istatistik ve türetilmiş metrik durumunu sıfırlar.
+    // ingestRecord ile aynı thread'den çağrılır.
+    void resetHistory();
+
+    // Tüm akışların ikili uçuş kaydı (.uavrec)
+    bool startRecording(const QString &filePath);
+    void stopRecording();
+    const FlightRecorder &getRecorder() const;
+
+    // Birleştirme istatistikleri
+    quint64 getReceivedUpdateCount() const;   // MAVSDK'dan gelen toplam güncelleme
+    quint64 getDispatchedFrameCount() const;  // GUI'ye gönderilen snapshot sayısı
+    quint64 getCoalescedUpdateCount() const;  // Birleştirilerek GUI'ye ayrıca yansıtılmayan güncelleme
 
 signals:
     // Sinyaller
     void telemetryDataUpdated();
-    void UavLogDataUpdated();
+    void telemetrySnapshotUpdated(const TelemetrySnapshot &snapshot, quint32 changedFields);
 
 private:
     // Telemetry referansı
     std::shared_ptr<mavsdk::Telemetry> telemetry;
 
-    // Veriler
-    mavsdk::Telemetry::Heading heading;
-    mavsdk::Telemetry::Position position;
-    mavsdk::Telemetry::EulerAngle attitude;
-    mavsdk::Telemetry::FixedwingMetrics fixedwingMetrics;
-    QString flightMode;
-    mavsdk::Telemetry::GpsInfo gpsInfo;
-    mavsdk::Telemetry::Battery battery;
-    mavsdk::Telemetry::Health health;  // Sağlık durumu verisini tutacak üyeyi ekledik
-    mavsdk::Telemetry::RcStatus rcStatus;
+    // stop()/rebind() için abonelik tutamaçları
+    struct SubscriptionHandles {
+        mavsdk::Telemetry::PositionHandle position;
+        mavsdk::Telemetry::HeadingHandle heading;
+        mavsdk::Telemetry::AttitudeEulerHandle attitude;
+        mavsdk::Telemetry::FixedwingMetricsHandle fixedwingMetrics;
+        mavsdk::Telemetry::FlightModeHandle flightMode;
+        mavsdk::Telemetry::GpsInfoHandle gpsInfo;
+        mavsdk::Telemetry::BatteryHandle battery;
+        mavsdk::Telemetry::ArmedHandle armed;
+        mavsdk::Telemetry::VelocityNedHandle velocityNed;
+        mavsdk::Telemetry::HealthHandle health;
+        mavsdk::Telemetry::RcStatusHandle rcStatus;
+    };
+    SubscriptionHandles handles;
+    bool subscribed = false;
+
+    // Veriler (MAVSDK thread'leri yazar, GUI thread'i okur)
+    SeqLock<TelemetrySnapshot> snapshot;
 
-    bool armed = false;
-    double totalSpeed = 0.0;
+    // Dağıtım aşaması: değişen alanlar birikir ve kare başına bir kez GUI'ye gönderilir
+    std::atomic<quint32> dirtyFields{0};
+    std::atomic<quint64> receivedUpdates{0};
+    std::atomic<quint64> dispatchedFrames{0};
+    QTimer *dispatchTimer;
+    TelemetrySubscriptionRegistry *subscriptions;
+    std::unique_ptr<TelemetryTimeSeries> timeSeries;
+    TelemetryStatistics statistics;
+    bool statisticsArmed = false;  // Sadece ingest thread'inde kullanılır
+    FlightRecorder recorder;
+    DerivedMetricsEngine derivedMetrics;
+    QElapsedTimer lastDispatch;
+    int maxDispatchRate = 30;
+    int dispatchIntervalMs = 33;
 
-    QString lastLogMessage;  // Son log mesajını saklamak için
-    mavsdk::log::Level lastLogLevel; // Son log seviyesini saklamak için
+    template <typename Mutator>
+    void updateField(quint32 field, std::int64_t timestampUs, Mutator &&mutate);
+    void appendSample(TelemetryChannel channel, std::int64_t timestampUs, std::initializer_list<double> values);
+    void scheduleDispatch();
+    void dispatchSnapshot();
+
+    // Örnekleri snapshot'a, geçmişe ve kayda işleyen giriş noktaları
+    void ingestPosition(std::int64_t timestampUs, const mavsdk::Telemetry::Position &pos);
+    void ingestHeading(std::int64_t timestampUs, const mavsdk::Telemetry::Heading &head);
+    void ingestAttitude(std::int64_t timestampUs, const mavsdk::Telemetry::EulerAngle &att);
+    void ingestFixedwingMetrics(std::int64_t timestampUs, const mavsdk::Telemetry::FixedwingMetrics &metrics);
+    void ingestFlightMode(std::int64_t timestampUs, mavsdk::Telemetry::FlightMode mode);
+    void ingestGpsInfo(std::int64_t timestampUs, const mavsdk::Telemetry::GpsInfo &info);
+    void ingestBattery(std::int64_t timestampUs, const mavsdk::Telemetry::Battery &batt);
+    void ingestArmed(std::int64_t timestampUs, bool armStatus);
+    void ingestVelocityNed(std::int64_t timestampUs, const mavsdk::Telemetry::VelocityNed &velocityNed);
+    void ingestHealth(std::int64_t timestampUs, const mavsdk::Telemetry::Health &healthData);
+    void ingestRcStatus(std::int64_t timestampUs, const mavsdk::Telemetry::RcStatus &rcStatus);
 
     // Telemetry verilerini güncelleyen yardımcı fonksiyonlar
     void subscribePosition();
@@ -70,9 +170,6 @@ private:
     void subscribeTotalSpeed();
     void subscribeHealth();
     void subscribeConnnectionState();
-    void subscribeLog();
-
-    QString flightModeToString(mavsdk::Telemetry::FlightMode mode);
 
 };
 
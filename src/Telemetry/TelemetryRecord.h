@@ -0,0 +1,68 @@
+#ifndef TELEMETRYRECORD_H
+#define TELEMETRYRECORD_H
+
+#include <cstdint>
+
+// Uçuş kayıt dosyası (.uavrec) formatı.
+//
+//   FileHeader
+//   Chunk*        : ChunkHeader | uint32 kayıt ofsetleri[recordCount] | kayıtlar
+//   kayıt         : RecordHeader | payload (MAVSDK struct'ının ham baytları)
+//
+// Her chunk kendi indeksini ve CRC32'sini taşır; chunk'lar bağımsız olarak
+// doğrulanabildiği için yazma sırasında çökme olursa en fazla son chunk kaybolur.
+// Tüm alanlar host byte order'ında (little-endian) yazılır.
+namespace TelemetryRecord {
+
+constexpr char FileMagic[8] = {'U', 'A', 'V', 'R', 'E', 'C', '0', '1'};
+constexpr std::uint32_t FileVersion = 1;
+constexpr std::uint32_t ChunkMagic = 0x4B4E4843;  // "CHNK"
+
+// Her değer bir MAVSDK callback'ine karşılık gelir. Numaralar dosyaya yazıldığı için değiştirilmemeli.
+enum class Type : std::uint16_t {
+    Position = 1,
+    Heading = 2,
+    Attitude = 3,
+    FixedwingMetrics = 4,
+    FlightMode = 5,
+    GpsInfo = 6,
+    Battery = 7,
+    Armed = 8,
+    VelocityNed = 9,
+    Health = 10,
+    RcStatus = 11
+};
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    std::int64_t startWallClockMs;   // Kayıt başlangıcı, UNIX epoch ms
+    std::int64_t startMonotonicUs;   // Aynı anın monoton saat karşılığı
+};
+
+struct ChunkHeader {
+    std::uint32_t magic;
+    std::uint32_t sequence;
+    std::uint32_t recordCount;
+    std::uint32_t bodySize;          // İndeks + kayıt baytları
+    std::int64_t firstTimestampUs;
+    std::int64_t lastTimestampUs;
+    std::uint32_t crc32;             // Gövdenin (indeks + kayıtlar) CRC32'si
+    std::uint32_t reserved;
+};
+
+struct RecordHeader {
+    std::int64_t timestampUs;        // Alım anı, monoton saat
+    std::uint16_t type;
+    std::uint16_t size;              // Payload bayt sayısı
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 32, "FileHeader düzeni değişmemeli");
+static_assert(sizeof(ChunkHeader) == 40, "ChunkHeader düzeni değişmemeli");
+static_assert(sizeof(RecordHeader) == 16, "RecordHeader düzeni değişmemeli");
+
+} // namespace TelemetryRecord
+
+#endif // TELEMETRYRECORD_H
@@ -0,0 +1,217 @@
+#include "TelemetryReplay.h"
+#include "src/Telemetry/TelemetryHandler.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+TelemetryReplay::TelemetryReplay(TelemetryHandler *handler, QObject *parent)
+    : QObject(parent), handler(handler) {}
+
+TelemetryReplay::~TelemetryReplay() {
+    stop();
+}
+
+bool TelemetryReplay::open(const QString &filePath) {
+    stop();
+
+    if (!reader.open(filePath)) {
+        Logger::instance().log(reader.errorString(), ERROR);
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(controlMutex);
+        paused = true;
+        stopRequested = false;
+        seekTargetUs = -1;
+        ++controlGeneration;
+    }
+
+    worker = std::thread(&TelemetryReplay::playbackLoop, this);
+
+    Logger::instance().log("Uçuş kaydı oynatmaya hazır: " + filePath + " (" +
+                               QString::number(reader.chunks().size()) + " chunk, " +
+                               QString::number(durationUs() / 1000000.0, 'f', 1) + " sn)", INFO);
+    return true;
+}
+
+void TelemetryReplay::stop() {
+    if (worker.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(controlMutex);
+            stopRequested = true;
+        }
+        controlChanged.notify_all();
+        worker.join();
+    }
+    reader.close();
+}
+
+void TelemetryReplay::play() {
+    {
+        std::lock_guard<std::mutex> lock(controlMutex);
+        paused = false;
+        ++controlGeneration;
+    }
+    controlChanged.notify_all();
+}
+
+void TelemetryReplay::pause() {
+    {
+        std::lock_guard<std::mutex> lock(controlMutex);
+        paused = true;
+        ++controlGeneration;
+    }
+    controlChanged.notify_all();
+}
+
+bool TelemetryReplay::isPaused() const {
+    std::lock_guard<std::mutex> lock(controlMutex);
+    return paused;
+}
+
+void TelemetryReplay::seek(qint64 positionUs) {
+    {
+        std::lock_guard<std::mutex> lock(controlMutex);
+        seekTargetUs = std::clamp<qint64>(positionUs, 0, durationUs());
+        ++controlGeneration;
+    }
+    controlChanged.notify_all();
+}
+
+qint64 TelemetryReplay::durationUs() const {
+    return reader.lastTimestampUs() - reader.firstTimestampUs();
+}
+
+void TelemetryReplay::setSpeed(double speed) {
+    {
+        std::lock_guard<std::mutex> lock(controlMutex);
+        playbackSpeed = speed <= AsFastAsPossible ? AsFastAsPossible : std::clamp(speed, MinSpeed, MaxSpeed);
+        ++controlGeneration;
+    }
+    controlChanged.notify_all();
+}
+
+double TelemetryReplay::speed() const {
+    std::lock_guard<std::mutex> lock(controlMutex);
+    return playbackSpeed;
+}
+
+void TelemetryReplay::playbackLoop() {
+    using Clock = std::chrono::steady_clock;
+
+    const std::int64_t firstUs = reader.firstTimestampUs();
+    std::size_t chunkIndex = 0;
+    std::uint32_t resumeOrdinal = 0;                                  // Chunk içinde kaldığımız kayıt
+    std::int64_t skipBeforeUs = std::numeric_limits<std::int64_t>::min();  // Seek sonrası atlanacak kayıtlar
+    Clock::time_point lastProgress;
+
+    // Kayıt zamanı geçmişin saat alanına (TelemetryTimeSeries::now) sabit bir farkla taşınır: hız,
+    // duraklatma ve konumlamadan bağımsız olarak örnekler arası süreler kayıttaki gibi kalır.
+    const std::int64_t clockOffsetUs = TelemetryTimeSeries::now() - firstUs;
+    std::int64_t lastIngestedUs = std::numeric_limits<std::int64_t>::min();
+    bool rewound = false;  // Geri konumlama/yeniden başlama: geçmiş yeniden kurulmalı
+
+    // Kayıt saatini duvar saatine bağlayan referans nokta
+    quint64 anchorGeneration = std::numeric_limits<quint64>::max();
+    std::int64_t anchorRecordUs = 0;
+    Clock::time_point anchorWall;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(controlMutex);
+            controlChanged.wait(lock, [this] { return stopRequested || !paused || seekTargetUs >= 0; });
+            if (stopRequested) {
+                return;
+            }
+            if (seekTargetUs >= 0) {
+                skipBeforeUs = firstUs + seekTargetUs;
+                rewound = rewound || skipBeforeUs <= lastIngestedUs;
+                chunkIndex = reader.findChunk(skipBeforeUs);
+                resumeOrdinal = 0;
+                seekTargetUs = -1;
+            }
+            if (paused) {
+                continue;
+            }
+        }
+
+        if (chunkIndex >= reader.chunks().size()) {
+            {
+                std::lock_guard<std::mutex> lock(controlMutex);
+                paused = true;
+            }
+            emit progressChanged(durationUs(), durationUs());
+            emit finished();
+            chunkIndex = 0;
+            resumeOrdinal = 0;
+            skipBeforeUs = std::numeric_limits<std::int64_t>::min();
+            rewound = true;
+            continue;
+        }
+
+        bool interrupted = false;
+        std::uint32_t ordinal = 0;
+
+        const bool valid = reader.readChunk(chunkIndex, [&](const TelemetryRecord::RecordHeader &record, const void *payload) {
+            const std::uint32_t current = ordinal++;
+            if (current < resumeOrdinal || record.timestampUs < skipBeforeUs) {
+                return true;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(controlMutex);
+
+                // Oynat/duraklat/hız değişikliğinden sonra kayıt saati duvar saatine yeniden bağlanır
+                if (anchorGeneration != controlGeneration) {
+                    anchorGeneration = controlGeneration;
+                    anchorRecordUs = record.timestampUs;
+                    anchorWall = Clock::now();
+                }
+
+                const auto shouldInterrupt = [&] {
+                    return stopRequested || paused || seekTargetUs >= 0 || anchorGeneration != controlGeneration;
+                };
+
+                if (playbackSpeed > AsFastAsPossible) {
+                    const auto delay = std::chrono::microseconds(
+                        static_cast<std::int64_t>((record.timestampUs - anchorRecordUs) / playbackSpeed));
+                    interrupted = controlChanged.wait_until(lock, anchorWall + delay, shouldInterrupt);
+                } else {
+                    interrupted = shouldInterrupt();
+                }
+
+                if (interrupted) {
+                    resumeOrdinal = current;
+                    return false;
+                }
+            }
+
+            // Geçmiş tamponları artan zaman bekler; geri atlanınca baştan kurulur
+            if (rewound) {
+                rewound = false;
+                handler->resetHistory();
+            }
+            handler->ingestRecord(static_cast<TelemetryRecord::Type>(record.type), record.timestampUs + clockOffsetUs,
+                                  payload, record.size);
+            lastIngestedUs = std::max(lastIngestedUs, record.timestampUs);
+
+            const Clock::time_point now = Clock::now();
+            if (now - lastProgress >= std::chrono::milliseconds(100)) {
+                lastProgress = now;
+                emit progressChanged(record.timestampUs - firstUs, durationUs());
+            }
+            return true;
+        });
+
+        if (!valid) {
+            LOG_STRUCTURED(WARNING, "Bozuk chunk atlandı: %1", chunkIndex);
+        }
+
+        if (!interrupted) {
+            ++chunkIndex;
+            resumeOrdinal = 0;
+        }
+    }
+}
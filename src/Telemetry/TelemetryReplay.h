@@ -0,0 +1,62 @@
+#ifndef TELEMETRYREPLAY_H
+#define TELEMETRYREPLAY_H
+
+#include "src/Telemetry/FlightRecordingReader.h"
+#include <QObject>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+class TelemetryHandler;
+
+// Bir .uavrec kaydını, canlı araçtaki callback'lerle aynı yoldan (TelemetryHandler::ingestRecord)
+// TelemetryHandler'a besler. Oynatma kendi thread'inde yapılır; duraklatma, konumlama ve
+// 0.25x-100x hız ya da hız sınırı olmadan ("olabildiğince hızlı") oynatma desteklenir.
+class TelemetryReplay : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr double MinSpeed = 0.25;
+    static constexpr double MaxSpeed = 100.0;
+    static constexpr double AsFastAsPossible = 0.0;
+
+    explicit TelemetryReplay(TelemetryHandler *handler, QObject *parent = nullptr);
+    ~TelemetryReplay();
+
+    bool open(const QString &filePath);
+    void stop();
+
+    void play();
+    void pause();
+    bool isPaused() const;
+
+    // Kaydın başından itibaren konum (mikro saniye)
+    void seek(qint64 positionUs);
+    qint64 durationUs() const;
+
+    // 0 (AsFastAsPossible) ya da MinSpeed..MaxSpeed aralığında bir çarpan
+    void setSpeed(double speed);
+    double speed() const;
+
+signals:
+    void progressChanged(qint64 positionUs, qint64 durationUs);
+    void finished();
+
+private:
+    TelemetryHandler *handler;
+    FlightRecordingReader reader;
+    std::thread worker;
+
+    // Kontrol durumu; sadece kontrol çağrılarında ve kayıt aralarında beklerken kilitlenir
+    mutable std::mutex controlMutex;
+    std::condition_variable controlChanged;
+    bool paused = true;
+    bool stopRequested = false;
+    double playbackSpeed = 1.0;
+    qint64 seekTargetUs = -1;
+    quint64 controlGeneration = 0;  // Her kontrol değişikliğinde artar, oynatma saati yeniden bağlanır
+
+    void playbackLoop();
+};
+
+#endif // TELEMETRYREPLAY_H
@@ -0,0 +1,84 @@
+#ifndef TELEMETRYSNAPSHOT_H
+#define TELEMETRYSNAPSHOT_H
+
+#include <QtGlobal>
+#include <mavsdk/plugins/telemetry/telemetry.h>
+#include <limits>
+#include <type_traits>
+
+// Snapshot içindeki alanları tanımlayan bit maskesi.
+// Dağıtım aşaması hangi alanların değiştiğini bu maske ile bildirir.
+namespace TelemetryField {
+enum : quint32 {
+    Position         = 1u << 0,
+    Heading          = 1u << 1,
+    Attitude         = 1u << 2,
+    FixedwingMetrics = 1u << 3,
+    FlightMode       = 1u << 4,
+    GpsInfo          = 1u << 5,
+    Battery          = 1u << 6,
+    Armed            = 1u << 7,
+    TotalSpeed       = 1u << 8,
+    Health           = 1u << 9,
+    RcStatus         = 1u << 10,
+    Target           = 1u << 11,   // GUI'den seçilen hedef nokta
+    Derived          = 1u << 12,   // DerivedMetricsEngine çıktıları
+
+    All              = (1u << 13) - 1
+};
+}
+
+// Ham akışlardan artımlı olarak hesaplanan değerler (bkz. DerivedMetrics.h).
+// Henüz hesaplanamayan değerler NaN kalır.
+struct DerivedTelemetry {
+    static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+    double distanceFlownM = 0.0;       // Arm'dan beri kat edilen yatay mesafe
+    double homeLatitudeDeg = NaN;      // Arm anındaki (yoksa ilk geçerli) konum
+    double homeLongitudeDeg = NaN;
+    double homeDistanceM = NaN;
+    double homeBearingDeg = NaN;
+    double targetDistanceM = NaN;
+    double targetBearingDeg = NaN;
+    double climbRateMS = NaN;          // Yukarı pozitif
+    double maxClimbRateMS = 0.0;
+    double maxSinkRateMS = 0.0;
+    double totalAscentM = 0.0;
+    double totalDescentM = 0.0;
+    double powerW = NaN;
+    double energyUsedWh = 0.0;
+    double windNorthMS = NaN;          // Rüzgarın estiği yön bileşenleri
+    double windEastMS = NaN;
+    double windSpeedMS = NaN;
+    double windFromDeg = NaN;          // Rüzgarın geldiği yön (meteorolojik)
+    int geofenceState = 0;             // GeofenceIndex::State (0: temiz)
+    int geofenceZoneId = -1;
+    double geofenceDistanceM = NaN;    // En yakın geofence sınırı (pay yarıçapında)
+    double terrainElevationM = NaN;    // Konumdaki arazi yüksekliği (MSL, SRTM)
+    double aglM = NaN;                 // Arazi üstü irtifa (absolute_altitude_m - arazi)
+};
+
+// Tüm telemetri akışlarının tek bir andaki görüntüsü.
+// SeqLock içinde tutulduğu için POD kalmalı (QString gibi heap kullanan üyeler eklenmemeli)
+// ve cache line'a hizalanır ki yazıcı başka verilerle false sharing yaşamasın.
+struct alignas(64) TelemetrySnapshot {
+    mavsdk::Telemetry::Position position;
+    mavsdk::Telemetry::Heading heading;
+    mavsdk::Telemetry::EulerAngle attitude;
+    mavsdk::Telemetry::FixedwingMetrics fixedwingMetrics;
+    mavsdk::Telemetry::FlightMode flightMode = mavsdk::Telemetry::FlightMode::Unknown;
+    mavsdk::Telemetry::GpsInfo gpsInfo;
+    mavsdk::Telemetry::Battery battery;
+    mavsdk::Telemetry::Health health;
+    mavsdk::Telemetry::RcStatus rcStatus;
+    mavsdk::Telemetry::VelocityNed velocityNed;
+    bool armed = false;
+    double totalSpeed = 0.0;
+    double targetLatitudeDeg = DerivedTelemetry::NaN;
+    double targetLongitudeDeg = DerivedTelemetry::NaN;
+    DerivedTelemetry derived;
+};
+
+static_assert(std::is_trivially_copyable_v<TelemetrySnapshot>, "TelemetrySnapshot POD olmalı");
+
+#endif // TELEMETRYSNAPSHOT_H
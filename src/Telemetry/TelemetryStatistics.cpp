@@ -0,0 +1,71 @@
+#include "TelemetryStatistics.h"
+
+TelemetryStatistics::TelemetryStatistics() {
+    for (std::size_t i = 0; i < TelemetryChannelCount; ++i) {
+        const auto &info = telemetryChannelInfo(static_cast<TelemetryChannel>(i));
+        for (std::size_t column = 0; column < info.columnCount; ++column) {
+            accumulators[i][column] = std::make_unique<Accumulator>();
+        }
+    }
+}
+
+void TelemetryStatistics::add(TelemetryChannel channel, std::initializer_list<double> values) {
+    auto &columns = accumulators[static_cast<std::size_t>(channel)];
+    std::size_t column = 0;
+    for (double value : values) {
+        if (column >= TelemetryChannelMaxColumns || !columns[column]) {
+            break;
+        }
+        columns[column]->write([value](StreamingStatistics &stats) { stats.add(value); });
+        ++column;
+    }
+}
+
+StreamingStatistics TelemetryStatistics::column(TelemetryChannel channel, std::size_t column) const {
+    if (column >= TelemetryChannelMaxColumns) {
+        return StreamingStatistics();
+    }
+    const auto &accumulator = accumulators[static_cast<std::size_t>(channel)][column];
+    return accumulator ? accumulator->load() : StreamingStatistics();
+}
+
+TelemetryStatistics::Summary TelemetryStatistics::summary(TelemetryChannel channel, std::size_t column) const {
+    StreamingStatistics stats = this->column(channel, column);
+
+    Summary result;
+    result.count = stats.count();
+    result.min = stats.min();
+    result.max = stats.max();
+    result.mean = stats.mean();
+    result.stddev = stats.stddev();
+    result.p50 = stats.quantile(0.50);
+    result.p90 = stats.quantile(0.90);
+    result.p99 = stats.quantile(0.99);
+    return result;
+}
+
+void TelemetryStatistics::reset() {
+    for (std::size_t i = 0; i < TelemetryChannelCount; ++i) {
+        reset(static_cast<TelemetryChannel>(i));
+    }
+}
+
+void TelemetryStatistics::reset(TelemetryChannel channel) {
+    for (auto &accumulator : accumulators[static_cast<std::size_t>(channel)]) {
+        if (accumulator) {
+            accumulator->write([](StreamingStatistics &stats) { stats.reset(); });
+        }
+    }
+}
+
+std::size_t TelemetryStatistics::memoryUsage() const {
+    std::size_t total = 0;
+    for (const auto &columns : accumulators) {
+        for (const auto &accumulator : columns) {
+            if (accumulator) {
+                total += sizeof(Accumulator);
+            }
+        }
+    }
+    return total;
+}
@@ -0,0 +1,45 @@
+#ifndef TELEMETRYSTATISTICS_H
+#define TELEMETRYSTATISTICS_H
+
+#include "src/Telemetry/TelemetryChannel.h"
+#include "src/Utils/SeqLock.h"
+#include "src/Utils/StreamingStatistics.h"
+#include <array>
+#include <initializer_list>
+#include <memory>
+
+// Her kanal sütunu için uçuş boyu akan istatistik (min/max/ortalama/std/yüzdelik).
+// MAVSDK callback thread'i yazar; GUI kilit almadan tutarlı bir kopya okur.
+// Sıfırlama (uçuş/görev bacağı başı) herhangi bir thread'den yapılabilir.
+class TelemetryStatistics {
+public:
+    struct Summary {
+        std::uint64_t count = 0;
+        double min = 0.0;
+        double max = 0.0;
+        double mean = 0.0;
+        double stddev = 0.0;
+        double p50 = 0.0;
+        double p90 = 0.0;
+        double p99 = 0.0;
+    };
+
+    TelemetryStatistics();
+
+    void add(TelemetryChannel channel, std::initializer_list<double> values);
+
+    // Sütunun tutarlı bir kopyası; quantile() bu kopya üzerinde çağrılabilir
+    StreamingStatistics column(TelemetryChannel channel, std::size_t column) const;
+    Summary summary(TelemetryChannel channel, std::size_t column) const;
+
+    void reset();
+    void reset(TelemetryChannel channel);
+
+    std::size_t memoryUsage() const;
+
+private:
+    using Accumulator = SeqLock<StreamingStatistics>;
+    std::array<std::array<std::unique_ptr<Accumulator>, TelemetryChannelMaxColumns>, TelemetryChannelCount> accumulators;
+};
+
+#endif // TELEMETRYSTATISTICS_H
@@ -0,0 +1,128 @@
+#include "TelemetrySubscriptionRegistry.h"
+#include <algorithm>
+
+TelemetrySubscriptionRegistry::TelemetrySubscriptionRegistry(QObject *parent)
+    : QObject(parent) {}
+
+TelemetrySubscriptionRegistry::~TelemetrySubscriptionRegistry() = default;
+
+TelemetrySubscriptionRegistry::SubscriptionId TelemetrySubscriptionRegistry::subscribe(quint32 fields, int maxRateHz,
+                                                                                       QObject *context, Callback callback) {
+    auto subscriber = std::make_unique<Subscriber>();
+    subscriber->id = nextId++;
+    subscriber->fields = fields;
+    subscriber->intervalMs = maxRateHz > 0 ? qMax(1, 1000 / maxRateHz) : 0;
+    subscriber->context = context;
+    subscriber->callback = std::move(callback);
+
+    // Hız sınırı olan aboneler bekleyen alanlarını kendi zamanlayıcılarıyla teslim alır
+    if (subscriber->intervalMs > 0) {
+        subscriber->timer = new QTimer(this);
+        subscriber->timer->setSingleShot(true);
+        const SubscriptionId id = subscriber->id;
+        connect(subscriber->timer, &QTimer::timeout, this, [this, id]() {
+            if (Subscriber *s = find(id)) {
+                deliver(*s);
+            }
+        });
+    }
+
+    if (context) {
+        const SubscriptionId id = subscriber->id;
+        connect(context, &QObject::destroyed, this, [this, id]() { unsubscribe(id); });
+    }
+
+    const SubscriptionId id = subscriber->id;
+    subscribers.push_back(std::move(subscriber));
+    return id;
+}
+
+void TelemetrySubscriptionRegistry::unsubscribe(SubscriptionId id) {
+    Subscriber *subscriber = find(id);
+    if (!subscriber) {
+        return;
+    }
+
+    subscriber->removed = true;
+    subscriber->callback = nullptr;
+    if (subscriber->timer) {
+        subscriber->timer->stop();
+        subscriber->timer->deleteLater();
+        subscriber->timer = nullptr;
+    }
+
+    // Teslimat sırasında çağrıldıysa vektör döngü bittikten sonra temizlenir
+    if (publishDepth == 0) {
+        removeDeleted();
+    }
+}
+
+void TelemetrySubscriptionRegistry::publish(const TelemetrySnapshot &snapshot, quint32 changedFields) {
+    latest = snapshot;
+
+    ++publishDepth;
+    for (std::size_t i = 0; i < subscribers.size(); ++i) {
+        Subscriber &subscriber = *subscribers[i];
+        const quint32 relevant = changedFields & subscriber.fields;
+        if (subscriber.removed || relevant == 0) {
+            continue;
+        }
+
+        subscriber.pendingFields |= relevant;
+
+        // Zamanlayıcı zaten kuruluysa sadece bekleyen alanlar birikir, teslimde en güncel snapshot kullanılır
+        if (subscriber.timer && subscriber.timer->isActive()) {
+            continue;
+        }
+
+        const qint64 elapsed = subscriber.lastDelivery.isValid() ? subscriber.lastDelivery.elapsed() : subscriber.intervalMs;
+        if (elapsed >= subscriber.intervalMs) {
+            deliver(subscriber);
+        } else {
+            subscriber.timer->start(static_cast<int>(subscriber.intervalMs - elapsed));
+        }
+    }
+    --publishDepth;
+
+    if (publishDepth == 0) {
+        removeDeleted();
+    }
+}
+
+int TelemetrySubscriptionRegistry::subscriberCount() const {
+    return static_cast<int>(std::count_if(subscribers.begin(), subscribers.end(),
+                                          [](const std::unique_ptr<Subscriber> &s) { return !s->removed; }));
+}
+
+TelemetrySubscriptionRegistry::Subscriber *TelemetrySubscriptionRegistry::find(SubscriptionId id) const {
+    for (const auto &subscriber : subscribers) {
+        if (subscriber->id == id && !subscriber->removed) {
+            return subscriber.get();
+        }
+    }
+    return nullptr;
+}
+
+void TelemetrySubscriptionRegistry::deliver(Subscriber &subscriber) {
+    const quint32 fields = subscriber.pendingFields;
+    if (fields == 0 || subscriber.removed || !subscriber.callback) {
+        return;
+    }
+
+    subscriber.pendingFields = 0;
+    subscriber.lastDelivery.start();
+
+    ++publishDepth;
+    subscriber.callback(latest, fields);
+    --publishDepth;
+
+    if (publishDepth == 0) {
+        removeDeleted();
+    }
+}
+
+void TelemetrySubscriptionRegistry::removeDeleted() {
+    subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                     [](const std::unique_ptr<Subscriber> &s) { return s->removed; }),
+                      subscribers.end());
+}
@@ -0,0 +1,60 @@
+#ifndef TELEMETRYSUBSCRIPTIONREGISTRY_H
+#define TELEMETRYSUBSCRIPTIONREGISTRY_H
+
+#include "src/Telemetry/TelemetrySnapshot.h"
+#include <QObject>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Alan maskesine göre abonelik kaydı. GUI thread'inde yaşar.
+// Her abone sadece ilgilendiği alanlardan biri değiştiğinde ve kendi hız sınırına
+// uygun olduğunda uyandırılır. Sınır dolmadan gelen güncellemeler birikir ve abone
+// uyandığında sadece en güncel snapshot'ı alır (drop-to-latest).
+class TelemetrySubscriptionRegistry : public QObject {
+    Q_OBJECT
+
+public:
+    using SubscriptionId = int;
+    using Callback = std::function<void(const TelemetrySnapshot &snapshot, quint32 changedFields)>;
+
+    explicit TelemetrySubscriptionRegistry(QObject *parent = nullptr);
+    ~TelemetrySubscriptionRegistry();
+
+    // fields: TelemetryField maskesi, maxRateHz: 0 ise her dağıtım karesinde teslim edilir.
+    // context yok edildiğinde abonelik otomatik olarak kaldırılır.
+    SubscriptionId subscribe(quint32 fields, int maxRateHz, QObject *context, Callback callback);
+    void unsubscribe(SubscriptionId id);
+
+    // Dağıtım aşamasından gelen her kare için çağrılır
+    void publish(const TelemetrySnapshot &snapshot, quint32 changedFields);
+
+    int subscriberCount() const;
+
+private:
+    struct Subscriber {
+        SubscriptionId id = 0;
+        quint32 fields = 0;
+        int intervalMs = 0;
+        QPointer<QObject> context;
+        Callback callback;
+        quint32 pendingFields = 0;
+        QElapsedTimer lastDelivery;
+        QTimer *timer = nullptr;
+        bool removed = false;
+    };
+
+    std::vector<std::unique_ptr<Subscriber>> subscribers;
+    TelemetrySnapshot latest;
+    SubscriptionId nextId = 1;
+    int publishDepth = 0;
+
+    Subscriber *find(SubscriptionId id) const;
+    void deliver(Subscriber &subscriber);
+    void removeDeleted();
+};
+
+#endif // TELEMETRYSUBSCRIPTIONREGISTRY_H
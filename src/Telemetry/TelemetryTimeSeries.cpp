@@ -0,0 +1,147 @@
+#include "TelemetryTimeSeries.h"
+#include <algorithm>
+
+TimeSeriesChannel::TimeSeriesChannel(std::size_t capacity, std::size_t columnCount)
+    : slotCount(std::max<std::size_t>(capacity, 2)),
+    columns(columnCount),
+    timestamps(new std::int64_t[slotCount]()),
+    values(new double[slotCount * columnCount]()) {}
+
+void TimeSeriesChannel::append(std::int64_t timestampUs, std::initializer_list<double> sample) {
+    const std::uint64_t index = head.load(std::memory_order_relaxed);
+    const std::size_t slot = static_cast<std::size_t>(index % slotCount);
+
+    timestamps[slot] = timestampUs;
+    std::size_t column = 0;
+    for (double value : sample) {
+        if (column >= columns) {
+            break;
+        }
+        values[column * slotCount + slot] = value;
+        ++column;
+    }
+
+    // Slot yazıldıktan sonra yayınla
+    head.store(index + 1, std::memory_order_release);
+}
+
+std::uint64_t TimeSeriesChannel::lowerBound(std::uint64_t oldest, std::uint64_t newest, std::int64_t t) const {
+    std::uint64_t low = oldest;
+    std::uint64_t high = newest;
+    while (low < high) {
+        const std::uint64_t middle = low + (high - low) / 2;
+        if (timestamps[static_cast<std::size_t>(middle % slotCount)] < t) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+std::size_t TimeSeriesChannel::query(std::int64_t fromUs, std::int64_t toUs,
+                                     std::vector<std::int64_t> &outTimestamps,
+                                     std::vector<std::vector<double>> &outValues) const {
+    outValues.resize(columns);
+
+    for (;;) {
+        outTimestamps.clear();
+        for (auto &column : outValues) {
+            column.clear();
+        }
+
+        const std::uint64_t newest = head.load(std::memory_order_acquire);
+        // Yazar bir sonraki slotu yazıyor olabileceği için en eski slot geçerli sayılmaz
+        const std::uint64_t oldest = newest >= slotCount ? newest - slotCount + 1 : 0;
+        if (newest == oldest || fromUs > toUs) {
+            return 0;
+        }
+
+        const std::uint64_t first = lowerBound(oldest, newest, fromUs);
+        const std::uint64_t last = lowerBound(first, newest, toUs + 1);
+        const std::size_t count = static_cast<std::size_t>(last - first);
+
+        outTimestamps.reserve(count);
+        for (auto &column : outValues) {
+            column.reserve(count);
+        }
+
+        for (std::uint64_t i = first; i < last; ++i) {
+            const std::size_t slot = static_cast<std::size_t>(i % slotCount);
+            outTimestamps.push_back(timestamps[slot]);
+            for (std::size_t column = 0; column < columns; ++column) {
+                outValues[column].push_back(values[column * slotCount + slot]);
+            }
+        }
+
+        // Kopyalama sırasında yazar kopyalanan en eski slotun üzerine geçtiyse tekrar dene
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t after = head.load(std::memory_order_relaxed);
+        const std::uint64_t validFrom = after >= slotCount ? after - slotCount + 1 : 0;
+        if (first >= validFrom) {
+            return count;
+        }
+    }
+}
+
+std::size_t TimeSeriesChannel::size() const {
+    const std::uint64_t newest = head.load(std::memory_order_acquire);
+    return static_cast<std::size_t>(std::min<std::uint64_t>(newest, slotCount - 1));
+}
+
+std::size_t TimeSeriesChannel::memoryUsage() const {
+    return slotCount * (sizeof(std::int64_t) + columns * sizeof(double));
+}
+
+void TimeSeriesChannel::clear() {
+    head.store(0, std::memory_order_release);
+}
+
+
+
+TelemetryTimeSeries::Config::Config() {
+    for (std::size_t i = 0; i < TelemetryChannelCount; ++i) {
+        rateHz[i] = telemetryChannelInfo(static_cast<TelemetryChannel>(i)).defaultRateHz;
+    }
+}
+
+TelemetryTimeSeries::TelemetryTimeSeries(const Config &config)
+    : cfg(config) {
+    for (std::size_t i = 0; i < TelemetryChannelCount; ++i) {
+        const auto &info = telemetryChannelInfo(static_cast<TelemetryChannel>(i));
+        const std::size_t capacity = static_cast<std::size_t>(cfg.retention.count()) *
+                                         static_cast<std::size_t>(std::max(1, cfg.rateHz[i])) + 1;
+        channels[i] = std::make_unique<TimeSeriesChannel>(capacity, info.columnCount);
+    }
+}
+
+void TelemetryTimeSeries::append(TelemetryChannel ch, std::int64_t timestampUs, std::initializer_list<double> values) {
+    channel(ch).append(timestampUs, values);
+}
+
+TimeSeriesChannel &TelemetryTimeSeries::channel(TelemetryChannel ch) {
+    return *channels[static_cast<std::size_t>(ch)];
+}
+
+const TimeSeriesChannel &TelemetryTimeSeries::channel(TelemetryChannel ch) const {
+    return *channels[static_cast<std::size_t>(ch)];
+}
+
+std::size_t TelemetryTimeSeries::memoryUsage() const {
+    std::size_t total = 0;
+    for (const auto &ch : channels) {
+        total += ch->memoryUsage();
+    }
+    return total;
+}
+
+void TelemetryTimeSeries::clear() {
+    for (auto &ch : channels) {
+        ch->clear();
+    }
+}
+
+std::int64_t TelemetryTimeSeries::now() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
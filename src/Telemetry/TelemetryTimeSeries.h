@@ -0,0 +1,85 @@
+#ifndef TELEMETRYTIMESERIES_H
+#define TELEMETRYTIMESERIES_H
+
+#include "src/Telemetry/TelemetryChannel.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+// Tek bir kanal için sabit boyutlu, önceden ayrılmış halka tampon.
+// Veriler structure-of-arrays düzeninde tutulur: bir zaman damgası dizisi ve
+// her sütun için ayrı bir değer dizisi. Tek yazar (MAVSDK callback thread'i) O(1)
+// ekleme yapar; okuyucular kilit almadan O(log n) zaman aralığı sorgusu yapar.
+class TimeSeriesChannel {
+public:
+    TimeSeriesChannel(std::size_t capacity, std::size_t columnCount);
+
+    TimeSeriesChannel(const TimeSeriesChannel &) = delete;
+    TimeSeriesChannel &operator=(const TimeSeriesChannel &) = delete;
+
+    // Sadece tek bir yazar thread'inden çağrılmalı. Zaman damgaları artan sırada olmalı.
+    void append(std::int64_t timestampUs, std::initializer_list<double> values);
+
+    // [fromUs, toUs] aralığındaki örnekleri kopyalar. values[sütun][örnek] düzenindedir.
+    // Dönüş değeri kopyalanan örnek sayısıdır.
+    std::size_t query(std::int64_t fromUs, std::int64_t toUs,
+                      std::vector<std::int64_t> &timestamps,
+                      std::vector<std::vector<double>> &values) const;
+
+    std::size_t size() const;
+    std::size_t capacity() const { return slotCount; }
+    std::size_t columnCount() const { return columns; }
+    std::size_t memoryUsage() const;
+
+    void clear();
+
+private:
+    std::size_t slotCount;
+    std::size_t columns;
+    std::unique_ptr<std::int64_t[]> timestamps;
+    std::unique_ptr<double[]> values;  // values[sütun * slotCount + slot]
+
+    // Şimdiye kadar eklenen toplam örnek sayısı; slot = head % slotCount
+    std::atomic<std::uint64_t> head{0};
+
+    // [oldest, newest) mantıksal aralığında timestamp >= t olan ilk indeks
+    std::uint64_t lowerBound(std::uint64_t oldest, std::uint64_t newest, std::int64_t t) const;
+};
+
+// Tüm telemetri kanallarının bellek sınırlı geçmişi
+class TelemetryTimeSeries {
+public:
+    struct Config {
+        // Kanal başına tutulacak süre; kapasite = süre * kanal hızı
+        std::chrono::seconds retention{30 * 60};
+        // Kanal başına beklenen örnekleme hızı (Hz). Daha hızlı gelen akışlarda
+        // bellek sabit kalır, tutulan süre kısalır.
+        std::array<int, TelemetryChannelCount> rateHz{};
+
+        Config();
+    };
+
+    explicit TelemetryTimeSeries(const Config &config = Config());
+
+    void append(TelemetryChannel channel, std::int64_t timestampUs, std::initializer_list<double> values);
+
+    TimeSeriesChannel &channel(TelemetryChannel channel);
+    const TimeSeriesChannel &channel(TelemetryChannel channel) const;
+
+    const Config &config() const { return cfg; }
+    std::size_t memoryUsage() const;
+    void clear();
+
+    // Monoton saat (steady_clock), mikro saniye
+    static std::int64_t now();
+
+private:
+    Config cfg;
+    std::array<std::unique_ptr<TimeSeriesChannel>, TelemetryChannelCount> channels;
+};
+
+#endif // TELEMETRYTIMESERIES_H
@@ -0,0 +1,363 @@
+#include "TerrainDatabase.h"
+#include "src/Utils/Logger.h"
+#include "src/Utils/TaskExecutor.h"
+#include <QDir>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+constexpr qint16 VoidSample = -32768;
+
+std::atomic<quint64> nextCacheGeneration{1};
+
+inline qint16 readSample(const uchar *data, std::size_t index) {
+    // SRTM örnekleri büyük endian
+    return static_cast<qint16>((static_cast<quint16>(data[2 * index]) << 8) | data[2 * index + 1]);
+}
+
+} // namespace
+
+
+TerrainDatabase &TerrainDatabase::instance() {
+    // Yürütücü önce oluşturulur; arka plan yüklemeleri veritabanının yıkıcısında beklenir
+    TaskExecutor::instance();
+    static TerrainDatabase database(QDir::current().filePath("terrain"));
+    return database;
+}
+
+
+TerrainDatabase::TerrainDatabase(const QString &directory, std::size_t maxOpenTiles)
+    : tileDirectory(directory),
+    maxOpenTiles(std::max<std::size_t>(maxOpenTiles, 1)),
+    cacheGeneration(nextCacheGeneration.fetch_add(1, std::memory_order_relaxed)) {}
+
+
+TerrainDatabase::~TerrainDatabase() {
+    std::unique_lock<std::mutex> lock(mutex);
+    ++directoryGeneration;
+    loadsFinished.wait(lock, [this] { return pendingLoads.empty(); });
+}
+
+
+void TerrainDatabase::setDirectory(const QString &directory) {
+    std::lock_guard<std::mutex> lock(mutex);
+    tileDirectory = directory;
+    ++directoryGeneration;
+    cacheGeneration.store(nextCacheGeneration.fetch_add(1, std::memory_order_relaxed), std::memory_order_release);
+    tiles.clear();
+    lru.clear();
+}
+
+
+QString TerrainDatabase::directory() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return tileDirectory;
+}
+
+
+QString TerrainDatabase::tileFileName(int latitude, int longitude) {
+    return QString("%1%2%3%4.hgt")
+        .arg(latitude < 0 ? 'S' : 'N')
+        .arg(std::abs(latitude), 2, 10, QChar('0'))
+        .arg(longitude < 0 ? 'W' : 'E')
+        .arg(std::abs(longitude), 3, 10, QChar('0'));
+}
+
+
+int TerrainDatabase::tileKey(int latitude, int longitude) {
+    return (latitude + 90) * 360 + (longitude + 180);
+}
+
+
+double TerrainDatabase::elevationM(double latitudeDeg, double longitudeDeg, LoadPolicy policy) {
+    if (!std::isfinite(latitudeDeg) || !std::isfinite(longitudeDeg) || std::abs(latitudeDeg) >= 90.0) {
+        return NoData;
+    }
+    lookups.fetch_add(1, std::memory_order_relaxed);
+    const std::shared_ptr<Tile> tile = tileFor(static_cast<int>(std::floor(latitudeDeg)),
+                                               static_cast<int>(std::floor(longitudeDeg)), policy);
+    return tile ? sample(*tile, latitudeDeg, longitudeDeg) : NoData;
+}
+
+
+std::vector<double> TerrainDatabase::elevationsM(const std::vector<GeoPoint> &points, LoadPolicy policy) {
+    std::vector<double> result(points.size(), NoData);
+    std::shared_ptr<Tile> tile;
+    int tileLatitude = 0;
+    int tileLongitude = 0;
+    bool haveTile = false;
+
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        const double latitudeDeg = points[i].latitudeDeg;
+        const double longitudeDeg = points[i].longitudeDeg;
+        if (!std::isfinite(latitudeDeg) || !std::isfinite(longitudeDeg) || std::abs(latitudeDeg) >= 90.0) {
+            continue;
+        }
+        const int latitude = static_cast<int>(std::floor(latitudeDeg));
+        const int longitude = static_cast<int>(std::floor(longitudeDeg));
+        if (!haveTile || latitude != tileLatitude || longitude != tileLongitude) {
+            tile = tileFor(latitude, longitude, policy);
+            tileLatitude = latitude;
+            tileLongitude = longitude;
+            haveTile = true;
+        }
+        if (tile) {
+            result[i] = sample(*tile, latitudeDeg, longitudeDeg);
+        }
+    }
+    lookups.fetch_add(points.size(), std::memory_order_relaxed);
+    return result;
+}
+
+
+double TerrainDatabase::sample(const Tile &tile, double latitudeDeg, double longitudeDeg) {
+    const int last = tile.samples - 1;
+    // Satır 0 karonun kuzey kenarıdır
+    const double x = std::clamp((longitudeDeg - tile.longitude) * last, 0.0, static_cast<double>(last));
+    const double y = std::clamp((tile.latitude + 1 - latitudeDeg) * last, 0.0, static_cast<double>(last));
+    const int column = std::min(static_cast<int>(x), last - 1);
+    const int row = std::min(static_cast<int>(y), last - 1);
+    const double fx = x - column;
+    const double fy = y - row;
+
+    const std::size_t index = static_cast<std::size_t>(row) * tile.samples + column;
+    const qint16 corners[4] = {readSample(tile.data, index), readSample(tile.data, index + 1),
+                               readSample(tile.data, index + tile.samples),
+                               readSample(tile.data, index + tile.samples + 1)};
+    const double weights[4] = {(1 - fx) * (1 - fy), fx * (1 - fy), (1 - fx) * fy, fx * fy};
+
+    // Boş (void) örnekler atlanır, kalan ağırlıklar normalize edilir. Nokta tam boş bir
+    // örneğin üstündeyse (kalan ağırlık 0) geçerli komşuların ortalaması kullanılır.
+    double sum = 0.0;
+    double weightSum = 0.0;
+    double validSum = 0.0;
+    int validCount = 0;
+    for (int i = 0; i < 4; ++i) {
+        if (corners[i] != VoidSample) {
+            sum += weights[i] * corners[i];
+            weightSum += weights[i];
+            validSum += corners[i];
+            ++validCount;
+        }
+    }
+    if (weightSum > 1e-9) {
+        return sum / weightSum;
+    }
+    return validCount > 0 ? validSum / validCount : NoData;
+}
+
+
+qint64 TerrainDatabase::steadyMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+std::shared_ptr<TerrainDatabase::Tile> TerrainDatabase::tileFor(int latitude, int longitude, LoadPolicy policy) {
+    const int key = tileKey(latitude, longitude);
+    const qint64 nowMs = steadyMs();
+    const quint64 generation = cacheGeneration.load(std::memory_order_acquire);
+
+    // Hızlı yol: kilit ve LRU güncellemesi yok (karo LRU'dan düşse de shared_ptr eşlemeyi açık tutar)
+    thread_local LastTile last;
+    if (last.generation == generation && last.key == key && (last.tile || nowMs < last.missingUntilMs)) {
+        if (last.tile) {
+            tileHits.fetch_add(1, std::memory_order_relaxed);
+        }
+        return last.tile;
+    }
+
+    qint64 missingUntilMs = 0;
+    std::shared_ptr<Tile> tile = lookupTile(latitude, longitude, policy, nowMs, missingUntilMs);
+    // Arka planda yüklenmekte olan karo (missingUntilMs == 0) önbelleğe alınmaz, yüklenince görülsün
+    if (tile || missingUntilMs > 0) {
+        last.generation = generation;
+        last.key = key;
+        last.tile = tile;
+        last.missingUntilMs = missingUntilMs;
+    }
+    return tile;
+}
+
+
+std::shared_ptr<TerrainDatabase::Tile> TerrainDatabase::lookupTile(int latitude, int longitude, LoadPolicy policy,
+                                                                   qint64 nowMs, qint64 &missingUntilMs) {
+    const int key = tileKey(latitude, longitude);
+    quint64 generation = 0;
+    QString tileDirectoryCopy;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = tiles.find(key);
+        if (it != tiles.end()) {
+            if (it->second.tile) {
+                lru.splice(lru.begin(), lru, it->second.lruPosition);
+                tileHits.fetch_add(1, std::memory_order_relaxed);
+                return it->second.tile;
+            }
+            if (nowMs < it->second.missingUntilMs) {
+                missingUntilMs = it->second.missingUntilMs;
+                return nullptr;
+            }
+            tiles.erase(it);  // Süresi doldu: dosya sonradan eklenmiş olabilir
+        }
+        if (policy == LoadPolicy::CachedOnly) {
+            if (pendingLoads.insert(key).second) {
+                loadInBackground(latitude, longitude);
+            }
+            return nullptr;
+        }
+        generation = directoryGeneration;
+        tileDirectoryCopy = tileDirectory;
+    }
+
+    // Dosya kilit dışında açılır; aynı karo iki kez açılırsa ikincisi atılır
+    std::shared_ptr<Tile> tile = openTile(tileDirectoryCopy, latitude, longitude);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (generation != directoryGeneration) {
+        return tile;
+    }
+    const auto it = tiles.find(key);
+    if (it != tiles.end()) {
+        missingUntilMs = it->second.missingUntilMs;
+        return it->second.tile;
+    }
+    insertLocked(key, tile);
+    missingUntilMs = tile ? 0 : tiles[key].missingUntilMs;
+    return tile;
+}
+
+
+std::shared_ptr<TerrainDatabase::Tile> TerrainDatabase::openTile(const QString &directory, int latitude,
+                                                                  int longitude) {
+    const QString path = QDir(directory).filePath(tileFileName(latitude, longitude));
+    auto tile = std::make_shared<Tile>();
+    tile->file.setFileName(path);
+    if (!tile->file.open(QIODevice::ReadOnly)) {
+        missingTiles.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    const qint64 size = tile->file.size();
+    const int samples = static_cast<int>(std::lround(std::sqrt(static_cast<double>(size) / 2.0)));
+    if (samples < 2 || static_cast<qint64>(samples) * samples * 2 != size) {
+        Logger::instance().log("Invalid terrain tile size: " + path, WARNING);
+        missingTiles.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    tile->data = tile->file.map(0, size);
+    if (!tile->data) {
+        Logger::instance().log("Failed to map terrain tile: " + path, ERROR);
+        missingTiles.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    tile->samples = samples;
+    tile->latitude = latitude;
+    tile->longitude = longitude;
+    tileLoads.fetch_add(1, std::memory_order_relaxed);
+    Logger::instance().log(QString("Terrain tile loaded: %1 (%2x%2)").arg(path).arg(samples), DEBUG);
+    return tile;
+}
+
+
+void TerrainDatabase::insertLocked(int key, std::shared_ptr<Tile> tile) {
+    Slot &slot = tiles[key];
+    slot.tile = std::move(tile);
+    if (!slot.tile) {
+        slot.missingUntilMs = steadyMs() + MissingTileRetryMs;
+        return;  // Eksik karolar LRU'ya girmez, sadece bir süre hatırlanır
+    }
+    lru.push_front(key);
+    slot.lruPosition = lru.begin();
+    while (lru.size() > maxOpenTiles) {
+        // Karoyu kullanan sorgu varsa eşleme o sorgunun shared_ptr'ı bırakılınca kapanır
+        tiles.erase(lru.back());
+        lru.pop_back();
+    }
+}
+
+
+void TerrainDatabase::loadInBackground(int latitude, int longitude) {
+    const int key = tileKey(latitude, longitude);
+    const quint64 generation = directoryGeneration;
+    const QString directoryCopy = tileDirectory;
+    const bool submitted = TaskExecutor::instance().submit([this, key, generation, directoryCopy, latitude,
+                                                            longitude](const CancellationToken &) {
+        std::shared_ptr<Tile> tile = openTile(directoryCopy, latitude, longitude);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (generation == directoryGeneration && tiles.find(key) == tiles.end()) {
+            insertLocked(key, std::move(tile));
+        }
+        pendingLoads.erase(key);
+        loadsFinished.notify_all();
+    }, TaskExecutor::Priority::Low);
+
+    if (!submitted) {
+        pendingLoads.erase(key);  // Sonraki sorguda tekrar denenir
+    }
+}
+
+
+TerrainDatabase::ClearanceReport TerrainDatabase::checkClearance(const std::vector<GeoPoint> &route,
+                                                                 const std::vector<double> &altitudesAmslM,
+                                                                 double minClearanceM, double sampleSpacingM) {
+    ClearanceReport report;
+    if (route.empty() || altitudesAmslM.size() != route.size()) {
+        return report;
+    }
+    sampleSpacingM = std::max(sampleSpacingM, 1.0);
+
+    // Bacaklar sabit aralıkla örneklenir, irtifa bacak boyunca doğrusal kabul edilir
+    std::vector<GeoPoint> samples;
+    std::vector<double> sampleAltitudes;
+    std::vector<int> sampleLegs;
+    for (std::size_t i = 0; i + 1 < route.size(); ++i) {
+        const GeoPoint &from = route[i];
+        const GeoPoint &to = route[i + 1];
+        const double length = GeoMath::distanceM(from.latitudeDeg, from.longitudeDeg, to.latitudeDeg, to.longitudeDeg);
+        const int steps = std::max(1, static_cast<int>(std::ceil(length / sampleSpacingM)));
+        for (int step = 0; step < steps; ++step) {
+            const double t = static_cast<double>(step) / steps;
+            samples.push_back({from.latitudeDeg + (to.latitudeDeg - from.latitudeDeg) * t,
+                               from.longitudeDeg + (to.longitudeDeg - from.longitudeDeg) * t});
+            sampleAltitudes.push_back(altitudesAmslM[i] + (altitudesAmslM[i + 1] - altitudesAmslM[i]) * t);
+            sampleLegs.push_back(static_cast<int>(i));
+        }
+    }
+    samples.push_back(route.back());
+    sampleAltitudes.push_back(altitudesAmslM.back());
+    sampleLegs.push_back(static_cast<int>(route.size()) - 2);
+
+    const std::vector<double> terrain = elevationsM(samples, LoadPolicy::Load);
+    report.samples = static_cast<int>(samples.size());
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        if (!std::isfinite(terrain[i])) {
+            ++report.unknownSamples;
+            continue;
+        }
+        const double clearance = sampleAltitudes[i] - terrain[i];
+        if (!report.valid || clearance < report.minClearanceM) {
+            report.minClearanceM = clearance;
+            report.worstLeg = std::max(sampleLegs[i], 0);
+        }
+        report.valid = true;
+        if (clearance < minClearanceM) {
+            ++report.violations;
+        }
+    }
+    return report;
+}
+
+
+TerrainDatabase::Statistics TerrainDatabase::statistics() const {
+    Statistics stats;
+    stats.lookups = lookups.load(std::memory_order_relaxed);
+    stats.tileHits = tileHits.load(std::memory_order_relaxed);
+    stats.tileLoads = tileLoads.load(std::memory_order_relaxed);
+    stats.missingTiles = missingTiles.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.openTiles = lru.size();
+    return stats;
+}
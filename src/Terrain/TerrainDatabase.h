@@ -0,0 +1,126 @@
+#ifndef TERRAINDATABASE_H
+#define TERRAINDATABASE_H
+
+#include "src/Utils/GeoMath.h"
+#include <QFile>
+#include <QString>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// SRTM .hgt yükseklik karoları (1°x1°, büyük endian int16, 1201² veya 3601² örnek, kuzeyden güneye).
+// Karolar kopyalanmadan mmap ile açılır; açık karo sayısı LRU ile sınırlıdır, dosyası olmayan
+// karolar MissingTileRetryMs boyunca hatırlanır ki her sorguda diske bakılmasın (sonradan eklenen
+// dosya bu sürenin sonunda görülür). Her thread son kullandığı karoyu kendisi tutar: aynı karodaki
+// ardışık sorgular (telemetri akışı) kilit almaz. Örnekler bilinear enterpolasyonla okunur.
+// Yükseklikler geoit (MSL) referanslıdır, MAVSDK'nın absolute_altitude_m değeriyle karşılaştırılabilir.
+// Bütün fonksiyonlar thread-safe'tir; karo serbest bırakılması onu okuyan sorgunun bitmesini bekler.
+class TerrainDatabase {
+public:
+    static constexpr double NoData = std::numeric_limits<double>::quiet_NaN();
+    static constexpr std::size_t DefaultMaxOpenTiles = 32;
+    static constexpr qint64 MissingTileRetryMs = 30000;
+
+    // CachedOnly: karo açık değilse NaN döner ve karo arka planda açılır (telemetri thread'i için)
+    enum class LoadPolicy { Load, CachedOnly };
+
+    struct Statistics {
+        quint64 lookups = 0;
+        quint64 tileHits = 0;
+        quint64 tileLoads = 0;
+        quint64 missingTiles = 0;
+        std::size_t openTiles = 0;
+    };
+
+    struct ClearanceReport {
+        bool valid = false;             // En az bir örnekte arazi verisi vardı
+        double minClearanceM = NoData;  // Görev irtifası - arazi, en kötü örnek
+        int worstLeg = -1;              // En kötü örneğin bacağı (0: ilk noktadan ikinciye)
+        int violations = 0;             // Sınırın altında kalan örnek sayısı
+        int samples = 0;
+        int unknownSamples = 0;         // Arazi verisi olmayan örnek
+    };
+
+    static TerrainDatabase &instance();
+
+    explicit TerrainDatabase(const QString &directory = QString(), std::size_t maxOpenTiles = DefaultMaxOpenTiles);
+    ~TerrainDatabase();
+
+    TerrainDatabase(const TerrainDatabase &) = delete;
+    TerrainDatabase &operator=(const TerrainDatabase &) = delete;
+
+    // Açık karolar kapatılır; sonraki sorgular yeni klasörden okur
+    void setDirectory(const QString &directory);
+    QString directory() const;
+
+    double elevationM(double latitudeDeg, double longitudeDeg, LoadPolicy policy = LoadPolicy::Load);
+    // Toplu sorgu: ardışık noktalar aynı karodaysa kilit ve karo araması tekrarlanmaz
+    std::vector<double> elevationsM(const std::vector<GeoPoint> &points, LoadPolicy policy = LoadPolicy::Load);
+
+    // Rota boyunca (noktalar ve aralarında sampleSpacingM'de bir) irtifa payı.
+    // altitudesAmslM her noktanın deniz seviyesine göre irtifasıdır.
+    ClearanceReport checkClearance(const std::vector<GeoPoint> &route, const std::vector<double> &altitudesAmslM,
+                                   double minClearanceM, double sampleSpacingM = 30.0);
+
+    Statistics statistics() const;
+
+    static QString tileFileName(int latitude, int longitude);
+
+private:
+    struct Tile {
+        QFile file;
+        const uchar *data = nullptr;  // mmap, büyük endian int16
+        int samples = 0;              // Kenar başına örnek
+        int latitude = 0;             // Güneybatı köşesi
+        int longitude = 0;
+    };
+
+    struct Slot {
+        std::shared_ptr<Tile> tile;  // nullptr: dosya yok
+        std::list<int>::iterator lruPosition;
+        qint64 missingUntilMs = 0;  // Eksik karo bu zamana kadar tekrar aranmaz
+    };
+
+    // Thread'in son sorguladığı karo (thread_local). Eksik karo da süresi dolana kadar tutulur.
+    struct LastTile {
+        quint64 generation = 0;
+        int key = -1;
+        std::shared_ptr<Tile> tile;
+        qint64 missingUntilMs = 0;
+    };
+
+    static int tileKey(int latitude, int longitude);
+    static double sample(const Tile &tile, double latitudeDeg, double longitudeDeg);
+    std::shared_ptr<Tile> tileFor(int latitude, int longitude, LoadPolicy policy);
+    std::shared_ptr<Tile> lookupTile(int latitude, int longitude, LoadPolicy policy, qint64 nowMs,
+                                     qint64 &missingUntilMs);
+    static qint64 steadyMs();
+    std::shared_ptr<Tile> openTile(const QString &directory, int latitude, int longitude);
+    void insertLocked(int key, std::shared_ptr<Tile> tile);
+    void loadInBackground(int latitude, int longitude);
+
+    mutable std::mutex mutex;
+    QString tileDirectory;
+    std::size_t maxOpenTiles;
+    std::unordered_map<int, Slot> tiles;
+    std::list<int> lru;  // Önde en son kullanılan (sadece açık karolar)
+    std::unordered_set<int> pendingLoads;  // Arka planda açılmakta olan karolar
+    std::condition_variable loadsFinished;
+    quint64 directoryGeneration = 0;
+    // Thread önbelleklerini geçersiz kılar; örnekler arasında da benzersizdir (adres yeniden kullanılsa bile)
+    std::atomic<quint64> cacheGeneration;
+
+    std::atomic<quint64> lookups{0};
+    std::atomic<quint64> tileHits{0};
+    std::atomic<quint64> tileLoads{0};
+    std::atomic<quint64> missingTiles{0};
+};
+
+#endif // TERRAINDATABASE_H
@@ -0,0 +1,296 @@
+#include "CommandPipeline.h"
+#include "src/Utils/Logger.h"
+#include <QPointer>
+#include <sstream>
+
+struct CommandPipeline::Chain {
+    CommandId id = 0;
+    int systemId = 0;
+    QString name;
+    std::vector<CommandSpec> steps;
+    std::size_t index = 0;
+    FinishedCallback done;
+};
+
+void CommandPipeline::LatencyHistogram::add(qint64 latencyMs) {
+    int bucket = 0;
+    while (bucket < BucketCount - 1 && latencyMs > (qint64(1) << bucket)) {
+        ++bucket;
+    }
+    ++buckets[bucket];
+    ++count;
+    totalMs += latencyMs;
+    maxMs = qMax(maxMs, latencyMs);
+}
+
+qint64 CommandPipeline::LatencyHistogram::percentileMs(double q) const {
+    if (count == 0) {
+        return 0;
+    }
+    const quint64 target = qMax<quint64>(1, static_cast<quint64>(q * count + 0.5));
+    quint64 cumulative = 0;
+    for (int i = 0; i < BucketCount; ++i) {
+        cumulative += buckets[i];
+        if (cumulative >= target) {
+            return i == BucketCount - 1 ? maxMs : qMin(maxMs, qint64(1) << i);
+        }
+    }
+    return maxMs;
+}
+
+double CommandPipeline::LatencyHistogram::meanMs() const {
+    return count ? static_cast<double>(totalMs) / count : 0.0;
+}
+
+CommandPipeline::CommandPipeline(QObject *parent)
+    : QObject(parent) {}
+
+CommandPipeline::~CommandPipeline() {
+    cancelAll();
+    if (!histograms.isEmpty()) {
+        Logger::instance().log("Command latency:\n" + latencyReport(), INFO);
+    }
+}
+
+CommandPipeline::CommandId CommandPipeline::submit(int systemId, CommandSpec spec, FinishedCallback done) {
+    return enqueue(systemId, std::move(spec), std::move(done), false);
+}
+
+CommandPipeline::CommandId CommandPipeline::submitChain(int systemId, const QString &name, std::vector<CommandSpec> steps,
+                                                        FinishedCallback done) {
+    auto chain = std::make_shared<Chain>();
+    chain->id = nextId++;
+    chain->systemId = systemId;
+    chain->name = name;
+    chain->steps = std::move(steps);
+    chain->done = std::move(done);
+
+    if (chain->steps.empty()) {
+        emit chainFinished(chain->id, systemId, name, true);
+        if (chain->done) {
+            chain->done(true, Result::Success);
+        }
+        return chain->id;
+    }
+
+    runChainStep(chain);
+    return chain->id;
+}
+
+void CommandPipeline::runChainStep(const std::shared_ptr<Chain> &chain) {
+    const bool first = chain->index == 0;
+    CommandSpec step = chain->steps[chain->index];
+
+    // Zincirin devamı önceki adımın sonucuna bağlıdır, hiçbir thread beklemez
+    enqueue(chain->systemId, std::move(step), [this, chain](bool success, Result result) {
+        ++chain->index;
+        const bool last = chain->index >= chain->steps.size();
+        if (!success || last) {
+            if (!success) {
+                Logger::instance().log(chain->name + " aborted at step " + QString::number(chain->index) + "/" +
+                                           QString::number(chain->steps.size()) + ": " + resultToString(result), ERROR);
+            }
+            emit chainFinished(chain->id, chain->systemId, chain->name, success);
+            if (chain->done) {
+                chain->done(success, result);
+            }
+            return;
+        }
+        runChainStep(chain);
+    }, !first);
+}
+
+CommandPipeline::CommandId CommandPipeline::enqueue(int systemId, CommandSpec spec, FinishedCallback done, bool front) {
+    Command command;
+    command.id = nextId++;
+    command.systemId = systemId;
+    command.spec = std::move(spec);
+    command.done = std::move(done);
+    const CommandId id = command.id;
+
+    VehicleQueue &queue = queueFor(systemId);
+    if (front) {
+        queue.pending.push_front(std::move(command));
+    } else {
+        queue.pending.push_back(std::move(command));
+    }
+    startNext(systemId);
+    return id;
+}
+
+CommandPipeline::VehicleQueue &CommandPipeline::queueFor(int systemId) {
+    VehicleQueue &queue = queues[systemId];
+    if (!queue.timer) {
+        queue.timer = new QTimer(this);
+        queue.timer->setSingleShot(true);
+        connect(queue.timer, &QTimer::timeout, this, [this, systemId]() { onTimeout(systemId); });
+    }
+    return queue;
+}
+
+void CommandPipeline::startNext(int systemId) {
+    VehicleQueue &queue = queueFor(systemId);
+    if (queue.inFlight || queue.pending.empty()) {
+        return;
+    }
+    queue.inFlight = std::move(queue.pending.front());
+    queue.pending.pop_front();
+    queue.inFlight->clock.start();
+    send(systemId);
+}
+
+void CommandPipeline::send(int systemId) {
+    VehicleQueue &queue = queueFor(systemId);
+    Command &command = *queue.inFlight;
+    ++command.attempt;
+
+    const CommandId id = command.id;
+    const int attempt = command.attempt;
+    emit commandStarted(id, systemId, command.spec.name, attempt);
+    queue.timer->start(command.spec.timeoutMs);
+
+    // Sonuç MAVSDK thread'inden gelir; pipeline silinmişse yok sayılır
+    QPointer<CommandPipeline> self(this);
+    command.spec.start([self, systemId, id, attempt](Result result) {
+        if (!self) {
+            return;
+        }
+        QMetaObject::invokeMethod(self, [self, systemId, id, attempt, result]() {
+            if (self) {
+                self->onResult(systemId, id, attempt, result);
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+bool CommandPipeline::isRetryable(Result result) {
+    return result == Result::Timeout || result == Result::ConnectionError || result == Result::Busy;
+}
+
+void CommandPipeline::onResult(int systemId, CommandId id, int attempt, Result result) {
+    auto it = queues.find(systemId);
+    if (it == queues.end() || !it->second.inFlight) {
+        return;
+    }
+    Command &command = *it->second.inFlight;
+    // Zaman aşımı sonrası yeniden gönderilmiş komutun eski cevabı
+    if (command.id != id || command.attempt != attempt) {
+        return;
+    }
+
+    if (result != Result::Success && isRetryable(result) && command.attempt <= command.spec.maxRetries) {
+        histograms[command.spec.name].retries++;
+        send(systemId);
+        return;
+    }
+    finish(systemId, result == Result::Success, result);
+}
+
+void CommandPipeline::onTimeout(int systemId) {
+    auto it = queues.find(systemId);
+    if (it == queues.end() || !it->second.inFlight) {
+        return;
+    }
+    Command &command = *it->second.inFlight;
+    if (command.attempt <= command.spec.maxRetries) {
+        LOG_STRUCTURED(WARNING, "%1 timed out, retrying (%2/%3)", command.spec.name, command.attempt,
+                       command.spec.maxRetries);
+        histograms[command.spec.name].retries++;
+        send(systemId);
+        return;
+    }
+    finish(systemId, false, Result::Timeout);
+}
+
+void CommandPipeline::finish(int systemId, bool success, Result result) {
+    VehicleQueue &queue = queueFor(systemId);
+    queue.timer->stop();
+    Command command = std::move(*queue.inFlight);
+    queue.inFlight.reset();
+
+    const qint64 latencyMs = command.clock.isValid() ? command.clock.elapsed() : 0;
+    LatencyHistogram &histogram = histograms[command.spec.name];
+    histogram.add(latencyMs);
+    if (!success) {
+        ++histogram.failures;
+    }
+
+    Logger::instance().log(command.spec.name + (success ? " succeeded" : " failed: " + resultToString(result)) + " (" +
+                               QString::number(latencyMs) + " ms, " + QString::number(command.attempt) + " attempt)",
+                           success ? INFO : ERROR);
+
+    emit commandFinished(command.id, systemId, command.spec.name, success, resultToString(result), latencyMs, command.attempt);
+    if (command.done) {
+        command.done(success, result);
+    }
+
+    startNext(systemId);
+}
+
+void CommandPipeline::cancelVehicle(int systemId) {
+    auto it = queues.find(systemId);
+    if (it == queues.end()) {
+        return;
+    }
+
+    // Bekleyenler "başarısız" olarak bildirilir ki zincirler de sonlansın
+    std::deque<Command> cancelled = std::move(it->second.pending);
+    it->second.pending.clear();
+    if (it->second.inFlight) {
+        cancelled.push_front(std::move(*it->second.inFlight));
+        it->second.inFlight.reset();
+    }
+    it->second.timer->stop();
+
+    for (Command &command : cancelled) {
+        emit commandFinished(command.id, systemId, command.spec.name, false, "Cancelled", 0, command.attempt);
+        if (command.done) {
+            command.done(false, Result::Unknown);
+        }
+    }
+}
+
+void CommandPipeline::cancelAll() {
+    std::vector<int> systemIds;
+    for (const auto &entry : queues) {
+        systemIds.push_back(entry.first);
+    }
+    for (int systemId : systemIds) {
+        cancelVehicle(systemId);
+    }
+}
+
+int CommandPipeline::inFlightCount() const {
+    int count = 0;
+    for (const auto &entry : queues) {
+        count += entry.second.inFlight ? 1 : 0;
+    }
+    return count;
+}
+
+int CommandPipeline::queuedCount(int systemId) const {
+    auto it = queues.find(systemId);
+    return it == queues.end() ? 0 : static_cast<int>(it->second.pending.size());
+}
+
+const QMap<QString, CommandPipeline::LatencyHistogram> &CommandPipeline::latencyHistograms() const {
+    return histograms;
+}
+
+QString CommandPipeline::latencyReport() const {
+    QStringList lines;
+    for (auto it = histograms.cbegin(); it != histograms.cend(); ++it) {
+        const LatencyHistogram &h = it.value();
+        lines << QString("%1: n=%2 fail=%3 retry=%4 mean=%5 ms p50<=%6 ms p90<=%7 ms p99<=%8 ms max=%9 ms")
+                     .arg(it.key()).arg(h.count).arg(h.failures).arg(h.retries)
+                     .arg(h.meanMs(), 0, 'f', 1)
+                     .arg(h.percentileMs(0.50)).arg(h.percentileMs(0.90)).arg(h.percentileMs(0.99)).arg(h.maxMs);
+    }
+    return lines.join('\n');
+}
+
+QString CommandPipeline::resultToString(Result result) {
+    std::stringstream ss;
+    ss << result;
+    return QString::fromStdString(ss.str());
+}
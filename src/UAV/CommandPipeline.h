@@ -0,0 +1,120 @@
+#ifndef COMMANDPIPELINE_H
+#define COMMANDPIPELINE_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QMap>
+#include <QTimer>
+#include <array>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <mavsdk/plugins/action/action.h>
+
+// Araç başına sıralı, bloklamayan Action komut hattı. GUI thread'inde yaşar.
+// Komutlar MAVSDK'nın *_async fonksiyonlarıyla gönderilir; sonuç MAVSDK thread'inden
+// GUI thread'ine taşınır. Her araçta aynı anda tek komut uçuştadır, diğerleri kuyrukta bekler.
+// Yeniden deneme komut başına isteğe bağlıdır: sadece tekrarlanması zararsız komutlar
+// (hız/irtifa ayarı gibi) maxRetries verir. Arm ve kalkış gibi komutlar araca ulaşmış ama
+// cevabı kaybolmuş olabilir, bu yüzden varsayılan olarak tek denemede sonuçlanır.
+// Eski denemelerden gelen geç cevaplar deneme numarası ile ayıklanır.
+class CommandPipeline : public QObject {
+    Q_OBJECT
+
+public:
+    using CommandId = quint64;
+    using Result = mavsdk::Action::Result;
+    using Completion = std::function<void(Result)>;
+    // MAVSDK *_async çağrısını başlatır, sonucu completion ile bildirir
+    using Starter = std::function<void(Completion)>;
+    using FinishedCallback = std::function<void(bool success, Result result)>;
+
+    static constexpr int DefaultTimeoutMs = 3000;
+    static constexpr int IdempotentMaxRetries = 2;
+
+    struct CommandSpec {
+        QString name;
+        Starter start;
+        int timeoutMs = DefaultTimeoutMs;
+        int maxRetries = 0;  // Zaman aşımı/Busy/ConnectionError sonrası tekrar sayısı
+    };
+
+    // Komut gecikmesi (ilk gönderimden son cevaba) için log2 ölçekli histogram
+    struct LatencyHistogram {
+        static constexpr int BucketCount = 16;  // i. kova <= 2^i ms, son kova taşma
+        std::array<quint32, BucketCount> buckets{};
+        quint64 count = 0;
+        quint64 failures = 0;
+        quint64 retries = 0;
+        qint64 totalMs = 0;
+        qint64 maxMs = 0;
+
+        void add(qint64 latencyMs);
+        qint64 percentileMs(double q) const;  // Kova üst sınırı
+        double meanMs() const;
+    };
+
+    explicit CommandPipeline(QObject *parent = nullptr);
+    ~CommandPipeline();
+
+    CommandId submit(int systemId, CommandSpec spec, FinishedCallback done = {});
+
+    // Adımlar sırayla çalışır; bir adım başarısız olursa kalanlar gönderilmez.
+    // Sonraki adım kuyruğun başına eklenir, araya başka komut girmez.
+    CommandId submitChain(int systemId, const QString &name, std::vector<CommandSpec> steps, FinishedCallback done = {});
+
+    // Bekleyen ve uçuştaki komutları iptal eder (bağlantı kesilirken)
+    void cancelVehicle(int systemId);
+    void cancelAll();
+
+    int inFlightCount() const;
+    int queuedCount(int systemId) const;
+
+    const QMap<QString, LatencyHistogram> &latencyHistograms() const;
+    QString latencyReport() const;
+
+    static QString resultToString(Result result);
+
+signals:
+    void commandStarted(CommandPipeline::CommandId id, int systemId, const QString &name, int attempt);
+    void commandFinished(CommandPipeline::CommandId id, int systemId, const QString &name, bool success,
+                         const QString &result, qint64 latencyMs, int attempts);
+    void chainFinished(CommandPipeline::CommandId chainId, int systemId, const QString &name, bool success);
+
+private:
+    struct Command {
+        CommandId id = 0;
+        int systemId = 0;
+        CommandSpec spec;
+        FinishedCallback done;
+        int attempt = 0;
+        QElapsedTimer clock;
+    };
+
+    struct VehicleQueue {
+        std::deque<Command> pending;
+        std::optional<Command> inFlight;
+        QTimer *timer = nullptr;
+    };
+
+    struct Chain;
+
+    CommandId enqueue(int systemId, CommandSpec spec, FinishedCallback done, bool front);
+    VehicleQueue &queueFor(int systemId);
+    void startNext(int systemId);
+    void send(int systemId);
+    void onResult(int systemId, CommandId id, int attempt, Result result);
+    void onTimeout(int systemId);
+    void finish(int systemId, bool success, Result result);
+    void runChainStep(const std::shared_ptr<Chain> &chain);
+
+    static bool isRetryable(Result result);
+
+    std::map<int, VehicleQueue> queues;
+    QMap<QString, LatencyHistogram> histograms;
+    CommandId nextId = 1;
+};
+
+#endif // COMMANDPIPELINE_H
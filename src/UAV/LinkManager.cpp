@@ -0,0 +1,363 @@
+#include "LinkManager.h"
+#include "src/UAV/MavlinkForwarder.h"
+#include "src/Utils/Logger.h"
+#include "src/Utils/TaskExecutor.h"
+#include <QStringList>
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
+
+using namespace mavsdk;
+
+namespace {
+// Kayıp oranı her değerlendirmede bu ağırlıkla yumuşatılır (~500 ms zaman sabiti)
+constexpr double LossSmoothing = 0.8;
+
+QString connectionResultText(ConnectionResult result) {
+    std::ostringstream stream;
+    stream << result;
+    return QString::fromStdString(stream.str());
+}
+}
+
+LinkManager::LinkManager(QObject *parent)
+    : QObject(parent),
+    evaluateTimer(new QTimer(this)) {
+    evaluateTimer->setInterval(EvaluateIntervalMs);
+    connect(evaluateTimer, &QTimer::timeout, this, &LinkManager::evaluate);
+}
+
+LinkManager::~LinkManager() {
+    removeAll();
+}
+
+std::int64_t LinkManager::nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int LinkManager::addLink(const QString &url) {
+    auto link = std::make_unique<Link>();
+    link->url = url;
+    link->mavsdk = std::make_shared<Mavsdk>(Mavsdk::Configuration{ComponentType::GroundStation});
+    link->counters = std::make_shared<Counters>();
+    link->counters->lastSequence.fill(-1);
+    link->counters->forwarder = forwarder;
+
+    // Alım thread'inde çalışır: sadece atomik sayaçlara dokunur, mesajı değiştirmez
+    std::shared_ptr<Counters> counters = link->counters;
+    link->mavsdk->intercept_incoming_messages_async([counters](mavlink_message_t &message) {
+        if (counters->forwarder && counters->forwarding.load(std::memory_order_relaxed)) {
+            counters->forwarder->forward(message);
+        }
+
+        // Radyo modemlerin kendi mesajları (RADIO_STATUS vb.) hava linki koptuğunda da akar,
+        // bu yüzden sadece otopilotun mesajları sayılır
+        if (message.compid != MAV_COMP_ID_AUTOPILOT1) {
+            return true;
+        }
+        const std::int64_t now = nowUs();
+        std::int16_t &last = counters->lastSequence[message.sysid];
+        if (last >= 0) {
+            const int gap = (message.seq - last - 1) & 0xFF;
+            if (gap < 128) {  // Büyük boşluk tekrar/yeniden sıralama sayılır
+                counters->lost.fetch_add(static_cast<quint64>(gap), std::memory_order_relaxed);
+            }
+        }
+        last = message.seq;
+        counters->received.fetch_add(1, std::memory_order_relaxed);
+        counters->lastMessageUs.store(now, std::memory_order_relaxed);
+        if (message.msgid == MAVLINK_MSG_ID_HEARTBEAT) {
+            counters->lastHeartbeatUs.store(now, std::memory_order_relaxed);
+        }
+        return true;
+    });
+
+    link->retryTimer = new QTimer(this);
+    link->retryTimer->setSingleShot(true);
+
+    const int index = static_cast<int>(links.size());
+    connect(link->retryTimer, &QTimer::timeout, this, [this, index]() { connectLink(index); });
+    links.push_back(std::move(link));
+
+    if (!evaluateTimer->isActive()) {
+        evaluateTimer->start();
+    }
+    connectLink(index);
+    return index;
+}
+
+void LinkManager::connectLink(int index) {
+    Link &link = *links[static_cast<std::size_t>(index)];
+    if (link.connecting || link.hasConnectionHandle) {
+        return;
+    }
+    link.connecting = true;
+    setLinkState(index, LinkState::Connecting);
+
+    // Seri port açmak bloklayabilir; Mavsdk görev bitene kadar görevde tutulur
+    std::shared_ptr<Mavsdk> sdk = link.mavsdk;
+    const std::string url = link.url.toStdString();
+    const quint64 linkGeneration = generation;
+    TaskExecutor::instance().submit(this, [sdk, url](const CancellationToken &) {
+        return sdk->add_any_connection_with_handle(url);
+    }, [this, sdk, linkGeneration, index](const std::pair<ConnectionResult, Handle<>> &added) {
+        if (linkGeneration != generation) {
+            // removeAll() sonrası gelen bağlantı geri alınır
+            if (added.first == ConnectionResult::Success) {
+                sdk->remove_connection(added.second);
+            }
+            return;
+        }
+        onLinkConnected(linkGeneration, index, added.first, added.second);
+    }, TaskExecutor::Priority::High);
+}
+
+void LinkManager::onLinkConnected(quint64 linkGeneration, int index, ConnectionResult result, Handle<> handle) {
+    Link &link = *links[static_cast<std::size_t>(index)];
+    link.connecting = false;
+
+    if (result == ConnectionResult::Success) {
+        link.connectionHandle = handle;
+        link.hasConnectionHandle = true;
+        // Önceki oturumdan kalan zaman damgaları yeni bağlantıyı hemen düşürmesin
+        link.counters->lastHeartbeatUs.store(nowUs(), std::memory_order_relaxed);
+        Logger::instance().log("Link " + QString::number(index) + " added: " + link.url, INFO);
+    } else {
+        Logger::instance().log("Link " + QString::number(index) + " (" + link.url + ") failed: " +
+                                   connectionResultText(result), WARNING);
+    }
+
+    if (!link.reported) {
+        link.reported = true;
+        emit linkAdded(index, result);
+        if (linkGeneration != generation) {
+            return;  // Sinyali dinleyen taraf linkleri kaldırdı
+        }
+    }
+
+    if (result != ConnectionResult::Success) {
+        setLinkState(index, LinkState::Down);
+        scheduleReconnect(index);
+    }
+}
+
+void LinkManager::dropLink(int index) {
+    Link &link = *links[static_cast<std::size_t>(index)];
+    if (!link.hasConnectionHandle) {
+        return;
+    }
+    link.hasConnectionHandle = false;
+
+    // Seri portu kapatmak alım thread'ini beklediği için arka planda yapılır
+    std::shared_ptr<Mavsdk> sdk = link.mavsdk;
+    const Handle<> handle = link.connectionHandle;
+    TaskExecutor::instance().submit([sdk, handle](const CancellationToken &) {
+        sdk->remove_connection(handle);
+    }, TaskExecutor::Priority::High);
+}
+
+void LinkManager::scheduleReconnect(int index) {
+    Link &link = *links[static_cast<std::size_t>(index)];
+    if (link.retryTimer->isActive()) {
+        return;
+    }
+    ++link.reconnects;
+    Logger::instance().log("Link " + QString::number(index) + " reconnect in " +
+                               QString::number(link.backoffMs) + " ms (attempt " +
+                               QString::number(link.reconnects) + ")", INFO);
+    link.retryTimer->start(link.backoffMs);
+    link.backoffMs = std::min(link.backoffMs * 2, MaxBackoffMs);
+}
+
+void LinkManager::evaluate() {
+    const quint64 evaluationGeneration = generation;
+    const std::int64_t now = nowUs();
+
+    for (std::size_t i = 0; i < links.size(); ++i) {
+        Link &link = *links[i];
+        if (!link.hasConnectionHandle) {
+            continue;  // Bağlanıyor ya da yeniden deneme bekliyor
+        }
+
+        const Counters &counters = *link.counters;
+        const quint64 received = counters.received.load(std::memory_order_relaxed);
+        const quint64 lost = counters.lost.load(std::memory_order_relaxed);
+        const quint64 newReceived = received - link.seenReceived;
+        const quint64 newLost = lost - link.seenLost;
+        link.seenReceived = received;
+        link.seenLost = lost;
+        if (newReceived + newLost > 0) {
+            const double windowLoss = static_cast<double>(newLost) / static_cast<double>(newReceived + newLost);
+            link.lossRatio = LossSmoothing * link.lossRatio + (1.0 - LossSmoothing) * windowLoss;
+        }
+
+        const std::int64_t lastMessageUs = counters.lastMessageUs.load(std::memory_order_relaxed);
+        const std::int64_t lastHeartbeatUs = counters.lastHeartbeatUs.load(std::memory_order_relaxed);
+
+        LinkState state;
+        if (now - lastHeartbeatUs > static_cast<std::int64_t>(LinkDownMs) * 1000) {
+            state = LinkState::Down;
+        } else if (lastMessageUs == 0) {
+            state = LinkState::Connecting;
+        } else if (now - lastMessageUs > static_cast<std::int64_t>(StaleMs) * 1000) {
+            state = LinkState::Stale;
+        } else {
+            state = LinkState::Up;
+        }
+
+        if (state != link.state) {
+            setLinkState(static_cast<int>(i), state);
+            if (evaluationGeneration != generation) {
+                return;
+            }
+        }
+        if (state == LinkState::Up) {
+            link.backoffMs = InitialBackoffMs;
+        } else if (state == LinkState::Down) {
+            dropLink(static_cast<int>(i));
+            scheduleReconnect(static_cast<int>(i));
+        }
+    }
+
+    // En düşük kayıplı sağlıklı link; eşitlikte listede önce gelen (birincil) tercih edilir
+    int best = NoLink;
+    for (std::size_t i = 0; i < links.size(); ++i) {
+        if (links[i]->state == LinkState::Up &&
+            (best == NoLink || links[i]->lossRatio < links[static_cast<std::size_t>(best)]->lossRatio)) {
+            best = static_cast<int>(i);
+        }
+    }
+    if (best == NoLink) {
+        betterLinkSinceUs = 0;
+        return;  // Sağlıklı link yok: aktif link korunur, komutlar yeniden denemeye devam eder
+    }
+
+    if (active == NoLink) {
+        setActiveLink(best, "first healthy link");
+        return;
+    }
+    const Link &current = *links[static_cast<std::size_t>(active)];
+    if (current.state != LinkState::Up) {
+        setActiveLink(best, "active link " + linkStateToString(current.state).toLower());
+        return;
+    }
+    if (best != active && current.lossRatio - links[static_cast<std::size_t>(best)]->lossRatio > SwitchLossMargin) {
+        if (betterLinkSinceUs == 0) {
+            betterLinkSinceUs = now;
+        } else if (now - betterLinkSinceUs >= static_cast<std::int64_t>(SwitchHoldMs) * 1000) {
+            setActiveLink(best, QString("packet loss %1% vs %2%")
+                                    .arg(current.lossRatio * 100.0, 0, 'f', 1)
+                                    .arg(links[static_cast<std::size_t>(best)]->lossRatio * 100.0, 0, 'f', 1));
+        }
+    } else {
+        betterLinkSinceUs = 0;
+    }
+}
+
+void LinkManager::setLinkState(int index, LinkState state) {
+    Link &link = *links[static_cast<std::size_t>(index)];
+    if (link.state == state) {
+        return;
+    }
+    link.state = state;
+    Logger::instance().log("Link " + QString::number(index) + " (" + link.url + "): " + linkStateToString(state), INFO);
+    emit linkStateChanged(index, state);
+}
+
+void LinkManager::setActiveLink(int index, const QString &reason) {
+    betterLinkSinceUs = 0;
+    if (index == active) {
+        return;
+    }
+    active = index;
+    for (std::size_t i = 0; i < links.size(); ++i) {
+        links[i]->counters->forwarding.store(static_cast<int>(i) == index, std::memory_order_relaxed);
+    }
+    Logger::instance().log("Active link: " + QString::number(index) + " (" +
+                               links[static_cast<std::size_t>(index)]->url + "), " + reason, INFO);
+    emit activeLinkChanged(index);
+}
+
+void LinkManager::removeAll() {
+    ++generation;
+    evaluateTimer->stop();
+    for (std::size_t i = 0; i < links.size(); ++i) {
+        Link &link = *links[i];
+        link.retryTimer->stop();
+        link.retryTimer->deleteLater();
+        link.mavsdk->intercept_incoming_messages_async(nullptr);
+        // Araç plugin'leri Mavsdk'yı paylaşabilir; sadece bağlantı kapatılır (arka planda), örnek son sahibiyle yok olur
+        dropLink(static_cast<int>(i));
+    }
+    links.clear();
+    active = NoLink;
+    betterLinkSinceUs = 0;
+}
+
+void LinkManager::setForwarder(MavlinkForwarder *mavlinkForwarder) {
+    forwarder = mavlinkForwarder;
+}
+
+int LinkManager::linkCount() const {
+    return static_cast<int>(links.size());
+}
+
+int LinkManager::activeLink() const {
+    return active;
+}
+
+std::shared_ptr<Mavsdk> LinkManager::mavsdk(int index) const {
+    if (index < 0 || index >= linkCount()) {
+        return nullptr;
+    }
+    return links[static_cast<std::size_t>(index)]->mavsdk;
+}
+
+LinkManager::LinkStatus LinkManager::status(int index) const {
+    LinkStatus result;
+    if (index < 0 || index >= linkCount()) {
+        return result;
+    }
+    const Link &link = *links[static_cast<std::size_t>(index)];
+    const std::int64_t now = nowUs();
+    const std::int64_t lastMessageUs = link.counters->lastMessageUs.load(std::memory_order_relaxed);
+    const std::int64_t lastHeartbeatUs = link.counters->lastHeartbeatUs.load(std::memory_order_relaxed);
+
+    result.url = link.url;
+    result.state = link.state;
+    result.lossRatio = link.lossRatio;
+    result.sinceLastMessageMs = lastMessageUs == 0 ? -1 : (now - lastMessageUs) / 1000;
+    result.sinceHeartbeatMs = lastMessageUs == 0 ? -1 : (now - lastHeartbeatUs) / 1000;
+    result.received = link.counters->received.load(std::memory_order_relaxed);
+    result.lost = link.counters->lost.load(std::memory_order_relaxed);
+    result.reconnects = link.reconnects;
+    return result;
+}
+
+QString LinkManager::statusReport() const {
+    QStringList lines;
+    for (int i = 0; i < linkCount(); ++i) {
+        const LinkStatus link = status(i);
+        lines << QString("%1%2 %3: %4, loss %5%, last message %6 ms, reconnects %7")
+                     .arg(i == active ? "*" : " ")
+                     .arg(i)
+                     .arg(link.url)
+                     .arg(linkStateToString(link.state))
+                     .arg(link.lossRatio * 100.0, 0, 'f', 1)
+                     .arg(link.sinceLastMessageMs)
+                     .arg(link.reconnects);
+    }
+    return lines.join("\n");
+}
+
+QString LinkManager::linkStateToString(LinkState state) {
+    switch (state) {
+    case LinkState::Connecting: return "Connecting";
+    case LinkState::Up: return "Up";
+    case LinkState::Stale: return "Stale";
+    case LinkState::Down: return "Down";
+    }
+    return "Unknown";
+}
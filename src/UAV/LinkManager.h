@@ -0,0 +1,123 @@
+#ifndef LINKMANAGER_H
+#define LINKMANAGER_H
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <mavsdk/mavsdk.h>
+
+class MavlinkForwarder;
+
+// Aynı araca giden birden fazla MAVLink bağlantısı (ör. birincil telemetri radyosu + yedek link).
+// Her link kendi Mavsdk örneğine sahiptir; plugin'ler sadece aktif linkin System nesnesi üzerinde
+// kurulduğu için komut trafiği tek bir linkten çıkar.
+//
+// Gelen her mesaj MAVSDK alım thread'inde sayılır: otopilotun paket sıra numarasındaki boşluklar
+// kayıp, HEARTBEAT zamanı da linkin canlılığı olarak tutulur. Sağlık GUI thread'inde
+// EvaluateIntervalMs'de bir değerlendirilir; aktif link StaleMs boyunca susarsa ya da kayıp oranı
+// SwitchHoldMs boyunca belirgin şekilde kötüyse en sağlıklı linke geçilir.
+// LinkDownMs boyunca heartbeat gelmeyen link kaldırılır ve üstel bekleme ile yeniden eklenir;
+// bağlantı ekleme TaskExecutor'da yürür, GUI thread'i hiçbir adımda beklemez.
+class LinkManager : public QObject {
+    Q_OBJECT
+
+public:
+    enum class LinkState { Connecting, Up, Stale, Down };
+
+    static constexpr int NoLink = -1;
+    static constexpr int EvaluateIntervalMs = 100;
+    static constexpr int StaleMs = 300;        // Akan telemetride bu kadar sessizlik linkin sorunlu olduğunu gösterir
+    static constexpr int LinkDownMs = 3000;    // Heartbeat'siz geçen bu süreden sonra link yeniden kurulur
+    static constexpr int SwitchHoldMs = 1000;  // Kayıp farkına dayalı geçiş için farkın sürmesi gereken süre
+    static constexpr double SwitchLossMargin = 0.15;
+    static constexpr int InitialBackoffMs = 500;
+    static constexpr int MaxBackoffMs = 10000;
+
+    struct LinkStatus {
+        QString url;
+        LinkState state = LinkState::Down;
+        double lossRatio = 0.0;          // Üstel ortalama, 0..1
+        qint64 sinceLastMessageMs = -1;  // -1: henüz mesaj yok
+        qint64 sinceHeartbeatMs = -1;
+        quint64 received = 0;
+        quint64 lost = 0;
+        int reconnects = 0;
+    };
+
+    explicit LinkManager(QObject *parent = nullptr);
+    ~LinkManager();
+
+    // Bağlantıyı arka planda ekler ve indeksini döndürür; sonuç linkAdded ile gelir.
+    // Başarısız veya düşen link removeAll() çağrılana kadar üstel beklemeyle yeniden denenir.
+    int addLink(const QString &url);
+    void removeAll();
+
+    int linkCount() const;
+    int activeLink() const;
+    std::shared_ptr<mavsdk::Mavsdk> mavsdk(int index) const;
+    LinkStatus status(int index) const;
+    QString statusReport() const;
+    static QString linkStateToString(LinkState state);
+
+    // Aktif linkten gelen ham çerçeveler bu yönlendiriciye de verilir (sonraki addLink'lerden itibaren)
+    void setForwarder(MavlinkForwarder *mavlinkForwarder);
+
+signals:
+    void linkAdded(int index, mavsdk::ConnectionResult result);  // Sadece ilk ekleme denemesi
+    void linkStateChanged(int index, LinkManager::LinkState state);
+    void activeLinkChanged(int index);
+
+private:
+    // MAVSDK alım thread'inin yazdığı sayaçlar; callback Link'ten uzun yaşayabileceği için ayrı tutulur
+    struct Counters {
+        std::atomic<quint64> received{0};
+        std::atomic<quint64> lost{0};
+        std::atomic<std::int64_t> lastMessageUs{0};
+        std::atomic<std::int64_t> lastHeartbeatUs{0};
+        std::array<std::int16_t, 256> lastSequence;  // Sistem ID'sine göre, sadece alım thread'i dokunur
+        std::atomic<bool> forwarding{false};          // Sadece aktif link yönlendirir (yinelenen çerçeve olmasın)
+        MavlinkForwarder *forwarder = nullptr;
+    };
+
+    struct Link {
+        QString url;
+        std::shared_ptr<mavsdk::Mavsdk> mavsdk;
+        std::shared_ptr<Counters> counters;
+        mavsdk::Handle<> connectionHandle;
+        bool hasConnectionHandle = false;
+        bool connecting = false;
+        bool reported = false;  // linkAdded yayınlandı mı
+        LinkState state = LinkState::Connecting;
+
+        // GUI thread'i
+        QTimer *retryTimer = nullptr;
+        int backoffMs = InitialBackoffMs;
+        int reconnects = 0;
+        quint64 seenReceived = 0;
+        quint64 seenLost = 0;
+        double lossRatio = 0.0;
+    };
+
+    void connectLink(int index);
+    void onLinkConnected(quint64 linkGeneration, int index, mavsdk::ConnectionResult result, mavsdk::Handle<> handle);
+    void dropLink(int index);
+    void scheduleReconnect(int index);
+    void evaluate();
+    void setLinkState(int index, LinkState state);
+    void setActiveLink(int index, const QString &reason);
+    static std::int64_t nowUs();
+
+    std::vector<std::unique_ptr<Link>> links;
+    int active = NoLink;
+    MavlinkForwarder *forwarder = nullptr;
+    quint64 generation = 0;  // removeAll() sonrası gelen geç sonuçları ayıklar
+    std::int64_t betterLinkSinceUs = 0;
+    QTimer *evaluateTimer;
+};
+
+#endif // LINKMANAGER_H
@@ -0,0 +1,392 @@
+#include "MavlinkForwarder.h"
+#include "src/Utils/Logger.h"
+#include <QHostAddress>
+#include <QHostInfo>
+#include <QStringList>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QUdpSocket>
+#include <QUrl>
+#include <QUrlQuery>
+#include <algorithm>
+#include <chrono>
+
+namespace {
+std::int64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool parseMessageIds(const QString &text, std::vector<std::uint32_t> &ids) {
+    for (const QString &part : text.split(',', Qt::SkipEmptyParts)) {
+        bool ok = false;
+        const uint id = part.trimmed().toUInt(&ok);
+        if (!ok) {
+            return false;
+        }
+        ids.push_back(id);
+    }
+    return !ids.empty();
+}
+}
+
+struct MavlinkForwarder::Endpoint {
+    EndpointConfig config;
+
+    // Yönlendirme thread'i
+    std::unique_ptr<QUdpSocket> udp;
+    std::unique_ptr<QTcpSocket> tcp;
+    QHostAddress address;
+    double tokens = 0.0;
+    std::int64_t lastRefillUs = 0;
+    quint64 windowBytes = 0;
+
+    // Yönlendirme thread'i yazar, GUI thread'i okur
+    std::atomic<bool> connected{false};
+    std::atomic<quint64> frames{0};
+    std::atomic<quint64> bytes{0};
+    std::atomic<quint64> filtered{0};
+    std::atomic<quint64> rateLimited{0};
+    std::atomic<quint64> dropped{0};
+    std::atomic<quint64> bytesPerSecond{0};
+
+    bool accepts(std::uint32_t messageId) const {
+        if (config.filterMode == FilterMode::None) {
+            return true;
+        }
+        const bool listed = std::binary_search(config.messageIds.begin(), config.messageIds.end(), messageId);
+        return config.filterMode == FilterMode::Allow ? listed : !listed;
+    }
+};
+
+MavlinkForwarder::MavlinkForwarder(QObject *parent)
+    : QObject(parent),
+    queue(QueueCapacity) {
+    thread.setObjectName("MavlinkForwarder");
+}
+
+MavlinkForwarder::~MavlinkForwarder() {
+    stop();
+}
+
+bool MavlinkForwarder::parseEndpoint(const QString &spec, EndpointConfig &config, QString *error) {
+    auto fail = [error](const QString &message) {
+        if (error) {
+            *error = message;
+        }
+        return false;
+    };
+
+    const QUrl url(spec);
+    if (!url.isValid() || url.host().isEmpty() || url.port() <= 0) {
+        return fail("Expected udp://host:port or tcp://host:port, got \"" + spec + "\"");
+    }
+
+    EndpointConfig parsed;
+    parsed.name = spec;
+    parsed.host = url.host();
+    parsed.port = static_cast<quint16>(url.port());
+    if (url.scheme() == "udp") {
+        parsed.transport = Transport::Udp;
+    } else if (url.scheme() == "tcp") {
+        parsed.transport = Transport::Tcp;
+    } else {
+        return fail("Unsupported forwarding scheme \"" + url.scheme() + "\"");
+    }
+
+    const QUrlQuery query(url);
+    if (query.hasQueryItem("allow") && query.hasQueryItem("deny")) {
+        return fail("allow and deny filters cannot be combined");
+    }
+    if (query.hasQueryItem("allow")) {
+        parsed.filterMode = FilterMode::Allow;
+        if (!parseMessageIds(query.queryItemValue("allow"), parsed.messageIds)) {
+            return fail("Invalid message ID list in allow filter");
+        }
+    } else if (query.hasQueryItem("deny")) {
+        parsed.filterMode = FilterMode::Deny;
+        if (!parseMessageIds(query.queryItemValue("deny"), parsed.messageIds)) {
+            return fail("Invalid message ID list in deny filter");
+        }
+    }
+
+    bool ok = true;
+    if (query.hasQueryItem("rate")) {
+        parsed.maxBytesPerSecond = query.queryItemValue("rate").toDouble(&ok);
+        if (!ok || parsed.maxBytesPerSecond < 0.0) {
+            return fail("Invalid rate limit");
+        }
+    }
+    if (query.hasQueryItem("burst")) {
+        parsed.burstBytes = query.queryItemValue("burst").toDouble(&ok);
+        if (!ok || parsed.burstBytes < 0.0) {
+            return fail("Invalid burst size");
+        }
+    }
+
+    config = std::move(parsed);
+    return true;
+}
+
+bool MavlinkForwarder::addEndpoint(EndpointConfig config) {
+    if (isRunning()) {
+        Logger::instance().log("Forwarding endpoints can only be added while the forwarder is stopped.", WARNING);
+        return false;
+    }
+    if (config.name.isEmpty()) {
+        config.name = QString(config.transport == Transport::Udp ? "udp://" : "tcp://") +
+                      config.host + ":" + QString::number(config.port);
+    }
+    std::sort(config.messageIds.begin(), config.messageIds.end());
+    if (config.maxBytesPerSecond > 0.0 && config.burstBytes <= 0.0) {
+        config.burstBytes = config.maxBytesPerSecond;
+    }
+
+    auto endpoint = std::make_unique<Endpoint>();
+    endpoint->config = std::move(config);
+    Logger::instance().log("Forwarding endpoint added: " + endpoint->config.name, INFO);
+    endpoints.push_back(std::move(endpoint));
+    return true;
+}
+
+int MavlinkForwarder::endpointCount() const {
+    return static_cast<int>(endpoints.size());
+}
+
+bool MavlinkForwarder::isRunning() const {
+    return running.load(std::memory_order_acquire);
+}
+
+void MavlinkForwarder::start() {
+    if (isRunning() || endpoints.empty()) {
+        return;
+    }
+    thread.start();
+    drainScheduled.store(false, std::memory_order_relaxed);
+    worker = new QObject;
+    worker->moveToThread(&thread);
+    // Bu noktadan sonra gelen uyandırmalar thread'in olay kuyruğunda openEndpoints'in arkasına girer
+    running.store(true, std::memory_order_release);
+    QMetaObject::invokeMethod(worker, [this]() { openEndpoints(); }, Qt::BlockingQueuedConnection);
+    Logger::instance().log("MAVLink forwarder started with " + QString::number(endpoints.size()) + " endpoint(s).", INFO);
+}
+
+void MavlinkForwarder::stop() {
+    if (!isRunning()) {
+        return;
+    }
+    // running indirildikten sonra başlayan forward() worker'a dokunmaz; süren çağrılar beklenir.
+    // forward() bloklamadığı için bekleme kısadır.
+    running.store(false, std::memory_order_seq_cst);
+    while (activeForwards.load(std::memory_order_seq_cst) != 0) {
+        QThread::yieldCurrentThread();
+    }
+
+    // Kuyrukta kalan çerçeveler gönderilir, soketler kendi thread'inde kapatılır
+    QMetaObject::invokeMethod(worker, [this]() {
+        drain();
+        closeEndpoints();
+    }, Qt::BlockingQueuedConnection);
+    thread.quit();
+    thread.wait();
+    delete worker;
+    worker = nullptr;
+
+    Logger::instance().log("MAVLink forwarder stopped.\n" + statisticsReport(), INFO);
+}
+
+bool MavlinkForwarder::forward(const mavlink_message_t &message) {
+    // Sayaç running kontrolünden önce artırılır: stop() ya bu çağrıyı görür ya da bu çağrı running'i false görür
+    activeForwards.fetch_add(1, std::memory_order_seq_cst);
+    struct ActiveScope {
+        std::atomic<int> &count;
+        ~ActiveScope() { count.fetch_sub(1, std::memory_order_release); }
+    } scope{activeForwards};
+
+    if (!running.load(std::memory_order_seq_cst)) {
+        return false;
+    }
+
+    // Tek seri hale getirme: çerçeve doğrudan kuyruk hücresine yazılır
+    const bool queued = queue.tryEmplace([&message](Frame &frame) {
+        frame.messageId = message.msgid;
+        frame.length = mavlink_msg_to_send_buffer(frame.bytes, &message);
+    });
+    if (!queued) {
+        overflows.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Yönlendirme thread'i uyanık değilse bir kez uyandırılır; çerçeve başına olay gönderilmez
+    if (!drainScheduled.exchange(true, std::memory_order_acq_rel)) {
+        QMetaObject::invokeMethod(worker, [this]() { drain(); }, Qt::QueuedConnection);
+    }
+    return true;
+}
+
+void MavlinkForwarder::openEndpoints() {
+    for (auto &endpointPtr : endpoints) {
+        Endpoint &endpoint = *endpointPtr;
+        endpoint.tokens = endpoint.config.burstBytes;
+        endpoint.lastRefillUs = nowUs();
+
+        if (endpoint.config.transport == Transport::Udp) {
+            endpoint.address = QHostAddress(endpoint.config.host);
+            if (endpoint.address.isNull()) {
+                // Bu thread'de bloklamak sorun değil; GUI ve alım thread'leri etkilenmez
+                const QHostInfo info = QHostInfo::fromName(endpoint.config.host);
+                if (!info.addresses().isEmpty()) {
+                    endpoint.address = info.addresses().first();
+                }
+            }
+            if (endpoint.address.isNull()) {
+                Logger::instance().log("Cannot resolve forwarding host " + endpoint.config.host, ERROR);
+                continue;
+            }
+            endpoint.udp = std::make_unique<QUdpSocket>();
+            endpoint.connected.store(true, std::memory_order_relaxed);
+        } else {
+            endpoint.tcp = std::make_unique<QTcpSocket>();
+            Endpoint *entry = &endpoint;
+            QObject::connect(endpoint.tcp.get(), &QTcpSocket::connected, worker, [entry]() {
+                entry->connected.store(true, std::memory_order_relaxed);
+                Logger::instance().log("Forwarding endpoint connected: " + entry->config.name, INFO);
+            });
+            QObject::connect(endpoint.tcp.get(), &QTcpSocket::disconnected, worker, [entry]() {
+                entry->connected.store(false, std::memory_order_relaxed);
+                Logger::instance().log("Forwarding endpoint disconnected: " + entry->config.name, WARNING);
+            });
+            // Bağlantı reddi ve kopma aynı yoldan yeniden denenir
+            QObject::connect(endpoint.tcp.get(), &QTcpSocket::errorOccurred, worker, [this, entry]() {
+                QTimer::singleShot(TcpReconnectMs, worker, [this, entry]() { connectTcp(*entry); });
+            });
+            connectTcp(endpoint);
+        }
+    }
+
+    rateWindowStartUs = nowUs();
+    rateTimer = new QTimer(worker);
+    QObject::connect(rateTimer, &QTimer::timeout, worker, [this]() { updateRates(); });
+    rateTimer->start(RateWindowMs);
+}
+
+void MavlinkForwarder::connectTcp(Endpoint &endpoint) {
+    if (!endpoint.tcp || endpoint.tcp->state() != QAbstractSocket::UnconnectedState ||
+        !running.load(std::memory_order_acquire)) {
+        return;
+    }
+    endpoint.tcp->connectToHost(endpoint.config.host, endpoint.config.port);
+}
+
+void MavlinkForwarder::closeEndpoints() {
+    delete rateTimer;
+    rateTimer = nullptr;
+    for (auto &endpoint : endpoints) {
+        if (endpoint->tcp) {
+            endpoint->tcp->disconnect();
+            endpoint->tcp->abort();
+        }
+        endpoint->tcp.reset();
+        endpoint->udp.reset();
+        endpoint->connected.store(false, std::memory_order_relaxed);
+    }
+}
+
+void MavlinkForwarder::drain() {
+    // Bayrak önce indirilir: boşaltma sırasında gelen çerçeve yeni bir uyandırma planlar
+    drainScheduled.store(false, std::memory_order_release);
+
+    const std::int64_t now = nowUs();
+    while (queue.tryConsume([this, now](const Frame &frame) {
+        for (auto &endpoint : endpoints) {
+            send(*endpoint, frame, now);
+        }
+    })) {
+    }
+}
+
+void MavlinkForwarder::send(Endpoint &endpoint, const Frame &frame, std::int64_t now) {
+    if (!endpoint.accepts(frame.messageId)) {
+        endpoint.filtered.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (endpoint.config.maxBytesPerSecond > 0.0) {
+        const double elapsedSeconds = static_cast<double>(now - endpoint.lastRefillUs) / 1e6;
+        endpoint.lastRefillUs = now;
+        endpoint.tokens = std::min(endpoint.config.burstBytes,
+                                   endpoint.tokens + elapsedSeconds * endpoint.config.maxBytesPerSecond);
+        if (endpoint.tokens < frame.length) {
+            endpoint.rateLimited.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        endpoint.tokens -= frame.length;
+    }
+
+    const char *data = reinterpret_cast<const char *>(frame.bytes);
+    qint64 written = -1;
+    if (endpoint.udp) {
+        written = endpoint.udp->writeDatagram(data, frame.length, endpoint.address, endpoint.config.port);
+    } else if (endpoint.tcp && endpoint.tcp->state() == QAbstractSocket::ConnectedState &&
+               endpoint.tcp->bytesToWrite() < MaxTcpBacklogBytes) {
+        written = endpoint.tcp->write(data, frame.length);
+    }
+
+    if (written != frame.length) {
+        endpoint.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    endpoint.frames.fetch_add(1, std::memory_order_relaxed);
+    endpoint.bytes.fetch_add(frame.length, std::memory_order_relaxed);
+    endpoint.windowBytes += frame.length;
+}
+
+void MavlinkForwarder::updateRates() {
+    const std::int64_t now = nowUs();
+    const std::int64_t elapsedUs = std::max<std::int64_t>(1, now - rateWindowStartUs);
+    rateWindowStartUs = now;
+    for (auto &endpoint : endpoints) {
+        endpoint->bytesPerSecond.store(endpoint->windowBytes * 1000000 / static_cast<quint64>(elapsedUs),
+                                       std::memory_order_relaxed);
+        endpoint->windowBytes = 0;
+    }
+}
+
+std::vector<MavlinkForwarder::EndpointStatistics> MavlinkForwarder::statistics() const {
+    std::vector<EndpointStatistics> result;
+    result.reserve(endpoints.size());
+    for (const auto &endpoint : endpoints) {
+        EndpointStatistics stats;
+        stats.name = endpoint->config.name;
+        stats.connected = endpoint->connected.load(std::memory_order_relaxed);
+        stats.frames = endpoint->frames.load(std::memory_order_relaxed);
+        stats.bytes = endpoint->bytes.load(std::memory_order_relaxed);
+        stats.filtered = endpoint->filtered.load(std::memory_order_relaxed);
+        stats.rateLimited = endpoint->rateLimited.load(std::memory_order_relaxed);
+        stats.dropped = endpoint->dropped.load(std::memory_order_relaxed);
+        stats.bytesPerSecond = endpoint->bytesPerSecond.load(std::memory_order_relaxed);
+        result.push_back(stats);
+    }
+    return result;
+}
+
+quint64 MavlinkForwarder::queueOverflows() const {
+    return overflows.load(std::memory_order_relaxed);
+}
+
+QString MavlinkForwarder::statisticsReport() const {
+    QStringList lines;
+    for (const EndpointStatistics &stats : statistics()) {
+        lines << QString("%1 [%2]: %3 frames, %4 KB, %5 B/s, filtered %6, rate limited %7, dropped %8")
+                     .arg(stats.name)
+                     .arg(stats.connected ? "up" : "down")
+                     .arg(stats.frames)
+                     .arg(stats.bytes / 1024)
+                     .arg(stats.bytesPerSecond)
+                     .arg(stats.filtered)
+                     .arg(stats.rateLimited)
+                     .arg(stats.dropped);
+    }
+    lines << "Queue overflows: " + QString::number(queueOverflows());
+    return lines.join("\n");
+}
@@ -0,0 +1,105 @@
+#ifndef MAVLINKFORWARDER_H
+#define MAVLINKFORWARDER_H
+
+#include "src/Utils/BoundedMpscQueue.h"
+#include <QObject>
+#include <QString>
+#include <QThread>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
+
+class QTimer;
+
+// Aktif linkten gelen ham MAVLink çerçevelerini yerdeki diğer araçlara (logger, analiz,
+// ikinci operatör istasyonu) UDP/TCP üzerinden dağıtır.
+// Çerçeve MAVSDK alım thread'inde bir kez seri hale getirilip doğrudan kuyruk hücresine yazılır;
+// yönlendirme thread'i aynı hücreyi kopyalamadan bütün uç noktalara gönderir.
+// Uç nokta başına mesaj ID filtresi, bayt/s token bucket sınırı ve sayaçlar tutulur.
+// Sadece araçtan gelen yön dağıtılır; uç noktalardan gelen veri araca iletilmez.
+class MavlinkForwarder : public QObject {
+    Q_OBJECT
+
+public:
+    enum class Transport { Udp, Tcp };
+    enum class FilterMode { None, Allow, Deny };
+
+    struct EndpointConfig {
+        QString name;
+        Transport transport = Transport::Udp;
+        QString host = "127.0.0.1";
+        quint16 port = 0;
+        FilterMode filterMode = FilterMode::None;
+        std::vector<std::uint32_t> messageIds;  // addEndpoint sıralar
+        double maxBytesPerSecond = 0.0;         // 0: sınırsız
+        double burstBytes = 0.0;                // 0: bir saniyelik hız
+    };
+
+    struct EndpointStatistics {
+        QString name;
+        bool connected = false;
+        quint64 frames = 0;
+        quint64 bytes = 0;
+        quint64 filtered = 0;
+        quint64 rateLimited = 0;
+        quint64 dropped = 0;         // Soket hazır değil, gönderim hatası veya TCP birikmesi
+        quint64 bytesPerSecond = 0;  // Son bir saniye
+    };
+
+    static constexpr std::size_t QueueCapacity = 4096;
+    static constexpr qint64 MaxTcpBacklogBytes = 256 * 1024;
+    static constexpr int TcpReconnectMs = 2000;
+    static constexpr int RateWindowMs = 1000;
+
+    explicit MavlinkForwarder(QObject *parent = nullptr);
+    ~MavlinkForwarder();
+
+    // "udp://127.0.0.1:14551", "tcp://192.168.1.20:5760?allow=0,1,33&rate=20000&burst=4000"
+    static bool parseEndpoint(const QString &spec, EndpointConfig &config, QString *error = nullptr);
+
+    // Uç noktalar yönlendirici dururken eklenir
+    bool addEndpoint(EndpointConfig config);
+    int endpointCount() const;
+    void start();
+    // Süren forward() çağrılarının bitmesini bekler; worker ancak ondan sonra silinir
+    void stop();
+    bool isRunning() const;
+
+    // Herhangi bir thread'den çağrılır; bloklamaz, kuyruk doluysa çerçeve düşer
+    bool forward(const mavlink_message_t &message);
+
+    std::vector<EndpointStatistics> statistics() const;
+    quint64 queueOverflows() const;
+    QString statisticsReport() const;
+
+private:
+    struct Frame {
+        std::uint32_t messageId;
+        std::uint16_t length;
+        std::uint8_t bytes[MAVLINK_MAX_PACKET_LEN];
+    };
+    struct Endpoint;
+
+    // Yönlendirme thread'inde çalışır
+    void openEndpoints();
+    void closeEndpoints();
+    void connectTcp(Endpoint &endpoint);
+    void drain();
+    void send(Endpoint &endpoint, const Frame &frame, std::int64_t now);
+    void updateRates();
+
+    BoundedMpscQueue<Frame> queue;
+    std::vector<std::unique_ptr<Endpoint>> endpoints;
+    QThread thread;
+    QObject *worker = nullptr;  // Yönlendirme thread'inde yaşar; soketlerin ve zamanlayıcıların bağlamı
+    QTimer *rateTimer = nullptr;
+    std::int64_t rateWindowStartUs = 0;
+    std::atomic<bool> running{false};
+    std::atomic<int> activeForwards{0};  // worker'a erişebilecek, süren forward() çağrıları
+    std::atomic<bool> drainScheduled{false};
+    std::atomic<quint64> overflows{0};
+};
+
+#endif // MAVLINKFORWARDER_H
@@ -1,23 +1,73 @@
 #include "UAVManager.h"
 #include "qdebug.h"
-#include <thread>
-#include <QThread>
+#include <QDir>
+#include <QDateTime>
+#include <QFileInfo>
+#include <cmath>
+#include "src/Telemetry/TelemetryArchive.h"
+#include "src/Utils/TaskExecutor.h"
 
 using namespace mavsdk;
 
 UAVManager::UAVManager(QObject *parent)
     : QObject(parent),
-    connectedStatus(false),
-    mavsdk(std::make_unique<Mavsdk>(Mavsdk::Configuration{ComponentType::GroundStation})) {}
+    stepTimer(new QTimer(this)),
+    commands(new CommandPipeline(this)),
+    links(new LinkManager(this)),
+    forwarder(new MavlinkForwarder(this)),
+    geofence(new GeofenceMonitor(this)),
+    connectedStatus(false) {
+    stepTimer->setSingleShot(true);
+    connect(stepTimer, &QTimer::timeout, this, &UAVManager::onStepTimeout);
+    connect(links, &LinkManager::linkAdded, this, &UAVManager::onLinkAdded);
+    connect(links, &LinkManager::activeLinkChanged, this, &UAVManager::onActiveLinkChanged);
+    links->setForwarder(forwarder);
+    subscribeLog();
+}
 
 
 UAVManager::~UAVManager() {
+    // Global log callback'i bu nesneyi gösterir; nesneden önce kaldırılır
+    mavsdk::log::subscribe(nullptr);
+    cancelConnect();
     disconnectFromUAV();
 }
 
 
+void UAVManager::subscribeLog() {
+    mavsdk::log::subscribe([this](mavsdk::log::Level level, const std::string &message, const std::string &, int) {
+        {
+            QMutexLocker locker(&lastLogMutex);
+            lastLogMessage = QString::fromStdString(message);
+            lastLogLevel = level;
+        }
+
+        LOG_STRUCTURED(Logger::mavsdkLogLevelToLogger(level), "MAVSDK: %1", message.c_str());
+
+        emit mavsdkLogUpdated();
+
+        // true dönmek mesajın ayrıca stdout'a yazılmasını engeller
+        return true;
+    });
+}
+
+
+std::pair<QString, mavsdk::log::Level> UAVManager::getLastLog() const {
+    QMutexLocker locker(&lastLogMutex);
+    return {lastLogMessage, lastLogLevel};
+}
+
+
 
 std::unique_ptr<TelemetryHandler>& UAVManager::getTelemetryHandler() {
+    return getTelemetryHandler(ActiveVehicle);
+}
+
+std::unique_ptr<TelemetryHandler>& UAVManager::getTelemetryHandler(int systemId) {
+    // Replay'de araç yoktur, oynatılan kaydın işleyicisi döner
+    if (VehicleRegistry::Vehicle *vehicle = vehicleFor(systemId)) {
+        return vehicle->telemetryHandler;
+    }
     return telemetryHandler;
 }
 
@@ -60,12 +110,32 @@ QString connectionResultToString(ConnectionResult result) {
 }
 
 
+namespace {
+// Bağlantı adımının GUI thread'inde ne kadar sürdüğünü toplar
+class GuiBusyScope {
+public:
+    explicit GuiBusyScope(qint64 &totalUs) : total(totalUs) { timer.start(); }
+    ~GuiBusyScope() { total += timer.nsecsElapsed() / 1000; }
+
+private:
+    qint64 &total;
+    QElapsedTimer timer;
+};
+}
+
+
 void UAVManager::connectToUAV(const QString &portName, const QString &baudRate) {
+    GuiBusyScope busy(guiThreadBusyUs);
+
     if (connectedStatus) {
         emit connected();
         Logger::instance().log("Already connected to UAV.", INFO); // Log kaydı ekledik
         return;
     }
+    if (isConnecting()) {
+        Logger::instance().log("Connection attempt already in progress.", WARNING);
+        return;
+    }
 
     if (portName == "Simulation") {
         connectionString = "udp://:"+ baudRate;
@@ -73,65 +143,206 @@ void UAVManager::connectToUAV(const QString &portName, const QString &baudRate)
         connectionString = "serial://" + portName + ":" + baudRate;
     }
 
-    auto [connectionResult, tempHandle] = mavsdk->add_any_connection_with_handle(connectionString.toStdString());
-    if (connectionResult != ConnectionResult::Success) {
-        Logger::instance().log("Connection failed! Error message: " + connectionResultToString(connectionResult), ERROR);
+    ++connectAttempt;
+    guiThreadBusyUs = 0;
+    failedLinks = 0;
+    connectClock.start();
+    setConnectionState(ConnectionState::Connecting, connectionString);
+    stepTimer->start(DiscoveryTimeoutMs);
+
+    // Seri port açmak bloklayabilir: linkler arka planda eklenir, sonuçlar GUI thread'ine döner.
+    // Keşif, otopilottan mesaj alan ilk link aktif olunca başlar (onActiveLinkChanged).
+    connectToken = CancellationToken();
+    forwarder->start();
+    links->addLink(connectionString);
+    for (const QString &url : backupLinks) {
+        links->addLink(url);
+    }
+}
+
+
+void UAVManager::onLinkAdded(int index, ConnectionResult result) {
+    GuiBusyScope busy(guiThreadBusyUs);
+
+    if (result == ConnectionResult::Success) {
         return;
     }
-    myConnectionHandle = tempHandle;
+    Logger::instance().log("Link " + QString::number(index) + " failed: " + connectionResultToString(result) +
+                               " Retrying in background.", WARNING);
 
-    bool isConnected = false;
-    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
-    while (!isConnected && std::chrono::steady_clock::now() - startTime < std::chrono::seconds(5)) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        if (!mavsdk->systems().empty() && mavsdk->systems().at(0)->is_connected()) {
-            isConnected = true;
-        }
+    // Bağlanırken bütün linkler açılamazsa deneme başarısız olur; en az biri açıldıysa diğerleri arka planda denenir
+    if (connectionState == ConnectionState::Connecting && ++failedLinks == links->linkCount()) {
+        failConnect("Connection failed! Error message: " + connectionResultToString(result));
     }
+}
 
-    if (!isConnected) {
-        Logger::instance().log("Failed to connect, UAV not found.", ERROR);
-        mavsdk->remove_connection(myConnectionHandle);
+
+void UAVManager::onActiveLinkChanged(int index) {
+    GuiBusyScope busy(guiThreadBusyUs);
+
+    if (connectionState == ConnectionState::Disconnected || connectionState == ConnectionState::Failed) {
+        return;
+    }
+    std::shared_ptr<Mavsdk> sdk = links->mavsdk(index);
+    if (!sdk) {
         return;
     }
 
-    system = mavsdk->systems().at(0);
-    if (!system) {
-        Logger::instance().log("Failed to initialize system.", ERROR);
-        mavsdk->remove_connection(myConnectionHandle);
-        system.reset();
+    // Keşif aboneliği yeni linke taşınır; mevcut araçlar onSystemDiscovered'da yeni linkin plugin'lerine geçer
+    if (hasNewSystemHandle) {
+        discoverySdk->unsubscribe_on_new_system(newSystemHandle);
+        hasNewSystemHandle = false;
+    }
+    discoverySdk = sdk;
+    pendingSystems.fill(false);
+
+    // Sistem keşfi MAVSDK thread'inden bildirilir; abonelikten önce bulunmuş olabilir
+    const quint64 attempt = connectAttempt;
+    newSystemHandle = discoverySdk->subscribe_on_new_system([this, attempt]() {
+        QMetaObject::invokeMethod(this, [this, attempt]() { onSystemDiscovered(attempt); }, Qt::QueuedConnection);
+    });
+    hasNewSystemHandle = true;
+
+    emit activeLinkChanged(index, links->status(index).url);
+    onSystemDiscovered(attempt);
+}
+
+
+// Bağlantı boyunca açık kalır: filodaki her yeni sistem için plugin seti kurulur
+void UAVManager::onSystemDiscovered(quint64 attempt) {
+    GuiBusyScope busy(guiThreadBusyUs);
+
+    if (attempt != connectAttempt || !discoverySdk || connectionState == ConnectionState::Disconnected ||
+        connectionState == ConnectionState::Failed) {
         return;
     }
 
-    action = std::make_shared<mavsdk::Action>(system);
-    if (!action) {
-        Logger::instance().log("Failed to initialize Action plugin.", ERROR);
-        mavsdk->remove_connection(myConnectionHandle);
-        action.reset();
-        system.reset();
+    for (const auto &candidate : discoverySdk->systems()) {
+        if (!candidate || !candidate->is_connected() || !candidate->has_autopilot()) {
+            continue;
+        }
+        const std::uint8_t systemId = candidate->get_system_id();
+        if (pendingSystems[systemId]) {
+            continue;
+        }
+        // Kayıtlı araç başka linkin System nesnesindeyse (link değişimi) yeni linke taşınır
+        if (const VehicleRegistry::Vehicle *existing = vehicles.find(systemId)) {
+            if (existing->plugins.mavsdk != discoverySdk) {
+                pendingSystems[systemId] = true;
+                createPlugins(attempt, discoverySdk, candidate);
+            }
+            continue;
+        }
+        if (vehicles.size() >= VehicleRegistry::MaxVehicles) {
+            Logger::instance().log("Vehicle limit reached, ignoring system ID " + QString::number(systemId), WARNING);
+            continue;
+        }
+
+        pendingSystems[systemId] = true;
+        if (connectionState == ConnectionState::Connecting) {
+            setConnectionState(ConnectionState::Discovered, "System ID " + QString::number(systemId));
+            stepTimer->start(PluginTimeoutMs);
+        }
+        createPlugins(attempt, discoverySdk, candidate);
+    }
+}
+
+
+void UAVManager::createPlugins(quint64 attempt, std::shared_ptr<Mavsdk> sdk, std::shared_ptr<System> discovered) {
+    // Plugin oluşturma parametre/istek trafiği başlatabilir, GUI thread'inde yapılmaz
+    TaskExecutor::instance().submit(this, [sdk, discovered](const CancellationToken &) {
+        VehiclePlugins plugins;
+        plugins.mavsdk = sdk;
+        plugins.system = discovered;
+        plugins.action = std::make_shared<mavsdk::Action>(discovered);
+        plugins.telemetry = std::make_shared<mavsdk::Telemetry>(discovered);
+        plugins.mission = std::make_shared<mavsdk::Mission>(discovered);
+        plugins.missionRaw = std::make_shared<mavsdk::MissionRaw>(discovered);
+        plugins.passthrough = std::make_shared<mavsdk::MavlinkPassthrough>(discovered);
+        return plugins;
+    }, [this, attempt](const VehiclePlugins &plugins) {
+        onPluginsReady(attempt, plugins);
+    }, TaskExecutor::Priority::High, connectToken);
+}
+
+
+void UAVManager::onPluginsReady(quint64 attempt, VehiclePlugins plugins) {
+    GuiBusyScope busy(guiThreadBusyUs);
+
+    if (attempt != connectAttempt || !plugins.system) {
         return;
     }
+    if (plugins.mavsdk != discoverySdk) {
+        return;  // Plugin'ler kurulurken aktif link tekrar değişti
+    }
+    const int systemId = plugins.system->get_system_id();
+    pendingSystems[systemId] = false;
 
-    telemetry = std::make_shared<mavsdk::Telemetry>(system);
-    if (!telemetry) {
-        Logger::instance().log("Failed to initialize Telemetry plugin.", ERROR);
-        mavsdk->remove_connection(myConnectionHandle);
-        telemetry.reset();
-        system.reset();
-        action.reset();
+    if (!plugins.action || !plugins.telemetry || !plugins.mission || !plugins.missionRaw || !plugins.passthrough) {
+        if (connectionState == ConnectionState::Discovered) {
+            failConnect("Failed to initialize MAVSDK plugins.");
+        } else {
+            Logger::instance().log("Failed to initialize MAVSDK plugins for system ID " + QString::number(systemId), ERROR);
+        }
+        return;
+    }
+
+    // Link değişimi: araç, geçmişi ve kaydı korunarak yeni linkin plugin'lerine geçer
+    if (VehicleRegistry::Vehicle *existing = vehicles.find(systemId)) {
+        std::shared_ptr<mavsdk::Telemetry> telemetry = plugins.telemetry;
+        vehicles.rebind(std::move(plugins));
+        // Abonelik değişimi bloklamaz; start/stop ile aynı thread'de (GUI) yapılır
+        existing->telemetryHandler->rebind(std::move(telemetry));
+        Logger::instance().log("Vehicle system ID " + QString::number(systemId) + " moved to link " +
+                                   QString::number(links->activeLink()), INFO);
         return;
     }
 
-    telemetryHandler = std::make_unique<TelemetryHandler>(telemetry);
+    // İlk araç tam geçmiş tutar; filodaki diğer araçlar bellek için kısa geçmişle başlar
+    TelemetryTimeSeries::Config timeSeriesConfig;
+    if (!vehicles.empty()) {
+        timeSeriesConfig.retention = std::chrono::minutes(5);
+    }
+
+    VehicleRegistry::Vehicle &vehicle = vehicles.add(std::move(plugins), timeSeriesConfig);
+    TelemetryHandler *handler = vehicle.telemetryHandler.get();
+    handler->addDerivedMetric(geofence->createMetric(systemId));
+    handler->startRecording(QDir(QDir::currentPath()).filePath(
+        "recordings/flight_" + QDateTime::currentDateTime().toString("yyyyMMdd_HHmmss") +
+        "_sys" + QString::number(systemId) + ".uavrec"));
+
+    // subscribe_* çağrıları bloklamaz; start/stop aynı thread'de kalsın diye GUI thread'inde yapılır
+    handler->start();
 
-    QThread *telemetryThread = QThread::create([this]() {
-        telemetryHandler->start();
+    connect(vehicle.missionUploader.get(), &MissionUploader::uploadStarted, this,
+            [this, systemId](int totalItems, MissionUploader::Method method) {
+        emit missionUploadStarted(systemId, totalItems, method);
     });
-    telemetryThread->start();
+    connect(vehicle.missionUploader.get(), &MissionUploader::uploadFinished, this,
+            [this, systemId](const MissionUploader::Report &report) {
+        emit missionUploadFinished(systemId, report);
+    });
+
+    emit vehicleAdded(systemId);
 
-    mission = std::make_shared<mavsdk::Mission>(system);
+    if (connectionState != ConnectionState::Discovered) {
+        return;  // Filoya sonradan katılan araç
+    }
 
+    // İlk snapshot akışın başladığını gösterir
+    connect(handler, &TelemetryHandler::telemetrySnapshotUpdated, this, [this, attempt]() {
+        if (attempt == connectAttempt && connectionState == ConnectionState::PluginsReady) {
+            stepTimer->stop();
+            setConnectionState(ConnectionState::Streaming,
+                               QString("Connected in %1 ms, GUI thread busy %2 us")
+                                   .arg(connectClock.elapsed()).arg(guiThreadBusyUs));
+        }
+    }, Qt::SingleShotConnection);
+
+    activeSystemId = systemId;
     connectedStatus = true;
+    setConnectionState(ConnectionState::PluginsReady);
+    stepTimer->start(StreamingTimeoutMs);
     emit connected();
 
     // burda log eklenemez. connected sinyalinin tetiklenmesi ile de başka loglar kaydedildiği için log dosyasında çakışmalar oluyor ve program çöküyor.
@@ -139,74 +350,336 @@ void UAVManager::connectToUAV(const QString &portName, const QString &baudRate)
 }
 
 
+VehicleRegistry::Vehicle *UAVManager::vehicleFor(int systemId) {
+    return vehicles.find(systemId == ActiveVehicle ? activeSystemId : systemId);
+}
+
+
+const VehicleRegistry &UAVManager::getVehicleRegistry() const {
+    return vehicles;
+}
+
+
+std::vector<int> UAVManager::getVehicleIds() const {
+    return vehicles.systemIds();
+}
+
+
+int UAVManager::getActiveVehicle() const {
+    return activeSystemId;
+}
+
+
+bool UAVManager::setActiveVehicle(int systemId) {
+    if (systemId == activeSystemId) {
+        return true;
+    }
+    if (!vehicles.contains(systemId)) {
+        Logger::instance().log("Unknown vehicle system ID " + QString::number(systemId), WARNING);
+        return false;
+    }
+    activeSystemId = systemId;
+    Logger::instance().log("Active vehicle: system ID " + QString::number(systemId), INFO);
+    emit activeVehicleChanged(systemId);
+    return true;
+}
+
+
+void UAVManager::onStepTimeout() {
+    switch (connectionState) {
+    case ConnectionState::Connecting:
+        failConnect("Failed to connect, UAV not found.");
+        break;
+    case ConnectionState::Discovered:
+        failConnect("Timed out while initializing MAVSDK plugins.");
+        break;
+    case ConnectionState::PluginsReady:
+        // Bağlantı kurulu, sadece veri gelmiyor: bağlantıyı koru ve uyar
+        Logger::instance().log("Connected but no telemetry received within " +
+                                   QString::number(StreamingTimeoutMs) + " ms.", WARNING);
+        break;
+    default:
+        break;
+    }
+}
+
+
+void UAVManager::failConnect(const QString &reason) {
+    Logger::instance().log(reason, ERROR);
+    ++connectAttempt;
+    connectToken.cancel();
+    stepTimer->stop();
+    releaseConnection();
+    setConnectionState(ConnectionState::Failed, reason);
+    emit connectionFailed(reason);
+    setConnectionState(ConnectionState::Disconnected);
+}
+
+
+void UAVManager::cancelConnect() {
+    if (!isConnecting()) {
+        return;
+    }
+    Logger::instance().log("Connection attempt cancelled.", INFO);
+    ++connectAttempt;
+    connectToken.cancel();
+    stepTimer->stop();
+    releaseConnection();
+    setConnectionState(ConnectionState::Disconnected, "Cancelled");
+}
+
+
+void UAVManager::releaseConnection() {
+    if (hasNewSystemHandle) {
+        discoverySdk->unsubscribe_on_new_system(newSystemHandle);
+        hasNewSystemHandle = false;
+    }
+    discoverySdk.reset();
+    links->removeAll();
+    // Alım callback'leri kapatıldı; yönlendirici bir sonraki bağlantıda yeniden başlar
+    forwarder->stop();
+    pendingSystems.fill(false);
+}
+
+
+void UAVManager::setBackupLinks(const QStringList &urls) {
+    backupLinks = urls;
+    Logger::instance().log("Backup links: " + (urls.isEmpty() ? QString("none") : urls.join(", ")), INFO);
+}
+
+
+QStringList UAVManager::getBackupLinks() const {
+    return backupLinks;
+}
+
+
+LinkManager *UAVManager::getLinkManager() const {
+    return links;
+}
+
+
+MavlinkForwarder *UAVManager::getForwarder() const {
+    return forwarder;
+}
+
+
+GeofenceMonitor *UAVManager::getGeofence() const {
+    return geofence;
+}
+
+
+void UAVManager::setConnectionState(ConnectionState state, const QString &message) {
+    connectionState = state;
+    Logger::instance().log("Connection state: " + connectionStateToString(state) +
+                               (message.isEmpty() ? QString() : " (" + message + ")"), INFO);
+    emit connectionStateChanged(state, message);
+}
+
+
+bool UAVManager::isConnecting() const {
+    return connectionState == ConnectionState::Connecting || connectionState == ConnectionState::Discovered;
+}
+
+
+ConnectionState UAVManager::getConnectionState() const {
+    return connectionState;
+}
+
+
+QString UAVManager::connectionStateToString(ConnectionState state) {
+    switch (state) {
+    case ConnectionState::Disconnected: return "Disconnected";
+    case ConnectionState::Connecting: return "Connecting";
+    case ConnectionState::Discovered: return "Discovered";
+    case ConnectionState::PluginsReady: return "Plugins ready";
+    case ConnectionState::Streaming: return "Streaming";
+    case ConnectionState::Failed: return "Failed";
+    }
+    return "Unknown";
+}
+
+
+bool UAVManager::startReplay(const QString &filePath, double speed) {
+    if (connectedStatus) {
+        Logger::instance().log("Replay requires disconnecting from the UAV first.", WARNING);
+        return false;
+    }
+
+    // Replay'de MAVSDK aboneliği yoktur; örnekler TelemetryReplay tarafından beslenir
+    telemetryHandler = std::make_unique<TelemetryHandler>(nullptr);
+    replay = std::make_unique<TelemetryReplay>(telemetryHandler.get());
+    if (!replay->open(filePath)) {
+        replay.reset();
+        telemetryHandler.reset();
+        return false;
+    }
+
+    connectedStatus = true;
+    setConnectionState(ConnectionState::Streaming, "Replay: " + filePath);
+    emit connected();
+
+    replay->setSpeed(speed);
+    replay->play();
+    return true;
+}
+
+TelemetryReplay *UAVManager::getReplay() const {
+    return replay.get();
+}
+
+
 void UAVManager::disconnectFromUAV() {
+    if (isConnecting()) {
+        cancelConnect();
+        return;
+    }
+
     if (connectedStatus) {
         connectedStatus = false;
+        ++connectAttempt;
+        connectToken.cancel();
+        for (GotoUpload &upload : gotoUploads) {
+            upload.startToken.cancel();  // Süren yükleme bitince görev başlatılmaz
+        }
+        gotoUploads.fill(GotoUpload());
+        stepTimer->stop();
+        commands->cancelAll();
         Logger::instance().log("Disconnecting from UAV.", INFO);  // Log kaydı ekledik
 
-        mavsdk->remove_connection(myConnectionHandle);
+        if (replay) {
+            replay.reset();
+        } else {
+            releaseConnection();
+        }
+
+        // Kayıtlar handler'larla birlikte kapanır, ardından sıkıştırılmış arşive dönüştürülür
+        QStringList recordingPaths;
+        for (auto &vehicle : vehicles) {
+            if (vehicle.telemetryHandler && vehicle.telemetryHandler->getRecorder().isRecording()) {
+                recordingPaths << vehicle.telemetryHandler->getRecorder().filePath();
+            }
+        }
 
-        action.reset();
-        system.reset();
-        telemetry.reset();
+        vehicles.clear();
+        activeSystemId = ActiveVehicle;
         telemetryHandler.reset();
+
+        for (const QString &recordingPath : recordingPaths) {
+            archiveRecording(recordingPath);
+        }
+        const TaskExecutor::Metrics executorMetrics = TaskExecutor::instance().metrics();
+        Logger::instance().log("Background tasks: queued " + QString::number(executorMetrics.queued) +
+                                   ", completed " + QString::number(executorMetrics.completed) +
+                                   ", avg wait " + QString::number(executorMetrics.averageWaitUs / 1000.0, 'f', 2) + " ms" +
+                                   ", max wait " + QString::number(executorMetrics.maxWaitUs / 1000.0, 'f', 2) + " ms", INFO);
+
+        setConnectionState(ConnectionState::Disconnected);
         emit disconnected();
     }
 }
 
 
-void UAVManager::arm() {
-    if (!action) {
-        Logger::instance().log("Action object not created yet.", ERROR);
-        return;
-    }
+void UAVManager::archiveRecording(const QString &recordingPath) {
+    // Uzun süren dönüşüm düşük öncelikte çalışır, komut/bağlantı işlerini geciktirmez
+    TaskExecutor::instance().submit([recordingPath](const CancellationToken &) {
+        const QString archivePath = QFileInfo(recordingPath).path() + "/" + QFileInfo(recordingPath).completeBaseName() + ".uavarc";
+        QString error;
+        if (TelemetryArchive::convertRecording(recordingPath, archivePath, &error)) {
+            Logger::instance().log("Flight recording archived: " + archivePath + " (" +
+                                       QString::number(QFileInfo(recordingPath).size() / 1024) + " KB -> " +
+                                       QString::number(QFileInfo(archivePath).size() / 1024) + " KB)", INFO);
+        } else {
+            Logger::instance().log("Failed to archive flight recording: " + error, ERROR);
+        }
+    }, TaskExecutor::Priority::Low);
+}
+
 
-    auto result = action->arm();
-    if (result != mavsdk::Action::Result::Success) {
-        Logger::instance().log("Failed to arm UAV.", ERROR);
+// Komutlar araç başına kuyruğa girer ve *_async ile gönderilir; GUI thread'i cevabı beklemez
+void UAVManager::arm(int systemId) {
+    VehicleRegistry::Vehicle *vehicle = vehicleFor(systemId);
+    if (!vehicle || !vehicle->plugins.action) {
+        Logger::instance().log("Action object not created yet.", ERROR);
         return;
     }
-
-    Logger::instance().log("UAV successfully armed.", INFO);
+    commands->submit(vehicle->systemId, {"Arm", actionStarter(vehicle->systemId, [](Action &action, CommandPipeline::Completion done) {
+        action.arm_async(done);
+    })});
 }
 
-void UAVManager::takeoff(qint32 takeoff_height) {
-    if (!action) {
+void UAVManager::takeoff(qint32 takeoff_height, int systemId) {
+    VehicleRegistry::Vehicle *vehicle = vehicleFor(systemId);
+    if (!vehicle || !vehicle->plugins.action) {
         Logger::instance().log("Action object not created yet.", ERROR);
         return;
     }
-
-    auto result = action->set_takeoff_altitude(static_cast<float>(takeoff_height));
-    if (result != mavsdk::Action::Result::Success) {
-        Logger::instance().log("Failed to set takeoff altitude.", ERROR);
-        return;
+    const int id = vehicle->systemId;
+    const float altitude = static_cast<float>(takeoff_height);
+
+    // Kalkış irtifası -> (gerekirse) arm -> kalkış; bir adım başarısız olursa zincir durur
+    std::vector<CommandPipeline::CommandSpec> steps;
+    steps.push_back({"Set takeoff altitude", actionStarter(id, [altitude](Action &action, CommandPipeline::Completion done) {
+        action.set_takeoff_altitude_async(altitude, done);
+    }), CommandPipeline::DefaultTimeoutMs, CommandPipeline::IdempotentMaxRetries});
+    if (!vehicle->telemetryHandler || !vehicle->telemetryHandler->isArmed()) {
+        steps.push_back({"Arm", actionStarter(id, [](Action &action, CommandPipeline::Completion done) {
+            action.arm_async(done);
+        })});
     }
+    steps.push_back({"Takeoff", actionStarter(id, [](Action &action, CommandPipeline::Completion done) {
+        action.takeoff_async(done);
+    })});
 
-    Logger::instance().log("Takeoff altitude set to " + QString::number(takeoff_height) + " meters.", INFO);
+    commands->submitChain(vehicle->systemId, "Takeoff to " + QString::number(takeoff_height) + " m", std::move(steps));
+}
 
-    result = action->takeoff();
-    if (result != mavsdk::Action::Result::Success) {
-        Logger::instance().log("Takeoff failed.", ERROR);
-    } else {
-        Logger::instance().log("Takeoff successful.", INFO);
-    }
+CommandPipeline *UAVManager::getCommandPipeline() const {
+    return commands;
 }
 
 
-void UAVManager::sendCoordinatesToUAV(double latitude, double longitude, double altitude, double speed, double yaw)
+CommandPipeline::Starter UAVManager::actionStarter(int systemId,
+                                                   std::function<void(Action &, CommandPipeline::Completion)> send) {
+    return [this, systemId, send](CommandPipeline::Completion done) {
+        VehicleRegistry::Vehicle *vehicle = vehicles.find(systemId);
+        if (!vehicle || !vehicle->plugins.action) {
+            done(Action::Result::NoSystem);
+            return;
+        }
+        send(*vehicle->plugins.action, done);
+    };
+}
+
+
+void UAVManager::sendCoordinatesToUAV(double latitude, double longitude, double altitude, double speed, double yaw,
+                                      int systemId)
 {
-    if (!mission) {
+    VehicleRegistry::Vehicle *vehicle = vehicleFor(systemId);
+    if (!vehicle || !vehicle->plugins.mission) {
         Logger::instance().log("Mission plugin not initialized.", ERROR);
         return;
     }
+    std::shared_ptr<mavsdk::Mission> mission = vehicle->plugins.mission;
 
-    if (action) {
-        auto result = action->set_current_speed((float) speed);
-        if (result == mavsdk::Action::Result::Success) {
-            Logger::instance().log("UAV speed successfully changed.", INFO);
-        } else {
-            Logger::instance().log("Failed to change speed, error code: " + QString::number(static_cast<int>(result)), ERROR);
-        }
+    // MissionRaw yüklemesi sürerken (veya sırada beklerken) ikinci bir yükleme araca gönderilmez
+    GotoUpload &upload = gotoUploads[vehicle->systemId];
+    if (upload.hasDeferredMission || (vehicle->missionUploader && vehicle->missionUploader->isBusy())) {
+        Logger::instance().log("Mission upload already in progress.", WARNING);
+        return;
+    }
+
+    if (vehicle->plugins.action) {
+        const float currentSpeed = static_cast<float>(speed);
+        auto setSpeed = [currentSpeed](Action &action, CommandPipeline::Completion done) {
+            action.set_current_speed_async(currentSpeed, done);
+        };
+        commands->submit(vehicle->systemId, {"Set current speed", actionStarter(vehicle->systemId, setSpeed),
+                                             CommandPipeline::DefaultTimeoutMs, CommandPipeline::IdempotentMaxRetries});
+    }
+
+    // Tek noktalı görev araçtaki çok noktalı görevin yerini alır; sonraki yükleme tam yapılır
+    if (vehicle->missionUploader) {
+        vehicle->missionUploader->invalidate();
     }
 
     Mission::MissionItem mission_item;
@@ -224,14 +697,37 @@ void UAVManager::sendCoordinatesToUAV(double latitude, double longitude, double
     Mission::MissionPlan mission_plan;
     mission_plan.mission_items = mission_items;
 
-    QThread *missionThread = QThread::create([this, mission_plan]() {
-        auto result = mission->upload_mission(mission_plan);
+    // Art arda "Head Towards" tıklamalarında sadece son hedef yüklenir
+    if (upload.inFlight) {
+        upload.startToken.cancel();  // Eski hedef yüklenince başlatılmaz, yerine bu hedef yüklenir
+        upload.pending = std::move(mission_plan);
+        upload.hasPending = true;
+        return;
+    }
+    startGotoUpload(vehicle->systemId, mission, std::move(mission_plan));
+}
+
+
+void UAVManager::startGotoUpload(int systemId, std::shared_ptr<mavsdk::Mission> mission, Mission::MissionPlan plan) {
+    GotoUpload &upload = gotoUploads[systemId];
+    upload.inFlight = true;
+    upload.mission = mission;
+    upload.startToken = CancellationToken();
+    const CancellationToken startToken = upload.startToken;
+    const quint64 attempt = connectAttempt;
+
+    // Bitiş her durumda GUI thread'ine döner: sıradaki hedef veya bekleyen MissionRaw yüklemesi oradan başlar
+    const bool submitted = TaskExecutor::instance().submit(this, [mission, plan, startToken](const CancellationToken &) {
+        auto result = mission->upload_mission(plan);
         if (result != mavsdk::Mission::Result::Success) {
             Logger::instance().log("Mission upload failed, error code: " + QString::number(static_cast<int>(result)), ERROR);
             return;
         }
 
         Logger::instance().log("Mission successfully uploaded.", INFO);
+        if (startToken.isCancelled()) {
+            return;
+        }
 
         result = mission->start_mission();
         if (result != mavsdk::Mission::Result::Success) {
@@ -240,17 +736,114 @@ void UAVManager::sendCoordinatesToUAV(double latitude, double longitude, double
         }
 
         Logger::instance().log("Mission started.", INFO);
-    });
+    }, [this, systemId, attempt]() {
+        onGotoUploadFinished(systemId, attempt);
+    }, TaskExecutor::Priority::Normal);
+
+    if (!submitted) {
+        upload.inFlight = false;
+        upload.mission.reset();
+    }
+}
+
+
+void UAVManager::onGotoUploadFinished(int systemId, quint64 attempt) {
+    if (attempt != connectAttempt) {
+        return;  // Bağlantı kesildi; araç durumu sıfırlandı
+    }
+    GotoUpload &upload = gotoUploads[systemId];
+    upload.inFlight = false;
+    upload.mission.reset();
+
+    VehicleRegistry::Vehicle *vehicle = vehicles.find(systemId);
+    if (upload.hasDeferredMission) {
+        upload.hasDeferredMission = false;
+        if (vehicle && vehicle->missionUploader) {
+            vehicle->missionUploader->upload(std::move(upload.deferredMission));
+        }
+        upload.deferredMission.clear();
+        return;
+    }
+    if (upload.hasPending) {
+        upload.hasPending = false;
+        if (vehicle && vehicle->plugins.mission) {
+            startGotoUpload(systemId, vehicle->plugins.mission, std::move(upload.pending));
+        }
+    }
+}
+
+
+
+bool UAVManager::uploadMission(const std::vector<MissionWaypoint> &waypoints, double cameraTriggerDistanceM,
+                               int systemId) {
+    VehicleRegistry::Vehicle *vehicle = vehicleFor(systemId);
+    if (!vehicle || !vehicle->missionUploader) {
+        Logger::instance().log("Mission plugin not initialized.", ERROR);
+        return false;
+    }
+
+    // ArduPilot 0. öğeyi ev konumu olarak kullanır; bilinen ev konumu yer tutucuya yazılır
+    MissionModel::ItemOptions options;
+    options.cameraTriggerDistanceM = cameraTriggerDistanceM;
+    options.homePlaceholder = vehicle->plugins.system->autopilot_type() == Autopilot::ArduPilot;
+    if (options.homePlaceholder && vehicle->telemetryHandler) {
+        const DerivedTelemetry derived = vehicle->telemetryHandler->getSnapshot().derived;
+        if (!std::isnan(derived.homeLatitudeDeg)) {
+            options.homeLatitudeDeg = derived.homeLatitudeDeg;
+            options.homeLongitudeDeg = derived.homeLongitudeDeg;
+        }
+    }
+
+    MissionUploader::Items items = MissionModel::toMissionItems(waypoints, options);
 
-    missionThread->start();
+    // Süren tek noktalı yükleme iptal edilir; iki yükleme aynı anda araca gitmez, bu yükleme onun bitişini bekler
+    GotoUpload &upload = gotoUploads[vehicle->systemId];
+    if (upload.inFlight) {
+        if (vehicle->missionUploader->isBusy() || upload.hasDeferredMission) {
+            Logger::instance().log("Mission upload already in progress.", WARNING);
+            return false;
+        }
+        upload.startToken.cancel();
+        upload.hasPending = false;
+        upload.deferredMission = std::move(items);
+        upload.hasDeferredMission = true;
+        std::shared_ptr<mavsdk::Mission> mission = upload.mission;
+        TaskExecutor::instance().submit([mission](const CancellationToken &) {
+            mission->cancel_mission_upload();
+        }, TaskExecutor::Priority::High);
+        return true;
+    }
+    return vehicle->missionUploader->upload(std::move(items));
+}
+
+
+void UAVManager::startMission(int systemId) {
+    VehicleRegistry::Vehicle *vehicle = vehicleFor(systemId);
+    if (!vehicle || !vehicle->plugins.missionRaw) {
+        Logger::instance().log("Mission plugin not initialized.", ERROR);
+        return;
+    }
+    vehicle->plugins.missionRaw->start_mission_async([](MissionRaw::Result result) {
+        if (result == MissionRaw::Result::Success) {
+            Logger::instance().log("Mission started.", INFO);
+        } else {
+            Logger::instance().log("Failed to start mission, error code: " + QString::number(static_cast<int>(result)), ERROR);
+        }
+    });
 }
 
 
+MissionUploader *UAVManager::getMissionUploader(int systemId) {
+    VehicleRegistry::Vehicle *vehicle = vehicleFor(systemId);
+    return vehicle ? vehicle->missionUploader.get() : nullptr;
+}
+
 
 bool UAVManager::isConnected() const {
     return connectedStatus;
 }
 
 bool UAVManager::areComponentsReady() const {
-    return (action != nullptr && telemetry != nullptr);
+    const VehicleRegistry::Vehicle *vehicle = vehicles.find(activeSystemId);
+    return vehicle && vehicle->plugins.action != nullptr && vehicle->plugins.telemetry != nullptr;
 }
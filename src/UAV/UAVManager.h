@@ -1,19 +1,35 @@
 #ifndef UAVMANAGER_H
 #define UAVMANAGER_H
 
+#include "src/Geofence/GeofenceMonitor.h"
+#include "src/Mission/MissionModel.h"
 #include "src/Telemetry/TelemetryHandler.h"
+#include "src/Telemetry/TelemetryReplay.h"
+#include "src/UAV/CommandPipeline.h"
+#include "src/UAV/LinkManager.h"
+#include "src/UAV/MavlinkForwarder.h"
+#include "src/UAV/VehicleRegistry.h"
 #include "src/Utils/Logger.h"
+#include "src/Utils/TaskExecutor.h"
+#include <QMutex>
 #include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QStringList>
 #include <memory>
+#include <mavsdk/log_callback.h>
 #include <mavsdk/mavsdk.h>
 #include <mavsdk/plugins/telemetry/telemetry.h>
 #include <mavsdk/plugins/action/action.h>
-#include <mavsdk/mavsdk.h>
 #include <mavsdk/plugins/mission_raw/mission_raw.h>
 #include <mavsdk/plugins/mission/mission.h>
 
 enum class FlightCommand { TakeOff, Land, ReturnToHome };
 
+// Bağlantı durum makinesi: Connecting -> Discovered -> PluginsReady -> Streaming.
+// Her adım arka planda yürür, GUI thread'i hiçbir adımda beklemez.
+enum class ConnectionState { Disconnected, Connecting, Discovered, PluginsReady, Streaming, Failed };
+
 class UAVManager : public QObject {
     Q_OBJECT
 
@@ -24,33 +40,143 @@ public:
 
     // Bağlantı İşlevleri
     void connectToUAV(const QString &portName, const QString & baudRate);
+    void cancelConnect();
     void disconnectFromUAV();
     bool isConnected() const;
+    bool isConnecting() const;
+    ConnectionState getConnectionState() const;
+    static QString connectionStateToString(ConnectionState state);
+
+    // Aynı araca birincil bağlantıyla birlikte açılacak yedek linkler (ör. "udp://:14560").
+    // Komut trafiği LinkManager'ın seçtiği en sağlıklı linkten çıkar.
+    void setBackupLinks(const QStringList &urls);
+    QStringList getBackupLinks() const;
+    LinkManager *getLinkManager() const;
+
+    // Aracın MAVLink akışını yerel UDP/TCP uç noktalarına dağıtır; bağlanırken başlatılır
+    MavlinkForwarder *getForwarder() const;
+
+    // Filodaki her aracın konumu telemetri hızında geofence bölgelerine karşı denetlenir
+    GeofenceMonitor *getGeofence() const;
+
+    // Adım başına zaman aşımları (ms)
+    static constexpr int DiscoveryTimeoutMs = 5000;
+    static constexpr int PluginTimeoutMs = 5000;
+    static constexpr int StreamingTimeoutMs = 5000;
     bool areComponentsReady() const;
-    void takeoff(const qint32 takeoff_height);
-    void arm();
 
+    // Komutlar sistem ID'sine göre yönlendirilir; ActiveVehicle seçili aracı kullanır
+    static constexpr int ActiveVehicle = -1;
+    void takeoff(const qint32 takeoff_height, int systemId = ActiveVehicle);
+    void arm(int systemId = ActiveVehicle);
+    CommandPipeline *getCommandPipeline() const;
+
+    // Filo: aynı bağlantı üzerinden keşfedilen tüm araçlar
+    const VehicleRegistry &getVehicleRegistry() const;
+    std::vector<int> getVehicleIds() const;
+    int getActiveVehicle() const;
+    bool setActiveVehicle(int systemId);
+
+    // Araç olmadan bir uçuş kaydını canlı akışla aynı yoldan oynatır
+    bool startReplay(const QString &filePath, double speed = 1.0);
+    TelemetryReplay *getReplay() const;
+
+    // Seçili aracın (replay'de oynatılan kaydın) telemetri işleyicisi
     std::unique_ptr<TelemetryHandler>& getTelemetryHandler(); // Sadece prototip
-    void sendCoordinatesToUAV(double latitude, double longitude, double altitude, double speed, double yaw);
+    std::unique_ptr<TelemetryHandler>& getTelemetryHandler(int systemId);
+    void sendCoordinatesToUAV(double latitude, double longitude, double altitude, double speed, double yaw,
+                              int systemId = ActiveVehicle);
+
+    // Çok noktalı görev: MissionRaw ile yüklenir, destekleyen otopilotta sadece değişen öğeler gönderilir.
+    // Sonuç ve süre missionUploadFinished ile gelir.
+    bool uploadMission(const std::vector<MissionWaypoint> &waypoints, double cameraTriggerDistanceM = 0.0,
+                       int systemId = ActiveVehicle);
+    void startMission(int systemId = ActiveVehicle);
+    MissionUploader *getMissionUploader(int systemId = ActiveVehicle);
+
+    // MAVSDK'nın son log satırı. MAVSDK log aboneliği süreç geneli olduğu için araç başına değil
+    // burada, bir kez yapılır; mavsdkLogUpdated MAVSDK thread'inden yayınlanır.
+    std::pair<QString, mavsdk::log::Level> getLastLog() const;
 
 
 signals:
     void connected();
     void disconnected();
+    void connectionStateChanged(ConnectionState state, const QString &message);
+    void connectionFailed(const QString &reason);
+    void vehicleAdded(int systemId);
+    void activeVehicleChanged(int systemId);
+    void activeLinkChanged(int index, const QString &url);
+    void missionUploadStarted(int systemId, int totalItems, MissionUploader::Method method);
+    void missionUploadFinished(int systemId, const MissionUploader::Report &report);
+    void mavsdkLogUpdated();
 
 private:
-    // ConnectionHandle ve Handle şablonunun tanımlanması
-    using ConnectionHandle = mavsdk::Handle<>;  // Handle<> türüne dayanan ConnectionHandle
-    // ConnectionHandle türünde bir değişken oluşturma
-    ConnectionHandle myConnectionHandle;
-    std::unique_ptr<TelemetryHandler> telemetryHandler; // Üye değişken
-    std::shared_ptr<mavsdk::Mission> mission;
+    void archiveRecording(const QString &recordingPath);
+    void subscribeLog();
+
+    // Durum makinesi adımları (hepsi GUI thread'inde, kısa sürer)
+    void setConnectionState(ConnectionState state, const QString &message = QString());
+    void onLinkAdded(int index, mavsdk::ConnectionResult result);
+    void onActiveLinkChanged(int index);
+    void onSystemDiscovered(quint64 attempt);
+    void createPlugins(quint64 attempt, std::shared_ptr<mavsdk::Mavsdk> sdk, std::shared_ptr<mavsdk::System> discovered);
+    void onPluginsReady(quint64 attempt, VehiclePlugins plugins);
+    void onStepTimeout();
+    void failConnect(const QString &reason);
+    void releaseConnection();
+    VehicleRegistry::Vehicle *vehicleFor(int systemId);
+    // Action gönderim anında çözülür: link değiştiyse kuyruktaki/yeniden denenen komut yeni linkten çıkar
+    CommandPipeline::Starter actionStarter(int systemId,
+                                           std::function<void(mavsdk::Action &, CommandPipeline::Completion)> send);
+    void startGotoUpload(int systemId, std::shared_ptr<mavsdk::Mission> mission, mavsdk::Mission::MissionPlan plan);
+    void onGotoUploadFinished(int systemId, quint64 attempt);
+
+    // Araç başına "Head Towards" yüklemesi. Aynı araca aynı anda tek yükleme gider: sürerken gelen
+    // hedefler son hedefe birleştirilir, bitince o yüklenir. MissionRaw yüklemesi gelirse süren
+    // yükleme iptal edilir ve MissionRaw yüklemesi onun bitişini bekler.
+    struct GotoUpload {
+        bool inFlight = false;
+        std::shared_ptr<mavsdk::Mission> mission;  // Süren yüklemenin plugin'i (link değişse de)
+        bool hasPending = false;
+        mavsdk::Mission::MissionPlan pending;
+        CancellationToken startToken;  // İptal edilirse yükleme bitince görev başlatılmaz
+        bool hasDeferredMission = false;
+        MissionUploader::Items deferredMission;
+    };
+
+    // Her deneme yeni bir numara alır; eski denemeden gelen geç sonuçlar bu sayede yok sayılır (iptal)
+    quint64 connectAttempt = 0;
+    CancellationToken connectToken;  // Bağlantı denemesine ait arka plan görevleri
+    ConnectionState connectionState = ConnectionState::Disconnected;
+    QTimer *stepTimer;
+    CommandPipeline *commands;
+    QElapsedTimer connectClock;
+    qint64 guiThreadBusyUs = 0;  // Bağlantı sırasında GUI thread'inde harcanan toplam süre
+    LinkManager *links;
+    MavlinkForwarder *forwarder;
+    GeofenceMonitor *geofence;
+    QStringList backupLinks;
+    int failedLinks = 0;  // Bağlanma sırasında ilk denemesi başarısız olan link sayısı
+    // Keşif aboneliği aktif linkin Mavsdk örneğindedir, link değişince taşınır
+    std::shared_ptr<mavsdk::Mavsdk> discoverySdk;
+    mavsdk::Mavsdk::NewSystemHandle newSystemHandle;
+    bool hasNewSystemHandle = false;
+
+    // Plugin'leri arka planda oluşturulan sistemler (aynı sistem iki kez kurulmasın)
+    std::array<bool, 256> pendingSystems{};
+    std::array<GotoUpload, 256> gotoUploads;
+
+    std::unique_ptr<TelemetryHandler> telemetryHandler; // Replay işleyicisi (canlı araçlar registry'de)
+    std::unique_ptr<TelemetryReplay> replay;
     bool connectedStatus = false; // Varsayılan olarak bağlantı durumu yanlış
     QString connectionString;
-    std::unique_ptr<mavsdk::Mavsdk> mavsdk;
-    std::shared_ptr<mavsdk::System> system;
-    std::shared_ptr<mavsdk::Action> action;
-    std::shared_ptr<mavsdk::Telemetry> telemetry;
+    VehicleRegistry vehicles;
+    int activeSystemId = ActiveVehicle;
+
+    mutable QMutex lastLogMutex;  // MAVSDK thread'i yazar, GUI thread'i okur
+    QString lastLogMessage;
+    mavsdk::log::Level lastLogLevel = mavsdk::log::Level::Info;
     //Logger *logger;  // Logger sınıfının bir örneği
 };
 
@@ -0,0 +1,135 @@
+#include "VehicleRegistry.h"
+#include "src/Utils/Logger.h"
+#include <QPointer>
+#include <QtGlobal>
+
+VehicleRegistry::Vehicle::Vehicle(Vehicle &&other) noexcept
+    : systemId(other.systemId),
+    connected(other.connected.load()),
+    lastStateChangeUs(other.lastStateChangeUs.load()),
+    plugins(std::move(other.plugins)),
+    telemetryHandler(std::move(other.telemetryHandler)),
+    missionUploader(std::move(other.missionUploader)),
+    connectedHandle(other.connectedHandle) {}
+
+VehicleRegistry::VehicleRegistry() {
+    // Kapasite baştan ayrılır: vector hiç yeniden boyutlanmaz, Vehicle adresleri sabit kalır
+    vehicles.reserve(MaxVehicles);
+    indexBySystemId.fill(NoVehicle);
+}
+
+VehicleRegistry::~VehicleRegistry() {
+    clear();
+}
+
+VehicleRegistry::Vehicle &VehicleRegistry::add(VehiclePlugins plugins, const TelemetryTimeSeries::Config &timeSeriesConfig) {
+    const std::uint8_t systemId = plugins.system->get_system_id();
+    if (Vehicle *existing = find(systemId)) {
+        return *existing;
+    }
+
+    // Kapasite aşılırsa vector yeniden boyutlanır ve dağıtılan Vehicle işaretçileri boşa düşer
+    Q_ASSERT(vehicles.size() < vehicles.capacity());
+    indexBySystemId[systemId] = static_cast<std::int16_t>(vehicles.size());
+    vehicles.emplace_back();
+    Vehicle &vehicle = vehicles.back();
+    vehicle.systemId = systemId;
+    vehicle.connected.store(plugins.system->is_connected(), std::memory_order_relaxed);
+    vehicle.lastStateChangeUs.store(TelemetryTimeSeries::now(), std::memory_order_relaxed);
+    vehicle.plugins = std::move(plugins);
+
+    vehicle.telemetryHandler = std::make_unique<TelemetryHandler>(vehicle.plugins.telemetry);
+    vehicle.telemetryHandler->setTimeSeriesConfig(timeSeriesConfig);
+    vehicle.missionUploader = std::make_unique<MissionUploader>();
+    setUploaderPlugins(vehicle);
+
+    subscribeConnected(vehicle);
+
+    Logger::instance().log("Vehicle registered: system ID " + QString::number(systemId) +
+                               " (" + QString::number(vehicles.size()) + " total)", INFO);
+    return vehicle;
+}
+
+bool VehicleRegistry::rebind(VehiclePlugins plugins) {
+    Vehicle *vehicle = find(plugins.system->get_system_id());
+    if (!vehicle) {
+        return false;
+    }
+
+    vehicle->plugins.system->unsubscribe_is_connected(vehicle->connectedHandle);
+    // Eski Telemetry plugin'i handler yeni plugin'e geçene kadar handler'da yaşar
+    vehicle->plugins = std::move(plugins);
+    vehicle->connected.store(vehicle->plugins.system->is_connected(), std::memory_order_relaxed);
+    vehicle->lastStateChangeUs.store(TelemetryTimeSeries::now(), std::memory_order_relaxed);
+    subscribeConnected(*vehicle);
+    setUploaderPlugins(*vehicle);
+    return true;
+}
+
+void VehicleRegistry::setUploaderPlugins(Vehicle &vehicle) {
+    // Kısmi görev yüklemesini (MISSION_WRITE_PARTIAL_LIST) ArduPilot destekler, PX4 desteklemez
+    const bool partialUpload = vehicle.plugins.system->autopilot_type() == mavsdk::Autopilot::ArduPilot;
+    vehicle.missionUploader->setPlugins(vehicle.plugins.missionRaw, vehicle.plugins.passthrough, partialUpload);
+}
+
+void VehicleRegistry::subscribeConnected(Vehicle &vehicle) {
+    // MAVSDK thread'inden gelir; sadece atomik alanlara dokunulur, uploader GUI thread'ine aktarılır
+    Vehicle *entry = &vehicle;
+    QPointer<MissionUploader> uploader(vehicle.missionUploader.get());
+    vehicle.connectedHandle = vehicle.plugins.system->subscribe_is_connected([entry, uploader](bool isConnected) {
+        entry->connected.store(isConnected, std::memory_order_relaxed);
+        entry->lastStateChangeUs.store(TelemetryTimeSeries::now(), std::memory_order_relaxed);
+        if (isConnected || !uploader) {
+            return;
+        }
+        // Bağlantı yokken görev başka bir GCS'ten değişebilir; araçtaki kopyaya artık güvenilmez
+        QMetaObject::invokeMethod(uploader, [uploader]() {
+            if (uploader) {
+                uploader->invalidate();
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+VehicleRegistry::Vehicle *VehicleRegistry::find(int systemId) {
+    if (systemId < 0 || systemId > 255 || indexBySystemId[systemId] == NoVehicle) {
+        return nullptr;
+    }
+    return &vehicles[static_cast<std::size_t>(indexBySystemId[systemId])];
+}
+
+const VehicleRegistry::Vehicle *VehicleRegistry::find(int systemId) const {
+    return const_cast<VehicleRegistry *>(this)->find(systemId);
+}
+
+bool VehicleRegistry::contains(int systemId) const {
+    return find(systemId) != nullptr;
+}
+
+std::vector<int> VehicleRegistry::systemIds() const {
+    std::vector<int> ids;
+    ids.reserve(vehicles.size());
+    for (const auto &vehicle : vehicles) {
+        ids.push_back(vehicle.systemId);
+    }
+    return ids;
+}
+
+std::size_t VehicleRegistry::connectedCount() const {
+    std::size_t count = 0;
+    for (const auto &vehicle : vehicles) {
+        count += vehicle.connected.load(std::memory_order_relaxed) ? 1 : 0;
+    }
+    return count;
+}
+
+void VehicleRegistry::clear() {
+    // Önce MAVSDK callback'leri sonlandırılır, sonra handler'lar silinir
+    for (auto &vehicle : vehicles) {
+        if (vehicle.plugins.system) {
+            vehicle.plugins.system->unsubscribe_is_connected(vehicle.connectedHandle);
+        }
+    }
+    vehicles.clear();
+    indexBySystemId.fill(NoVehicle);
+}
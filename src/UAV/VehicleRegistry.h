@@ -0,0 +1,92 @@
+#ifndef VEHICLEREGISTRY_H
+#define VEHICLEREGISTRY_H
+
+#include "src/Mission/MissionUploader.h"
+#include "src/Telemetry/TelemetryHandler.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <mavsdk/mavsdk.h>
+#include <mavsdk/plugins/action/action.h>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
+#include <mavsdk/plugins/mission/mission.h>
+#include <mavsdk/plugins/mission_raw/mission_raw.h>
+#include <mavsdk/plugins/telemetry/telemetry.h>
+
+// Bir araç için MAVSDK plugin'leri ve telemetri işleyicisi.
+// System, ait olduğu Mavsdk örneğinden uzun yaşayamaz; örnek en son yok edilsin diye ilk üyedir.
+struct VehiclePlugins {
+    std::shared_ptr<mavsdk::Mavsdk> mavsdk;
+    std::shared_ptr<mavsdk::System> system;
+    std::shared_ptr<mavsdk::Action> action;
+    std::shared_ptr<mavsdk::Telemetry> telemetry;
+    std::shared_ptr<mavsdk::Mission> mission;
+    std::shared_ptr<mavsdk::MissionRaw> missionRaw;
+    std::shared_ptr<mavsdk::MavlinkPassthrough> passthrough;
+};
+
+// Sistem ID'sine göre araç tablosu.
+// Araçlar tek bir vector'de art arda tutulur ve kapasite baştan ayrıldığı için
+// elemanların adresi hiç değişmez; sysid -> indeks eşlemesi 256 elemanlı düz bir dizidir.
+// Sıcak durum (bağlı mı, son görülme) plugin işaretçilerinden önce gelir ki tabloyu
+// tarayan kod (araç listesi, toplu komut) az cache line'a dokunsun.
+//
+// Ekleme/okuma GUI thread'inden yapılır; bağlantı durumu MAVSDK thread'inden atomik yazılır.
+class VehicleRegistry {
+public:
+    // Her olası sistem ID'si için bir yer: add() sysid'e göre tekilleştirdiği için kapasite aşılamaz
+    static constexpr std::size_t MaxVehicles = 256;
+    static constexpr int NoVehicle = -1;
+
+    struct Vehicle {
+        std::uint8_t systemId = 0;
+        std::atomic<bool> connected{false};
+        std::atomic<std::int64_t> lastStateChangeUs{0};
+
+        VehiclePlugins plugins;
+        std::unique_ptr<TelemetryHandler> telemetryHandler;
+        std::unique_ptr<MissionUploader> missionUploader;
+        mavsdk::System::IsConnectedHandle connectedHandle;
+
+        Vehicle() = default;
+        Vehicle(Vehicle &&other) noexcept;
+    };
+
+    VehicleRegistry();
+    ~VehicleRegistry();
+
+    VehicleRegistry(const VehicleRegistry &) = delete;
+    VehicleRegistry &operator=(const VehicleRegistry &) = delete;
+
+    // Aracı tabloya ekler ve telemetri işleyicisini oluşturur. Aynı sysid zaten varsa mevcut kayıt döner.
+    Vehicle &add(VehiclePlugins plugins, const TelemetryTimeSeries::Config &timeSeriesConfig);
+
+    Vehicle *find(int systemId);
+    const Vehicle *find(int systemId) const;
+    bool contains(int systemId) const;
+
+    // Aracı başka bir linkin plugin'lerine taşır; telemetri geçmişi ve kayıt korunur
+    bool rebind(VehiclePlugins plugins);
+
+    std::size_t size() const { return vehicles.size(); }
+    bool empty() const { return vehicles.empty(); }
+    std::vector<int> systemIds() const;
+    std::size_t connectedCount() const;
+
+    std::vector<Vehicle>::iterator begin() { return vehicles.begin(); }
+    std::vector<Vehicle>::iterator end() { return vehicles.end(); }
+
+    // Tüm araçları bırakır (bağlantı kesilirken)
+    void clear();
+
+private:
+    void subscribeConnected(Vehicle &vehicle);
+    void setUploaderPlugins(Vehicle &vehicle);
+
+    std::vector<Vehicle> vehicles;
+    std::array<std::int16_t, MaxVehicles> indexBySystemId;
+};
+
+#endif // VEHICLEREGISTRY_H
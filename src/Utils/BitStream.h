@@ -0,0 +1,108 @@
+#ifndef BITSTREAM_H
+#define BITSTREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// MSB-first bit yazıcı/okuyucu. Sıkıştırılmış telemetri bloklarında kullanılır.
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<std::uint8_t> &output)
+        : bytes(output) {}
+
+    void writeBits(std::uint64_t value, int count) {
+        if (count <= 0) {
+            return;
+        }
+        if (count > 56) {
+            writeBits(value >> 32, count - 32);
+            writeBits(value & 0xFFFFFFFFull, 32);
+            return;
+        }
+
+        accumulator = (accumulator << count) | (value & mask(count));
+        accumulatorBits += count;
+        totalBits += static_cast<std::size_t>(count);
+        while (accumulatorBits >= 8) {
+            accumulatorBits -= 8;
+            bytes.push_back(static_cast<std::uint8_t>(accumulator >> accumulatorBits));
+        }
+    }
+
+    void writeBit(bool bit) {
+        writeBits(bit ? 1u : 0u, 1);
+    }
+
+    // Kalan bitleri sıfırla tamamlayıp son baytı yazar
+    void flush() {
+        if (accumulatorBits > 0) {
+            bytes.push_back(static_cast<std::uint8_t>(accumulator << (8 - accumulatorBits)));
+            totalBits += static_cast<std::size_t>(8 - accumulatorBits);
+            accumulatorBits = 0;
+        }
+    }
+
+    std::size_t bitCount() const { return totalBits; }
+
+    static std::uint64_t mask(int count) {
+        return count >= 64 ? ~0ull : ((1ull << count) - 1);
+    }
+
+private:
+    std::vector<std::uint8_t> &bytes;
+    std::uint64_t accumulator = 0;
+    int accumulatorBits = 0;
+    std::size_t totalBits = 0;
+};
+
+class BitReader {
+public:
+    BitReader(const std::uint8_t *data, std::size_t size, std::size_t startBit = 0)
+        : bytes(data), byteCount(size), position(startBit / 8) {
+        const int skip = static_cast<int>(startBit % 8);
+        if (skip > 0) {
+            readBits(skip);
+        }
+    }
+
+    std::uint64_t readBits(int count) {
+        if (count <= 0) {
+            return 0;
+        }
+        if (count > 56) {
+            const std::uint64_t high = readBits(count - 32);
+            return (high << 32) | readBits(32);
+        }
+
+        while (bufferBits < count) {
+            const std::uint8_t next = position < byteCount ? bytes[position] : 0;
+            if (position >= byteCount) {
+                overrun = true;
+            }
+            ++position;
+            buffer = (buffer << 8) | next;
+            bufferBits += 8;
+        }
+
+        bufferBits -= count;
+        return (buffer >> bufferBits) & BitWriter::mask(count);
+    }
+
+    bool readBit() {
+        return readBits(1) != 0;
+    }
+
+    // Verinin sonundan öteye okuma yapıldıysa true
+    bool hasOverrun() const { return overrun; }
+
+private:
+    const std::uint8_t *bytes;
+    std::size_t byteCount;
+    std::size_t position;
+    std::uint64_t buffer = 0;
+    int bufferBits = 0;
+    bool overrun = false;
+};
+
+#endif // BITSTREAM_H
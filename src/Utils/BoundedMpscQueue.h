@@ -0,0 +1,120 @@
+#ifndef BOUNDEDMPSCQUEUE_H
+#define BOUNDEDMPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+// Sabit kapasiteli, önceden ayrılmış, kilitsiz çok üreticili kuyruk (Vyukov dizisi).
+// Üreticiler birbirini hiçbir zaman beklemez; kuyruk doluysa tryPush false döner.
+// Asıl tüketici tek bir arka plan yazıcısıdır, fakat çıkış tarafı da CAS ile ilerlediğinden
+// birden fazla thread aynı anda tryPop/tryConsume çağırabilir (Logger'ın DropOldest politikası
+// üretici thread'lerinden tüketir). Çıkış yolu tek tüketiciye göre sadeleştirilmemelidir.
+// Kapasite ikinin kuvvetine yuvarlanır. push/pop yolunda bellek ayırma yapılmaz.
+template <typename T>
+class BoundedMpscQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "Kuyruk elemanları trivially copyable olmalı");
+
+public:
+    explicit BoundedMpscQueue(std::size_t requestedCapacity)
+        : capacityMask(roundUpPowerOfTwo(requestedCapacity) - 1),
+        cells(new Cell[capacityMask + 1]) {
+        for (std::size_t i = 0; i <= capacityMask; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpscQueue(const BoundedMpscQueue &) = delete;
+    BoundedMpscQueue &operator=(const BoundedMpscQueue &) = delete;
+
+    // Elemanı yerinde doldurmak için slot rezerve eder; fill(T&) kısa olmalıdır.
+    template <typename Filler>
+    bool tryEmplace(Filler &&fill) {
+        Cell *cell;
+        std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells[position & capacityMask];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;  // Kuyruk dolu
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        fill(cell->value);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(const T &value) {
+        return tryEmplace([&value](T &slot) { slot = value; });
+    }
+
+    bool tryPop(T &value) {
+        return tryConsume([&value](const T &slot) { value = slot; });
+    }
+
+    // Elemanı kopyalamadan yerinde okur; hücre consume(const T&) dönene kadar üreticilere kapalıdır.
+    // Eşzamanlı tüketiciler güvenlidir: her hücreyi dequeuePosition CAS'ını kazanan tek tüketici alır.
+    template <typename Consumer>
+    bool tryConsume(Consumer &&consume) {
+        Cell *cell;
+        std::size_t position = dequeuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells[position & capacityMask];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+            if (difference == 0) {
+                if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;  // Kuyruk boş
+            } else {
+                position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        consume(static_cast<const T &>(cell->value));
+        cell->sequence.store(position + capacityMask + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t capacity() const { return capacityMask + 1; }
+
+    // Yaklaşık doluluk (istatistik amaçlı)
+    std::size_t sizeApprox() const {
+        const std::size_t enqueued = enqueuePosition.load(std::memory_order_relaxed);
+        const std::size_t dequeued = dequeuePosition.load(std::memory_order_relaxed);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    static std::size_t roundUpPowerOfTwo(std::size_t value) {
+        std::size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const std::size_t capacityMask;
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<std::size_t> enqueuePosition{0};
+    alignas(64) std::atomic<std::size_t> dequeuePosition{0};
+};
+
+#endif // BOUNDEDMPSCQUEUE_H
@@ -0,0 +1,44 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// IEEE 802.3 CRC32 (zlib ile aynı sonuç). Kayıt ve arşiv dosyalarındaki
+// blokların bütünlüğünü doğrulamak için kullanılır.
+namespace Crc32 {
+
+inline const std::array<std::uint32_t, 256> &table() {
+    static const std::array<std::uint32_t, 256> crcTable = [] {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+    return crcTable;
+}
+
+// Önceki sonuç crc olarak verilerek parça parça hesaplanabilir
+inline std::uint32_t update(std::uint32_t crc, const void *data, std::size_t length) {
+    const auto &t = table();
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    crc = ~crc;
+    for (std::size_t i = 0; i < length; ++i) {
+        crc = t[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+inline std::uint32_t compute(const void *data, std::size_t length) {
+    return update(0, data, length);
+}
+
+} // namespace Crc32
+
+#endif // CRC32_H
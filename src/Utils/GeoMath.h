@@ -0,0 +1,69 @@
+#ifndef GEOMATH_H
+#define GEOMATH_H
+
+#include <cmath>
+
+struct GeoPoint {
+    double latitudeDeg = 0.0;
+    double longitudeDeg = 0.0;
+};
+
+// Küçük coğrafi hesap yardımcıları (WGS84 küre yaklaşımı)
+namespace GeoMath {
+
+constexpr double EarthRadiusM = 6371008.8;
+constexpr double Pi = 3.14159265358979323846;
+
+inline double toRadians(double degrees) { return degrees * Pi / 180.0; }
+inline double toDegrees(double radians) { return radians * 180.0 / Pi; }
+
+// İki nokta arasındaki büyük daire mesafesi (metre)
+inline double distanceM(double lat1, double lon1, double lat2, double lon2) {
+    const double phi1 = toRadians(lat1);
+    const double phi2 = toRadians(lat2);
+    const double dPhi = phi2 - phi1;
+    const double dLambda = toRadians(lon2 - lon1);
+    const double a = std::sin(dPhi / 2) * std::sin(dPhi / 2) +
+                     std::cos(phi1) * std::cos(phi2) * std::sin(dLambda / 2) * std::sin(dLambda / 2);
+    return 2.0 * EarthRadiusM * std::atan2(std::sqrt(a), std::sqrt(1.0 - a));
+}
+
+// Birinci noktadan ikinciye başlangıç kerterizi (0-360 derece, kuzeyden saat yönünde)
+inline double bearingDeg(double lat1, double lon1, double lat2, double lon2) {
+    const double phi1 = toRadians(lat1);
+    const double phi2 = toRadians(lat2);
+    const double dLambda = toRadians(lon2 - lon1);
+    const double y = std::sin(dLambda) * std::cos(phi2);
+    const double x = std::cos(phi1) * std::sin(phi2) - std::sin(phi1) * std::cos(phi2) * std::cos(dLambda);
+    const double bearing = toDegrees(std::atan2(y, x));
+    return bearing < 0 ? bearing + 360.0 : bearing;
+}
+
+// Bir referans nokta etrafında yerel düzlem (doğu/kuzey metre) projeksiyonu.
+// Birkaç km ölçeğindeki hesaplar (geofence, survey) için yeterince doğrudur.
+struct LocalProjection {
+    double originLat = 0.0;
+    double originLon = 0.0;
+    double metersPerDegLat = 0.0;
+    double metersPerDegLon = 0.0;
+
+    LocalProjection() = default;
+    LocalProjection(double lat, double lon)
+        : originLat(lat), originLon(lon),
+        metersPerDegLat(toRadians(1.0) * EarthRadiusM),
+        metersPerDegLon(toRadians(1.0) * EarthRadiusM * std::cos(toRadians(lat))) {}
+
+    void toLocal(double lat, double lon, double &east, double &north) const {
+        east = (lon - originLon) * metersPerDegLon;
+        north = (lat - originLat) * metersPerDegLat;
+    }
+
+    void toGeo(double east, double north, double &lat, double &lon) const {
+        lat = originLat + north / metersPerDegLat;
+        lon = originLon + east / metersPerDegLon;
+    }
+};
+
+} // namespace GeoMath
+
+#endif // GEOMATH_H
@@ -1,22 +1,57 @@
 #include "Logger.h"
+#include "src/Utils/StructuredLog.h"
+#include <QMetaMethod>
+#include <chrono>
+#include <cstring>
+#include <ctime>
 
-QMutex Logger::mutex;  // Statik mutex tanımlaması
+namespace {
+
+// Biçim metinleri çağrı yerlerindeki string literal'lerdir; ID tabloda indistir (0 kullanılmaz).
+// Kayıt kuyruktan geçtiği için yazıcı, ID'yi gördüğünde tablodaki işaretçiyi de görür.
+const char *registeredFormats[Logger::MaxFormats];
+std::atomic<int> formatCount{1};
+
+} // namespace
+
+
+// Dosyaya saniye çözünürlüğünde yazılır; kaba saat tam saatin yarısından ucuzdur
+qint64 Logger::currentTimeMs()
+{
+#ifdef CLOCK_REALTIME_COARSE
+    timespec now;
+    clock_gettime(CLOCK_REALTIME_COARSE, &now);
+    return static_cast<qint64>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+#else
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch()).count();
+#endif
+}
 
 
 Logger::Logger()
-    : logDirectory(QDir::currentPath()) // Varsayılan olarak geçerli dizin
+    : queue(QueueCapacity)
+    , logDirectory(QDir::currentPath()) // Varsayılan olarak geçerli dizin
 {
     // Log dosyasının başlangıç adı
     logFileName = "application.log";
-    rotateLogFile();
+    batch.reserve(BatchBytes + 1024);
+    writerThread = std::thread(&Logger::writerLoop, this);
 }
 
 Logger::~Logger()
 {
-    // Log dosyasını kapatıyoruz.
+    // Kuyrukta kalan mesajlar yazıldıktan sonra dosya kapatılır
+    stopRequested.store(true, std::memory_order_release);
+    if (writerThread.joinable()) {
+        writerThread.join();
+    }
     if (logFile.isOpen()) {
         logFile.close();
     }
+    if (structuredFile.isOpen()) {
+        structuredFile.close();
+    }
 }
 
 Logger& Logger::instance()
@@ -27,65 +62,295 @@ Logger& Logger::instance()
 
 
 
-std::pair<QString, LogLevel> Logger::getLastLog() const {
-    return {lastStatusMessage, lastStatusLevel};
+void Logger::log(const QString &message, LogLevel level)
+{
+    // Sıcak yol: zaman damgası + UTF-16 kopyası, kilit ve biçimlendirme yok
+    const qint64 timestampMs = currentTimeMs();
+    const std::uint32_t length = static_cast<std::uint32_t>(message.size());
+    char16_t *longText = nullptr;
+    if (length > static_cast<std::uint32_t>(InlineChars)) {
+        longText = new char16_t[length];
+        std::memcpy(longText, message.constData(), length * sizeof(char16_t));
+    }
+    const bool queued = enqueue([&](Record &record) {
+        record.timestampMs = timestampMs;
+        record.longText = longText;
+        record.length = length;
+        record.formatId = 0;
+        record.level = static_cast<std::uint8_t>(level);
+        if (!longText) {
+            std::memcpy(record.text, message.constData(), length * sizeof(char16_t));
+        }
+    });
+    if (!queued) {
+        delete[] longText;
+    }
 }
 
+// MAVSDK log seviyesini destekleyen overload fonksiyon
+void Logger::log(const QString &message, mavsdk::log::Level mavsdkLevel)
+{
+    log(message, mavsdkLogLevelToLogger(mavsdkLevel)); // Dönüştürüp ana log fonksiyonunu çağır
+}
 
 
 
-void Logger::log(const QString &message, LogLevel level)
+std::uint16_t Logger::registerFormat(const char *format)
 {
+    const int id = formatCount.fetch_add(1, std::memory_order_relaxed);
+    if (id >= MaxFormats) {
+        return 0;
+    }
+    registeredFormats[id] = format;
+    return static_cast<std::uint16_t>(id);
+}
 
 
+void Logger::setLogFilePath(const QString &path)
+{
+    QMutexLocker locker(&directoryMutex);  // Thread-safe hale getirmek için
+    pendingDirectory = path;
+    directoryChanged.store(true, std::memory_order_release);
+}
 
 
-    lastStatusMessage = message;  // Son durum mesajını saklamak için
-    lastStatusLevel = level; // Son durum seviyesini saklamak için
-    emit StatusDataUpdated();
+void Logger::setOverflowPolicy(OverflowPolicy newPolicy)
+{
+    policy.store(static_cast<int>(newPolicy), std::memory_order_relaxed);
+}
 
 
-    QMutexLocker locker(&mutex);  // Log yazarken eş zamanlı erişimi engellemek için
+Logger::OverflowPolicy Logger::overflowPolicy() const
+{
+    return static_cast<OverflowPolicy>(policy.load(std::memory_order_relaxed));
+}
 
-    if (!logFile.isOpen()) {
-        rotateLogFile(); // Eğer dosya kapalıysa yeni bir dosya açıyoruz
-    }
 
-    if (logFile.isOpen()) {
-        QTextStream out(&logFile);
-        QString levelStr;
-        switch (level) {
-        case INFO: levelStr = "INFO"; break;
-        case DEBUG: levelStr = "DEBUG"; break;
-        case ERROR: levelStr = "ERROR"; break;
-        case WARNING: levelStr = "WARNING"; break;
+quint64 Logger::droppedCount() const
+{
+    return dropped.load(std::memory_order_relaxed);
+}
+
+
+void Logger::writerLoop()
+{
+    rotateLogFile();
+    Record record;
+    for (;;) {
+        // Durdurma isteğinden önce kuyruğa girmiş her mesaj yazılır
+        const bool stopping = stopRequested.load(std::memory_order_acquire);
+
+        if (directoryChanged.exchange(false, std::memory_order_acquire)) {
+            QMutexLocker locker(&directoryMutex);
+            logDirectory = pendingDirectory;
+            locker.unlock();
+            writeBatch();
+            rotateLogFile(); // Yolu değiştirdikten sonra log dosyasını yeniden açıyoruz.
+            structuredFile.close();  // Sonraki yapılandırılmış kayıtta yeni klasörde açılır
+        }
+
+        bool drained = false;
+        while (queue.tryPop(record)) {
+            if (record.formatId != 0) {
+                appendStructured(record);
+            } else {
+                appendRecord(record);
+            }
+            drained = true;
+            if (batch.size() >= BatchBytes || structuredBatch.size() >= static_cast<std::size_t>(BatchBytes)) {
+                writeBatch();
+            }
+        }
+
+        const quint64 drops = dropped.load(std::memory_order_relaxed);
+        if (drops != reportedDrops) {
+            Record notice{};
+            notice.timestampMs = currentTimeMs();
+            notice.level = WARNING;
+            const QString text = QString("Log kuyruğu doldu, %1 mesaj atıldı.").arg(drops - reportedDrops);
+            notice.length = static_cast<std::uint32_t>(qMin<qsizetype>(text.size(), InlineChars));
+            std::memcpy(notice.text, text.constData(), notice.length * sizeof(char16_t));
+            appendRecord(notice);
+            reportedDrops = drops;
+        }
+
+        writeBatch();
+        if (stopping) {
             break;
         }
+        if (!drained) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(IdleSleepMs));
+        }
+    }
+}
+
 
-        out << QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss") << " - "
-            << levelStr << " - " << message << "\n";
+void Logger::appendRecord(const Record &record)
+{
+    const char16_t *text = record.longText ? record.longText : record.text;
+    const QString message = QString::fromUtf16(text, record.length);
+    delete[] record.longText;
+
+    // Aynı saniyedeki mesajlar aynı biçimlendirilmiş zamanı kullanır
+    const qint64 second = record.timestampMs / 1000;
+    if (second != stampSecond) {
+        stampSecond = second;
+        stampText = QDateTime::fromMSecsSinceEpoch(record.timestampMs).toString("yyyy-MM-dd HH:mm:ss").toUtf8();
     }
+
+    const LogLevel level = static_cast<LogLevel>(record.level);
+    batch.append(stampText);
+    batch.append(" - ");
+    batch.append(levelToString(level));
+    batch.append(" - ");
+    batch.append(message.toUtf8());
+    batch.append('\n');
+
+    emit StatusDataUpdated(message, level);
 }
 
-// MAVSDK log seviyesini destekleyen overload fonksiyon
-void Logger::log(const QString &message, mavsdk::log::Level mavsdkLevel)
+
+void Logger::appendStructured(const Record &record)
 {
-    log(message, mavsdkLogLevelToLogger(mavsdkLevel)); // Dönüştürüp ana log fonksiyonunu çağır
+    if (!structuredFile.isOpen() && !openStructuredFile()) {
+        return;
+    }
+
+    // Biçim tanımı dosyada ilk kullanımdan önce bir kez yazılır
+    const char *format = registeredFormats[record.formatId];
+    if (!formatWritten[record.formatId]) {
+        formatWritten[record.formatId] = true;
+        structuredBatch.push_back(static_cast<std::uint8_t>(StructuredLog::Kind::Format) << 4);
+        StructuredLog::writeVarint(structuredBatch, record.formatId);
+        StructuredLog::writeString(structuredBatch, format, std::strlen(format));
+    }
+
+    // Ham argümanlar sıkıştırılır: tam sayılar varint, metinler UTF-8
+    argumentScratch.clear();
+    const auto *p = reinterpret_cast<const std::uint8_t *>(record.text);
+    const std::uint8_t *end = p + record.length;
+    while (p < end) {
+        const RawTag tag = static_cast<RawTag>(*p++);
+        switch (tag) {
+        case RawTag::Int: {
+            std::int64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            p += sizeof(value);
+            argumentScratch.push_back(static_cast<std::uint8_t>(StructuredLog::Tag::Int));
+            StructuredLog::writeVarint(argumentScratch, StructuredLog::zigzag(value));
+            break;
+        }
+        case RawTag::UInt: {
+            std::uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            p += sizeof(value);
+            argumentScratch.push_back(static_cast<std::uint8_t>(StructuredLog::Tag::UInt));
+            StructuredLog::writeVarint(argumentScratch, value);
+            break;
+        }
+        case RawTag::Double: {
+            double value;
+            std::memcpy(&value, p, sizeof(value));
+            p += sizeof(value);
+            argumentScratch.push_back(static_cast<std::uint8_t>(StructuredLog::Tag::Double));
+            StructuredLog::writeDouble(argumentScratch, value);
+            break;
+        }
+        case RawTag::Bool:
+            argumentScratch.push_back(static_cast<std::uint8_t>(StructuredLog::Tag::Bool));
+            argumentScratch.push_back(*p++);
+            break;
+        case RawTag::Utf8:
+        case RawTag::Utf16: {
+            std::uint16_t bytes;
+            std::memcpy(&bytes, p, sizeof(bytes));
+            p += sizeof(bytes);
+            argumentScratch.push_back(static_cast<std::uint8_t>(StructuredLog::Tag::String));
+            if (tag == RawTag::Utf8) {
+                StructuredLog::writeString(argumentScratch, reinterpret_cast<const char *>(p), bytes);
+            } else {
+                const QByteArray utf8 = QString::fromUtf16(reinterpret_cast<const char16_t *>(p), bytes / 2).toUtf8();
+                StructuredLog::writeString(argumentScratch, utf8.constData(), static_cast<std::size_t>(utf8.size()));
+            }
+            p += bytes;
+            break;
+        }
+        }
+    }
+
+    structuredBatch.push_back(static_cast<std::uint8_t>(
+        static_cast<std::uint8_t>(StructuredLog::Kind::Message) << 4 | (record.level & 0x0F)));
+    StructuredLog::writeVarint(structuredBatch, StructuredLog::zigzag(record.timestampMs - structuredLastMs));
+    structuredLastMs = record.timestampMs;
+    StructuredLog::writeVarint(structuredBatch, record.formatId);
+    StructuredLog::writeVarint(structuredBatch, argumentScratch.size());
+    structuredBatch.insert(structuredBatch.end(), argumentScratch.begin(), argumentScratch.end());
+
+    // Metin sadece arayüz dinliyorsa ve burada, yazıcı thread'inde üretilir
+    static const QMetaMethod statusSignal = QMetaMethod::fromSignal(&Logger::StatusDataUpdated);
+    if (isSignalConnected(statusSignal)) {
+        std::vector<StructuredLog::Argument> arguments;
+        StructuredLog::decodeArguments(argumentScratch.data(), argumentScratch.data() + argumentScratch.size(), arguments);
+        emit StatusDataUpdated(QString::fromStdString(StructuredLog::formatMessage(format, arguments)),
+                               static_cast<LogLevel>(record.level));
+    }
 }
 
 
+bool Logger::openStructuredFile()
+{
+    const qint64 startMs = currentTimeMs();
+    structuredFile.setFileName(QDir(logDirectory).filePath(
+        "application_" + QDateTime::fromMSecsSinceEpoch(startMs).toString("yyyyMMdd_HHmmss_zzz") + ".ulog"));
+    if (!structuredFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Yapılandırılmış log dosyası açılamadı!";
+        return false;
+    }
 
-void Logger::setLogFilePath(const QString &path)
+    StructuredLog::FileHeader header{};
+    std::memcpy(header.magic, StructuredLog::FileMagic, sizeof(header.magic));
+    header.version = StructuredLog::FileVersion;
+    header.headerSize = sizeof(header);
+    header.startWallClockMs = startMs;
+    structuredFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    formatWritten.assign(MaxFormats, false);
+    structuredLastMs = startMs;
+    return true;
+}
+
+
+void Logger::writeBatch()
 {
-    QMutexLocker locker(&mutex);  // Thread-safe hale getirmek için
-    logDirectory = path;
-    rotateLogFile(); // Yolu değiştirdikten sonra log dosyasını yeniden açıyoruz.
+    if (!structuredBatch.empty() && structuredFile.isOpen()) {
+        structuredFile.write(reinterpret_cast<const char *>(structuredBatch.data()),
+                             static_cast<qint64>(structuredBatch.size()));
+        structuredFile.flush();
+        if (structuredFile.size() > MaxFileBytes) {
+            structuredFile.close();  // Sonraki kayıt yeni dosya açar
+        }
+    }
+    structuredBatch.clear();
+
+    if (batch.isEmpty()) {
+        return;
+    }
+    if (!logFile.isOpen()) {
+        rotateLogFile(); // Eğer dosya kapalıysa yeni bir dosya açıyoruz
+    }
+    if (logFile.isOpen()) {
+        logFile.write(batch);
+        logFile.flush();
+        if (logFile.size() > MaxFileBytes) {
+            rotateLogFile();
+        }
+    }
+    batch.clear();
 }
 
+
 void Logger::rotateLogFile()
 {
-    QMutexLocker locker(&mutex);  // Thread-safe hale getirmek için
-
     if (logFile.isOpen()) {
         logFile.close();
     }
@@ -93,7 +358,7 @@ void Logger::rotateLogFile()
     QFileInfo checkFile(QDir(logDirectory).filePath(logFileName));
 
     // Eğer dosya çok büyükse veya mevcut değilse, yeni bir dosya ismi oluşturulur.
-    if (checkFile.exists() && checkFile.size() > 10 * 1024 * 1024) {  // 10MB'tan büyükse
+    if (checkFile.exists() && checkFile.size() > MaxFileBytes) {  // 10MB'tan büyükse
         logFileName = "application_" + QDateTime::currentDateTime().toString("yyyyMMdd_HHmmss") + ".log";
     }
 
@@ -105,6 +370,18 @@ void Logger::rotateLogFile()
 }
 
 
+const char *Logger::levelToString(LogLevel level)
+{
+    switch (level) {
+    case INFO: return "INFO";
+    case DEBUG: return "DEBUG";
+    case ERROR: return "ERROR";
+    case WARNING: return "WARNING";
+    }
+    return "INFO";
+}
+
+
 void Logger::appendLogMessage(const QString &message , QPlainTextEdit *logTextEdit, const LogLevel &logLevel ) {
     // Get current date and time
 
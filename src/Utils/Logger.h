@@ -11,6 +11,22 @@
 #include <QDir>
 #include <QFileInfo>
 #include <mavsdk/log_callback.h>
+#include "src/Utils/BoundedMpscQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Yapılandırılmış log: biçim metni çağrı yerinde bir kez kaydedilir, log anında sadece ham argümanlar
+// kopyalanır. Kayıtlar ikili .ulog dosyasına gider; metin arayüzde veya tools/ulog_decode ile üretilir.
+//   LOG_STRUCTURED(INFO, "Yeni hedef koordinatlar: %1, %2", lat, lon);
+#define LOG_STRUCTURED(level, format, ...) \
+    do { \
+        static const std::uint16_t structuredFormatId = Logger::registerFormat(format); \
+        Logger::instance().logStructured(level, structuredFormatId, ##__VA_ARGS__); \
+    } while (false)
 
 // Log seviyelerini tanımlıyoruz
 enum LogLevel {
@@ -20,11 +36,31 @@ enum LogLevel {
     WARNING
 };
 
+// Uygulama günlüğü. log() herhangi bir thread'den (MAVSDK callback'leri dahil) çağrılabilir:
+// çağıran sadece zaman damgasını alır ve mesajı önceden ayrılmış kilitsiz kuyruğa kopyalar.
+// Biçimlendirme, dosyaya toplu yazma, dosya rotasyonu ve StatusDataUpdated sinyali
+// arka plandaki tek yazıcı thread'inde yapılır. Yapılandırılmış kayıtlar (LOG_STRUCTURED) aynı kuyruktan
+// geçer ama metin dosyası yerine StructuredLog formatındaki ikili dosyaya yazılır.
 class Logger : public QObject // QObject'ten türetildi
 {
     Q_OBJECT  // Sinyal-slot kullanabilmek için bu makro gerekli
 
 public:
+    // Kuyruk dolduğunda ne yapılacağı
+    enum class OverflowPolicy {
+        Block,       // Çağıran yer açılana kadar bekler (yazıcı thread'i hariç)
+        DropOldest,  // En eski bekleyen mesaj atılır
+        Drop         // Yeni mesaj atılır ve sayılır
+    };
+
+    static constexpr std::size_t QueueCapacity = 4096;
+    static constexpr int InlineChars = 108;  // Daha uzun mesajlar için ayrıca bellek ayrılır
+    static constexpr int IdleSleepMs = 5;
+    static constexpr int BatchBytes = 64 * 1024;
+    static constexpr qint64 MaxFileBytes = 10 * 1024 * 1024;
+    static constexpr int MaxFormats = 4096;
+    static constexpr int ArgumentBytes = InlineChars * static_cast<int>(sizeof(char16_t));
+
     // Logger sınıfının tek örneğini almak için kullanılan fonksiyon
     static Logger& instance();
 
@@ -32,11 +68,39 @@ public:
     void log(const QString &message, LogLevel level = INFO);
     void log(const QString &message, mavsdk::log::Level mavsdkLevel); // MAVSDK overload
 
+    // LOG_STRUCTURED tarafından kullanılır. Desteklenen argümanlar: tam sayılar, enum'lar, kayan noktalı
+    // sayılar, bool, QString ve const char*. ArgumentBytes'a sığmayan metin argümanları kısaltılır.
+    static std::uint16_t registerFormat(const char *format);
+    template <typename... Args>
+    void logStructured(LogLevel level, std::uint16_t formatId, const Args &...args)
+    {
+        if (formatId == 0) {
+            return;  // Biçim tablosu dolu
+        }
+        const qint64 timestampMs = currentTimeMs();
+        enqueue([&](Record &record) {
+            record.timestampMs = timestampMs;
+            record.longText = nullptr;
+            record.level = static_cast<std::uint8_t>(level);
+            record.formatId = formatId;
+            ArgumentWriter writer{reinterpret_cast<std::uint8_t *>(record.text),
+                                  reinterpret_cast<std::uint8_t *>(record.text) + ArgumentBytes};
+            (writer.add(args), ...);
+            record.length = static_cast<std::uint32_t>(writer.size());
+        });
+    }
+
     // Log dosyasının yolunu değiştirmek için bir fonksiyon
     void setLogFilePath(const QString &path);
 
+    void setOverflowPolicy(OverflowPolicy policy);
+    OverflowPolicy overflowPolicy() const;
+    // Başlangıçtan beri kuyruk dolduğu için atılan mesaj sayısı
+    quint64 droppedCount() const;
+
     // MAVSDK log seviyelerini Logger seviyelerine dönüştüren yardımcı fonksiyon
     static LogLevel mavsdkLogLevelToLogger(mavsdk::log::Level mavsdkLevel);
+    static const char *levelToString(LogLevel level);
 
     void appendLogMessage(const QString &message,
                           QPlainTextEdit *logTextEdit,
@@ -46,30 +110,163 @@ public:
                           QPlainTextEdit *logTextEdit,
                           mavsdk::log::Level level);
 
-    QString lastStatusMessage;  // Son durum mesajını saklamak için
-    LogLevel lastStatusLevel; // Son durum seviyesini saklamak için
-    std::pair<QString, LogLevel> getLastLog() const;
-
 private:
     Logger(); // Constructor'u private yaparak tekil (singleton) olmasını sağlarız.
     ~Logger();
 
-    // Günlük dosyasının adı
+    struct Record {
+        qint64 timestampMs;
+        char16_t *longText;  // InlineChars'tan uzun mesaj; yazıcı serbest bırakır
+        std::uint32_t length;  // Metinde karakter, yapılandırılmış kayıtta argüman baytı
+        std::uint16_t formatId;  // 0: düz metin; değilse text ham argüman baytlarıdır
+        std::uint8_t level;
+        char16_t text[InlineChars];
+    };
+
+    // Kuyruktaki ham argüman biçimi (sabit genişlik, kopyalaması ucuz); yazıcı dosya için sıkıştırır
+    enum class RawTag : std::uint8_t { Int, UInt, Double, Bool, Utf8, Utf16 };
+
+    struct ArgumentWriter {
+        std::uint8_t *begin;
+        std::uint8_t *end;
+        std::uint8_t *cursor = begin;
+        bool full = false;  // Sığmayan argümandan sonrakiler de yazılmaz ki %N sırası kaymasın
+
+        std::size_t size() const { return static_cast<std::size_t>(cursor - begin); }
+
+        template <typename T>
+        void putFixed(RawTag tag, T value)
+        {
+            if (full || end - cursor < static_cast<std::ptrdiff_t>(1 + sizeof(T))) {
+                full = true;
+                return;
+            }
+            *cursor++ = static_cast<std::uint8_t>(tag);
+            std::memcpy(cursor, &value, sizeof(T));
+            cursor += sizeof(T);
+        }
+
+        void putText(RawTag tag, const void *data, std::size_t bytes)
+        {
+            if (full || end - cursor < 3) {
+                full = true;
+                return;
+            }
+            const std::size_t room = static_cast<std::size_t>(end - cursor - 3) & ~std::size_t(1);
+            const std::uint16_t length = static_cast<std::uint16_t>(bytes < room ? bytes : room);
+            *cursor++ = static_cast<std::uint8_t>(tag);
+            std::memcpy(cursor, &length, sizeof(length));
+            cursor += sizeof(length);
+            std::memcpy(cursor, data, length);
+            cursor += length;
+        }
+
+        template <typename T>
+        void add(const T &value)
+        {
+            using Type = std::decay_t<T>;
+            if constexpr (std::is_same_v<Type, bool>) {
+                putFixed(RawTag::Bool, static_cast<std::uint8_t>(value));
+            } else if constexpr (std::is_enum_v<Type>) {
+                putFixed(RawTag::Int, static_cast<std::int64_t>(value));
+            } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+                putFixed(RawTag::Int, static_cast<std::int64_t>(value));
+            } else if constexpr (std::is_integral_v<Type>) {
+                putFixed(RawTag::UInt, static_cast<std::uint64_t>(value));
+            } else if constexpr (std::is_floating_point_v<Type>) {
+                putFixed(RawTag::Double, static_cast<double>(value));
+            } else if constexpr (std::is_same_v<Type, QString>) {
+                putText(RawTag::Utf16, value.constData(), static_cast<std::size_t>(value.size()) * sizeof(char16_t));
+            } else if constexpr (std::is_convertible_v<Type, const char *>) {
+                const char *text = value;
+                putText(RawTag::Utf8, text, std::strlen(text));
+            } else {
+                static_assert(std::is_same_v<Type, bool>, "Desteklenmeyen log argüman tipi");
+            }
+        }
+    };
+
+    static qint64 currentTimeMs();
+
+    // Kuyruğa yazar; doluysa taşma politikası uygulanır. Yazılamazsa false döner.
+    template <typename Filler>
+    bool enqueue(Filler &&fill)
+    {
+        if (queue.tryEmplace(fill)) {
+            return true;
+        }
+        return enqueueSlow(fill);
+    }
+
+    template <typename Filler>
+    bool enqueueSlow(Filler &fill)
+    {
+        switch (static_cast<OverflowPolicy>(policy.load(std::memory_order_relaxed))) {
+        case OverflowPolicy::Block:
+            // Yazıcının kendisi (ya da kapanmış yazıcı) beklerse kuyruk hiç boşalmaz
+            if (std::this_thread::get_id() != writerThread.get_id() && !stopRequested.load(std::memory_order_acquire)) {
+                do {
+                    std::this_thread::yield();
+                    if (queue.tryEmplace(fill)) {
+                        return true;
+                    }
+                } while (!stopRequested.load(std::memory_order_acquire));
+            }
+            break;
+        case OverflowPolicy::DropOldest:
+            // Yazıcıyla aynı anda tüketmek güvenli: kuyruk çıkışı da CAS ile ilerler
+            for (int attempt = 0; attempt < 4; ++attempt) {
+                if (queue.tryConsume([](const Record &oldest) { delete[] oldest.longText; })) {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (queue.tryEmplace(fill)) {
+                    return true;
+                }
+            }
+            break;
+        case OverflowPolicy::Drop:
+            break;
+        }
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    BoundedMpscQueue<Record> queue;
+    std::atomic<int> policy{static_cast<int>(OverflowPolicy::Block)};
+    std::atomic<quint64> dropped{0};
+    std::atomic<bool> stopRequested{false};
+    std::thread writerThread;
+
+    // setLogFilePath ile gelen yeni klasör; yazıcı bir sonraki turda uygular
+    QMutex directoryMutex;
+    QString pendingDirectory;
+    std::atomic<bool> directoryChanged{false};
+
+    // Sadece yazıcı thread'i tarafından kullanılır
     QString logFileName;
     QString logDirectory;
-
-    // Dosya nesnesi
     QFile logFile;
+    QByteArray batch;
+    qint64 stampSecond = -1;
+    QByteArray stampText;  // Saniye başına bir kez biçimlendirilir
+    quint64 reportedDrops = 0;
+    QFile structuredFile;  // Yapılandırılmış kayıtlar; ilk kayıtta açılır
+    std::vector<std::uint8_t> structuredBatch;
+    std::vector<std::uint8_t> argumentScratch;
+    std::vector<bool> formatWritten;  // Bu dosyada tanımı yazılmış biçim ID'leri
+    qint64 structuredLastMs = 0;
 
-    // Mutex nesnesi - paralel yazma işlemleri için
-    static QMutex mutex;
-
+    void writerLoop();
+    void appendRecord(const Record &record);
+    void appendStructured(const Record &record);
+    bool openStructuredFile();
+    void writeBatch();
     // Log dosyasının rotasyonu için kullanılan fonksiyon
     void rotateLogFile();
-    QString levelToString(mavsdk::log::Level level);
 
 signals:
-    void StatusDataUpdated();  // Sinyal tanımlandı
+    // Yazıcı thread'inden yayınlanır; GUI'ye kuyruklu bağlantıyla ulaşır
+    void StatusDataUpdated(const QString &message, LogLevel level);
 
 };
 #endif // LOGGER_H
@@ -0,0 +1,75 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Sequence lock: yazarlar hiçbir zaman okuyucuyu beklemez, okuyucular mutex almadan
+// tutarlı bir kopya elde eder. Sıra numarası tek iken yazma sürüyor demektir;
+// okuyucu kopyalama öncesi ve sonrası aynı çift sayıyı görene kadar tekrar dener.
+//
+// MAVSDK tüm kullanıcı callback'lerini tek bir thread'den çağırdığı için yazarlar
+// pratikte çakışmaz. Yine de birden fazla yazar güvenli olsun diye yazma hakkı
+// CAS ile alınır; bu sadece iki yazar aynı anda geldiğinde kısa bir döngüye girer.
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock sadece trivially copyable tiplerle kullanılabilir");
+
+public:
+    SeqLock() = default;
+    SeqLock(const SeqLock &) = delete;
+    SeqLock &operator=(const SeqLock &) = delete;
+
+    // Değeri yerinde değiştirir. mutate(T&) kısa ve bloklamayan bir işlem olmalıdır.
+    template <typename Mutator>
+    void write(Mutator &&mutate) {
+        std::uint64_t seq = sequence.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((seq & 1u) == 0 &&
+                sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                break;
+            }
+            seq = sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        mutate(value);
+
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    void store(const T &newValue) {
+        write([&newValue](T &current) { current = newValue; });
+    }
+
+    // Tutarlı bir kopya döndürür
+    T load() const {
+        T copy;
+        for (;;) {
+            const std::uint64_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1u) {
+                continue;
+            }
+
+            std::memcpy(static_cast<void *>(&copy), &value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                return copy;
+            }
+        }
+    }
+
+    // Her yazmada ikişer artar; okuyucular değişiklik olup olmadığını buradan anlayabilir
+    std::uint64_t version() const {
+        return sequence.load(std::memory_order_acquire);
+    }
+
+private:
+    alignas(64) std::atomic<std::uint64_t> sequence{0};
+    alignas(64) T value{};
+};
+
+#endif // SEQLOCK_H
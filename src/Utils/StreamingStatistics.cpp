@@ -0,0 +1,164 @@
+#include "StreamingStatistics.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+constexpr double Pi = 3.14159265358979323846;
+
+// k1 ölçek fonksiyonu: centroid boyutunu uçlarda küçük, ortada büyük tutar
+double scaleK(double q) {
+    return StreamingStatistics::Compression / (2.0 * Pi) * std::asin(2.0 * q - 1.0);
+}
+
+double scaleKInverse(double k) {
+    return (std::sin(k * 2.0 * Pi / StreamingStatistics::Compression) + 1.0) / 2.0;
+}
+
+}
+
+void StreamingStatistics::add(double value) {
+    if (!std::isfinite(value)) {
+        return;
+    }
+
+    ++n;
+    const double delta = value - runningMean;
+    runningMean += delta / static_cast<double>(n);
+    m2 += delta * (value - runningMean);
+
+    if (n == 1) {
+        minimum = maximum = value;
+    } else {
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+
+    buffer[buffered++] = value;
+    if (buffered == BufferSize) {
+        flush();
+    }
+}
+
+void StreamingStatistics::reset() {
+    n = 0;
+    runningMean = 0.0;
+    m2 = 0.0;
+    minimum = 0.0;
+    maximum = 0.0;
+    centroids = 0;
+    digestWeight = 0.0;
+    buffered = 0;
+}
+
+double StreamingStatistics::mean() const {
+    return n ? runningMean : std::numeric_limits<double>::quiet_NaN();
+}
+
+double StreamingStatistics::variance() const {
+    return n > 1 ? m2 / static_cast<double>(n - 1) : std::numeric_limits<double>::quiet_NaN();
+}
+
+double StreamingStatistics::stddev() const {
+    return std::sqrt(variance());
+}
+
+double StreamingStatistics::min() const {
+    return n ? minimum : std::numeric_limits<double>::quiet_NaN();
+}
+
+double StreamingStatistics::max() const {
+    return n ? maximum : std::numeric_limits<double>::quiet_NaN();
+}
+
+// Sıralı tampon ile sıralı centroid listesini tek geçişte birleştirir ve
+// ölçek fonksiyonunun izin verdiği kadar komşu centroid'i kaynaştırır
+void StreamingStatistics::flush() {
+    if (buffered == 0) {
+        return;
+    }
+
+    std::sort(buffer, buffer + buffered);
+
+    Centroid merged[MaxCentroids + BufferSize];
+    std::size_t total = 0;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < centroids || j < buffered) {
+        if (j == buffered || (i < centroids && digest[i].mean <= buffer[j])) {
+            merged[total++] = digest[i++];
+        } else {
+            merged[total++] = {buffer[j++], 1.0};
+        }
+    }
+
+    const double totalWeight = digestWeight + static_cast<double>(buffered);
+    double weightSoFar = 0.0;
+    double limit = totalWeight * scaleKInverse(scaleK(0.0) + 1.0);
+
+    std::size_t out = 0;
+    Centroid current = merged[0];
+    for (std::size_t k = 1; k < total; ++k) {
+        const Centroid &next = merged[k];
+        if (weightSoFar + current.weight + next.weight <= limit) {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        } else {
+            weightSoFar += current.weight;
+            limit = totalWeight * scaleKInverse(scaleK(std::min(1.0, weightSoFar / totalWeight)) + 1.0);
+            if (out < MaxCentroids - 1) {
+                digest[out++] = current;
+                current = next;
+            } else {
+                // Ölçek fonksiyonu bu sınıra ulaşmayı engeller; yine de taşmayı önle
+                current.weight += next.weight;
+                current.mean += (next.mean - current.mean) * next.weight / current.weight;
+            }
+        }
+    }
+    digest[out++] = current;
+
+    centroids = out;
+    digestWeight = totalWeight;
+    buffered = 0;
+}
+
+double StreamingStatistics::quantile(double q) {
+    if (n == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    flush();
+
+    q = std::clamp(q, 0.0, 1.0);
+    if (centroids == 1 || q <= 0.0) {
+        return q >= 1.0 ? maximum : (centroids == 1 ? digest[0].mean : minimum);
+    }
+    if (q >= 1.0) {
+        return maximum;
+    }
+
+    const double target = q * digestWeight;
+
+    // İlk centroid'in yarısından önce: minimum ile ilk centroid arasında doğrusal
+    if (target < digest[0].weight / 2.0) {
+        return minimum + (digest[0].mean - minimum) * target / (digest[0].weight / 2.0);
+    }
+
+    double cumulative = 0.0;
+    for (std::size_t i = 0; i + 1 < centroids; ++i) {
+        const double left = cumulative + digest[i].weight / 2.0;
+        const double right = cumulative + digest[i].weight + digest[i + 1].weight / 2.0;
+        if (target < right) {
+            const double t = (target - left) / (right - left);
+            return digest[i].mean + t * (digest[i + 1].mean - digest[i].mean);
+        }
+        cumulative += digest[i].weight;
+    }
+
+    // Son centroid'in yarısından sonra: son centroid ile maksimum arasında doğrusal
+    const Centroid &last = digest[centroids - 1];
+    const double left = digestWeight - last.weight / 2.0;
+    const double t = (target - left) / (last.weight / 2.0);
+    return last.mean + std::clamp(t, 0.0, 1.0) * (maximum - last.mean);
+}
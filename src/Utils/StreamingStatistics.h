@@ -0,0 +1,64 @@
+#ifndef STREAMINGSTATISTICS_H
+#define STREAMINGSTATISTICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Sabit bellekli akan veri istatistiği.
+// Ortalama ve varyans Welford yöntemiyle, yüzdelikler birleştirmeli t-digest ile hesaplanır.
+// Tüm durum sabit boyutlu dizilerde tutulur (heap yok), böylece nesne trivially copyable
+// kalır ve SeqLock ile yayınlanabilir.
+//
+// Yeni değerler önce bir tampona eklenir; tampon dolunca sıralanıp centroid listesiyle
+// birleştirilir. Ekleme amortize O(log Buffer) olup geçmiş uzunluğundan bağımsızdır.
+class StreamingStatistics {
+public:
+    // t-digest sıkıştırma parametresi: centroid sayısı en fazla ~Compression olur,
+    // uçlardaki (p1, p99) hata kuyruklarda çok daha küçüktür.
+    static constexpr std::size_t Compression = 100;
+    static constexpr std::size_t MaxCentroids = 2 * Compression;
+    static constexpr std::size_t BufferSize = 256;
+
+    void add(double value);
+    void reset();
+
+    std::uint64_t count() const { return n; }
+    double mean() const;
+    double variance() const;  // Örneklem varyansı (n - 1)
+    double stddev() const;
+    double min() const;
+    double max() const;
+
+    // q [0, 1] aralığında. Tamponu birleştirdiği için const değildir;
+    // okuyucular yayınlanan kopya üzerinde çağırmalıdır.
+    double quantile(double q);
+
+    std::size_t centroidCount() const { return centroids; }
+
+private:
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+    void flush();
+
+    // Welford
+    std::uint64_t n = 0;
+    double runningMean = 0.0;
+    double m2 = 0.0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+
+    // t-digest
+    Centroid digest[MaxCentroids];
+    std::size_t centroids = 0;
+    double digestWeight = 0.0;
+    double buffer[BufferSize];
+    std::size_t buffered = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<StreamingStatistics>, "StreamingStatistics POD olmalı");
+
+#endif // STREAMINGSTATISTICS_H
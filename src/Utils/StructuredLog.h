@@ -0,0 +1,197 @@
+#ifndef STRUCTUREDLOG_H
+#define STRUCTUREDLOG_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Yapılandırılmış log dosyası (.ulog) formatı. Uygulama (Logger) ve tools/ulog_decode tarafından
+// ortak kullanılır; sadece standart kütüphaneye bağlıdır.
+//
+//   FileHeader
+//   kayıt*       : uint8 (Kind << 4 | seviye) | gövde
+//   Format       : varint biçim ID | varint uzunluk | UTF-8 biçim metni
+//                  (her ID dosyada ilk kullanımından önce bir kez yazılır; dosya kendi kendini tanımlar)
+//   Message      : zigzag varint zaman farkı (ms, önceki mesaja; ilki FileHeader'a göre)
+//                  | varint biçim ID | varint argüman bayt sayısı | argümanlar
+//   argüman      : uint8 Tag | değer
+//                  Int: zigzag varint, UInt: varint, Double: 8 bayt, Bool: 1 bayt, String: varint uzunluk + UTF-8
+//
+// Metin hiçbir zaman log anında üretilmez; biçim metnindeki %1..%99 okuma sırasında argümanlarla
+// değiştirilir (QString::arg ile aynı yazım). Tüm sabit genişlikli alanlar little-endian'dır.
+namespace StructuredLog {
+
+constexpr char FileMagic[8] = {'U', 'A', 'V', 'U', 'L', 'O', 'G', '1'};
+constexpr std::uint32_t FileVersion = 1;
+
+enum class Kind : std::uint8_t {
+    Format = 1,
+    Message = 2
+};
+
+// Numaralar dosyaya yazıldığı için değiştirilmemeli
+enum class Tag : std::uint8_t {
+    Int = 1,
+    UInt = 2,
+    Double = 3,
+    Bool = 4,
+    String = 5
+};
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    std::int64_t startWallClockMs;  // UNIX epoch ms; ilk mesajın zaman farkı buna göredir
+};
+
+struct Argument {
+    Tag tag = Tag::Int;
+    std::int64_t intValue = 0;
+    std::uint64_t uintValue = 0;
+    double doubleValue = 0.0;
+    bool boolValue = false;
+    std::string text;
+};
+
+inline void writeVarint(std::vector<std::uint8_t> &out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+inline std::uint64_t zigzag(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+inline std::int64_t unzigzag(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+inline void writeDouble(std::vector<std::uint8_t> &out, double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+    }
+}
+
+inline void writeString(std::vector<std::uint8_t> &out, const char *utf8, std::size_t length) {
+    writeVarint(out, length);
+    out.insert(out.end(), utf8, utf8 + length);
+}
+
+// Okuma fonksiyonları veri bitmişse false döner ve p'yi ilerletmez
+inline bool readVarint(const std::uint8_t *&p, const std::uint8_t *end, std::uint64_t &value) {
+    value = 0;
+    const std::uint8_t *cursor = p;
+    for (int shift = 0; cursor < end && shift < 64; shift += 7) {
+        const std::uint8_t byte = *cursor++;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            p = cursor;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool decodeArguments(const std::uint8_t *p, const std::uint8_t *end, std::vector<Argument> &arguments) {
+    arguments.clear();
+    while (p < end) {
+        Argument argument;
+        argument.tag = static_cast<Tag>(*p++);
+        std::uint64_t value = 0;
+        switch (argument.tag) {
+        case Tag::Int:
+            if (!readVarint(p, end, value)) {
+                return false;
+            }
+            argument.intValue = unzigzag(value);
+            break;
+        case Tag::UInt:
+            if (!readVarint(p, end, argument.uintValue)) {
+                return false;
+            }
+            break;
+        case Tag::Double: {
+            if (end - p < 8) {
+                return false;
+            }
+            std::uint64_t bits = 0;
+            for (int i = 0; i < 8; ++i) {
+                bits |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+            }
+            std::memcpy(&argument.doubleValue, &bits, sizeof(bits));
+            p += 8;
+            break;
+        }
+        case Tag::Bool:
+            if (p >= end) {
+                return false;
+            }
+            argument.boolValue = *p++ != 0;
+            break;
+        case Tag::String:
+            if (!readVarint(p, end, value) || value > static_cast<std::uint64_t>(end - p)) {
+                return false;
+            }
+            argument.text.assign(reinterpret_cast<const char *>(p), static_cast<std::size_t>(value));
+            p += value;
+            break;
+        default:
+            return false;
+        }
+        arguments.push_back(std::move(argument));
+    }
+    return true;
+}
+
+inline std::string argumentToString(const Argument &argument) {
+    char buffer[32];
+    switch (argument.tag) {
+    case Tag::Int:
+        return std::to_string(argument.intValue);
+    case Tag::UInt:
+        return std::to_string(argument.uintValue);
+    case Tag::Double:
+        std::snprintf(buffer, sizeof(buffer), "%.10g", argument.doubleValue);
+        return buffer;
+    case Tag::Bool:
+        return argument.boolValue ? "true" : "false";
+    case Tag::String:
+        return argument.text;
+    }
+    return std::string();
+}
+
+// %1..%99 yer tutucularını argümanlarla değiştirir; karşılığı olmayanlar olduğu gibi kalır
+inline std::string formatMessage(const std::string &format, const std::vector<Argument> &arguments) {
+    std::string result;
+    result.reserve(format.size() + 16 * arguments.size());
+    for (std::size_t i = 0; i < format.size(); ++i) {
+        if (format[i] == '%' && i + 1 < format.size() && format[i + 1] >= '1' && format[i + 1] <= '9') {
+            std::size_t number = static_cast<std::size_t>(format[i + 1] - '0');
+            std::size_t digits = 1;
+            if (i + 2 < format.size() && format[i + 2] >= '0' && format[i + 2] <= '9') {
+                number = number * 10 + static_cast<std::size_t>(format[i + 2] - '0');
+                digits = 2;
+            }
+            if (number <= arguments.size()) {
+                result += argumentToString(arguments[number - 1]);
+                i += digits;
+                continue;
+            }
+        }
+        result += format[i];
+    }
+    return result;
+}
+
+} // namespace StructuredLog
+
+#endif // STRUCTUREDLOG_H
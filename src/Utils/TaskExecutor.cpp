@@ -0,0 +1,207 @@
+#include "TaskExecutor.h"
+#include "src/Utils/Logger.h"
+#include <algorithm>
+
+namespace {
+// Görev içinden gönderilen alt görevler aynı işçinin kuyruğuna düşer (cache dostu)
+thread_local TaskExecutor *currentExecutor = nullptr;
+thread_local std::size_t currentWorker = 0;
+
+std::int64_t microsecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void updateMax(std::atomic<std::int64_t> &target, std::int64_t value) {
+    std::int64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+}
+
+TaskExecutor &TaskExecutor::instance() {
+    // Logger önce oluşturulur ki yürütücü kapanırken biten görevler hâlâ log yazabilsin
+    Logger::instance();
+    static TaskExecutor executor;
+    return executor;
+}
+
+TaskExecutor::TaskExecutor(std::size_t workerCount, std::size_t capacity)
+    : capacity(std::max<std::size_t>(capacity, 1)) {
+    if (workerCount == 0) {
+        workerCount = std::max(2u, std::thread::hardware_concurrency());
+    }
+
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        workers[i]->thread = std::thread(&TaskExecutor::run, this, i);
+    }
+}
+
+TaskExecutor::~TaskExecutor() {
+    shutdown();
+}
+
+void TaskExecutor::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        if (stopping) {
+            return;
+        }
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (auto &worker : workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+
+    const Metrics m = metrics();
+    Logger::instance().log("TaskExecutor durduruldu. Tamamlanan: " + QString::number(m.completed) +
+                               ", iptal: " + QString::number(m.cancelled) +
+                               ", reddedilen: " + QString::number(m.rejected) +
+                               ", çalınan: " + QString::number(m.stolen) +
+                               ", ort. bekleme: " + QString::number(m.averageWaitUs / 1000.0, 'f', 2) + " ms" +
+                               ", ort. çalışma: " + QString::number(m.averageRunUs / 1000.0, 'f', 2) + " ms", INFO);
+}
+
+bool TaskExecutor::submit(Task task, Priority priority, CancellationToken token) {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        if (stopping) {
+            rejected.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    // Kapasite rezervasyonu: sayaç sınırı aşarsa geri alınır
+    if (queued.fetch_add(1, std::memory_order_acq_rel) >= capacity) {
+        queued.fetch_sub(1, std::memory_order_acq_rel);
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::instance().log("TaskExecutor kuyruğu dolu, görev reddedildi.", WARNING);
+        return false;
+    }
+
+    const std::size_t p = static_cast<std::size_t>(priority);
+    const std::size_t target = currentExecutor == this
+                                   ? currentWorker
+                                   : nextWorker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+    {
+        std::lock_guard<std::mutex> lock(workers[target]->mutex);
+        workers[target]->queues[p].push_back({std::move(task), std::move(token), std::chrono::steady_clock::now()});
+    }
+    queuedByPriority[p].fetch_add(1, std::memory_order_relaxed);
+    submitted.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        // Uyumak üzere olan işçi bildirimi kaçırmasın
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wake.notify_one();
+    return true;
+}
+
+// Öncelik sırasıyla: önce kendi kuyruğunun önü, sonra diğer işçilerin kuyruklarının arkası
+bool TaskExecutor::take(std::size_t index, Item &item) {
+    for (std::size_t p = 0; p < PriorityCount; ++p) {
+        {
+            Worker &own = *workers[index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.queues[p].empty()) {
+                item = std::move(own.queues[p].front());
+                own.queues[p].pop_front();
+                queuedByPriority[p].fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        for (std::size_t offset = 1; offset < workers.size(); ++offset) {
+            Worker &victim = *workers[(index + offset) % workers.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.queues[p].empty()) {
+                item = std::move(victim.queues[p].back());
+                victim.queues[p].pop_back();
+                queuedByPriority[p].fetch_sub(1, std::memory_order_relaxed);
+                stolen.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void TaskExecutor::run(std::size_t index) {
+    currentExecutor = this;
+    currentWorker = index;
+
+    for (;;) {
+        Item item;
+        if (take(index, item)) {
+            queued.fetch_sub(1, std::memory_order_acq_rel);
+            execute(item);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this]() { return stopping || queued.load(std::memory_order_acquire) > 0; });
+        if (stopping && queued.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+void TaskExecutor::execute(Item &item) {
+    const std::int64_t waitUs = microsecondsSince(item.enqueuedAt);
+    totalWaitUs.fetch_add(waitUs, std::memory_order_relaxed);
+    updateMax(maxWaitUs, waitUs);
+
+    if (item.token.isCancelled()) {
+        cancelled.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    running.fetch_add(1, std::memory_order_relaxed);
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        item.task(item.token);
+    } catch (const std::exception &e) {
+        Logger::instance().log(QString("Arka plan görevi hata fırlattı: ") + e.what(), ERROR);
+    } catch (...) {
+        Logger::instance().log("Arka plan görevi bilinmeyen bir hata fırlattı.", ERROR);
+    }
+    const std::int64_t runUs = microsecondsSince(start);
+    running.fetch_sub(1, std::memory_order_relaxed);
+
+    totalRunUs.fetch_add(runUs, std::memory_order_relaxed);
+    updateMax(maxRunUs, runUs);
+    completed.fetch_add(1, std::memory_order_relaxed);
+}
+
+TaskExecutor::Metrics TaskExecutor::metrics() const {
+    Metrics m;
+    m.workers = workers.size();
+    m.queued = queued.load(std::memory_order_relaxed);
+    m.running = running.load(std::memory_order_relaxed);
+    for (std::size_t p = 0; p < PriorityCount; ++p) {
+        m.queuedByPriority[p] = queuedByPriority[p].load(std::memory_order_relaxed);
+    }
+    m.submitted = submitted.load(std::memory_order_relaxed);
+    m.completed = completed.load(std::memory_order_relaxed);
+    m.cancelled = cancelled.load(std::memory_order_relaxed);
+    m.rejected = rejected.load(std::memory_order_relaxed);
+    m.stolen = stolen.load(std::memory_order_relaxed);
+
+    const std::uint64_t started = m.completed + m.cancelled;
+    m.averageWaitUs = started ? static_cast<double>(totalWaitUs.load(std::memory_order_relaxed)) / started : 0.0;
+    m.maxWaitUs = maxWaitUs.load(std::memory_order_relaxed);
+    m.averageRunUs = m.completed ? static_cast<double>(totalRunUs.load(std::memory_order_relaxed)) / m.completed : 0.0;
+    m.maxRunUs = maxRunUs.load(std::memory_order_relaxed);
+    return m;
+}
+
+std::size_t TaskExecutor::queueDepth() const {
+    return queued.load(std::memory_order_relaxed);
+}
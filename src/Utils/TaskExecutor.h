@@ -0,0 +1,150 @@
+#ifndef TASKEXECUTOR_H
+#define TASKEXECUTOR_H
+
+#include <QObject>
+#include <QPointer>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// İşbirlikçi iptal bayrağı. Kopyaları aynı bayrağı paylaşır; henüz başlamamış görevler
+// iptal edilince hiç çalıştırılmaz, çalışan görevler isCancelled() ile kontrol edebilir.
+class CancellationToken {
+public:
+    CancellationToken() : state(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void cancel() const { state->store(true, std::memory_order_release); }
+    bool isCancelled() const { return state->load(std::memory_order_acquire); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> state;
+};
+
+// Uygulama genelinde paylaşılan, sınırlı sayıda thread'li arka plan görev yürütücüsü.
+// Her işçinin öncelik başına kendi kuyruğu vardır; işi biten işçi önce kendi kuyruğuna,
+// sonra diğer işçilerin kuyruklarının arkasına bakar (work stealing). Kuyruk kapasitesi
+// sınırlıdır; dolunca yeni görev reddedilir ve çağıran bunu dönüş değerinden anlar.
+class TaskExecutor {
+public:
+    enum class Priority { High, Normal, Low };
+    static constexpr std::size_t PriorityCount = 3;
+
+    using Task = std::function<void(const CancellationToken &token)>;
+
+    struct Metrics {
+        std::size_t workers = 0;
+        std::size_t queued = 0;           // Kuyrukta bekleyen
+        std::size_t running = 0;          // Şu an çalışan
+        std::array<std::size_t, PriorityCount> queuedByPriority{};
+        std::uint64_t submitted = 0;
+        std::uint64_t completed = 0;
+        std::uint64_t cancelled = 0;      // Başlamadan iptal edilen
+        std::uint64_t rejected = 0;       // Kuyruk dolu olduğu için alınmayan
+        std::uint64_t stolen = 0;         // Başka işçinin kuyruğundan alınan
+        double averageWaitUs = 0.0;       // Kuyrukta bekleme
+        std::int64_t maxWaitUs = 0;
+        double averageRunUs = 0.0;
+        std::int64_t maxRunUs = 0;
+    };
+
+    static TaskExecutor &instance();
+
+    // workerCount 0 ise donanım thread sayısı kullanılır (en az 2)
+    explicit TaskExecutor(std::size_t workerCount = 0, std::size_t capacity = 1024);
+    ~TaskExecutor();
+
+    TaskExecutor(const TaskExecutor &) = delete;
+    TaskExecutor &operator=(const TaskExecutor &) = delete;
+
+    bool submit(Task task, Priority priority = Priority::Normal, CancellationToken token = CancellationToken());
+
+    // work(token) arka planda çalışır; sonucu done(result) ile context'in thread'inde
+    // (genelde GUI) teslim edilir. context silinmişse veya görev iptal edildiyse done çağrılmaz.
+    template <typename Work, typename Done>
+    bool submit(QObject *context, Work work, Done done, Priority priority = Priority::Normal,
+                CancellationToken token = CancellationToken());
+
+    Metrics metrics() const;
+    std::size_t queueDepth() const;
+    std::size_t workerCount() const { return workers.size(); }
+
+    // Kuyruktaki görevleri bitirip işçileri durdurur
+    void shutdown();
+
+private:
+    struct Item {
+        Task task;
+        CancellationToken token;
+        std::chrono::steady_clock::time_point enqueuedAt;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::array<std::deque<Item>, PriorityCount> queues;
+        std::thread thread;
+    };
+
+    void run(std::size_t index);
+    bool take(std::size_t index, Item &item);
+    void execute(Item &item);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    const std::size_t capacity;
+
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    std::atomic<std::size_t> queued{0};
+    std::atomic<std::size_t> running{0};
+    std::array<std::atomic<std::size_t>, PriorityCount> queuedByPriority{};
+    std::atomic<std::size_t> nextWorker{0};
+
+    std::atomic<std::uint64_t> submitted{0};
+    std::atomic<std::uint64_t> completed{0};
+    std::atomic<std::uint64_t> cancelled{0};
+    std::atomic<std::uint64_t> rejected{0};
+    std::atomic<std::uint64_t> stolen{0};
+    std::atomic<std::int64_t> totalWaitUs{0};
+    std::atomic<std::int64_t> maxWaitUs{0};
+    std::atomic<std::int64_t> totalRunUs{0};
+    std::atomic<std::int64_t> maxRunUs{0};
+};
+
+template <typename Work, typename Done>
+bool TaskExecutor::submit(QObject *context, Work work, Done done, Priority priority, CancellationToken token) {
+    QPointer<QObject> guard(context);
+    return submit([guard, work, done](const CancellationToken &taskToken) {
+        if constexpr (std::is_void_v<std::invoke_result_t<Work, const CancellationToken &>>) {
+            work(taskToken);
+            if (taskToken.isCancelled() || !guard) {
+                return;
+            }
+            QMetaObject::invokeMethod(guard, [guard, done, taskToken]() {
+                if (guard && !taskToken.isCancelled()) {
+                    done();
+                }
+            }, Qt::QueuedConnection);
+        } else {
+            auto result = work(taskToken);
+            if (taskToken.isCancelled() || !guard) {
+                return;
+            }
+            QMetaObject::invokeMethod(guard, [guard, done, taskToken, result]() {
+                if (guard && !taskToken.isCancelled()) {
+                    done(result);
+                }
+            }, Qt::QueuedConnection);
+        }
+    }, priority, std::move(token));
+}
+
+#endif // TASKEXECUTOR_H
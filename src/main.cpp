@@ -1,5 +1,8 @@
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QDir>
 #include "MainWindow/MainWindow.h"
+#include "Terrain/TerrainDatabase.h"
 #include "Utils/Logger.h"
 
 int main(int argc, char *argv[])
@@ -9,8 +12,65 @@ int main(int argc, char *argv[])
     // Logger başlatılıyor ve uygulama başlatıldığını belirten mesaj yazılıyor
     Logger::instance().log("Uygulama başlatılıyor...");
 
+    // Yedek MAVLink linkleri: --link udp://:14560 (birden fazla verilebilir)
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption linkOption("link", "Backup MAVLink connection URL opened alongside the selected connection.", "url");
+    parser.addOption(linkOption);
+    // MAVLink akışının dağıtılacağı uç noktalar: --forward "udp://127.0.0.1:14551?deny=0&rate=20000"
+    QCommandLineOption forwardOption("forward", "Forward the vehicle's MAVLink stream to a UDP/TCP endpoint "
+                                                "(query: allow|deny=<ids>, rate=<bytes/s>, burst=<bytes>).", "url");
+    parser.addOption(forwardOption);
+    QCommandLineOption geofenceOption("geofence", "GeoJSON file with keep-out/keep-in geofence polygons.", "file");
+    parser.addOption(geofenceOption);
+    // SRTM .hgt karolarının klasörü (varsayılan: ./terrain)
+    QCommandLineOption terrainOption("terrain", "Directory with SRTM .hgt elevation tiles (N39E032.hgt).", "dir");
+    parser.addOption(terrainOption);
+    // Harita karo paketi ve eksik karoların indirileceği şablon ("none": çevrimdışı)
+    QCommandLineOption tilePackOption("tile-pack", "Map tile pack file (created if missing).", "file",
+                                      QDir::current().filePath("tiles.pack"));
+    parser.addOption(tilePackOption);
+    QCommandLineOption tileUpstreamOption("tile-upstream", "Upstream tile URL template with {z}/{x}/{y}, "
+                                                           "or \"none\" to serve only cached tiles.", "url",
+                                          TileCacheServer::DefaultUpstream);
+    parser.addOption(tileUpstreamOption);
+    // Log kuyruğu dolduğunda: block (varsayılan), drop-oldest, drop
+    QCommandLineOption logOverflowOption("log-overflow", "What log() does when the log queue is full: "
+                                                         "block, drop-oldest or drop.", "policy", "block");
+    parser.addOption(logOverflowOption);
+    parser.process(app);
+
+    const QString logOverflow = parser.value(logOverflowOption);
+    if (logOverflow == "drop-oldest") {
+        Logger::instance().setOverflowPolicy(Logger::OverflowPolicy::DropOldest);
+    } else if (logOverflow == "drop") {
+        Logger::instance().setOverflowPolicy(Logger::OverflowPolicy::Drop);
+    } else if (logOverflow != "block") {
+        Logger::instance().log("Geçersiz log taşma politikası: " + logOverflow, WARNING);
+    }
+
+    if (parser.isSet(terrainOption)) {
+        TerrainDatabase::instance().setDirectory(parser.value(terrainOption));
+    }
+
     // Ana pencereyi oluştur ve göster
     MainWindow mainWindow;
+    mainWindow.getUAVManager()->setBackupLinks(parser.values(linkOption));
+    for (const QString &spec : parser.values(forwardOption)) {
+        MavlinkForwarder::EndpointConfig endpoint;
+        QString error;
+        if (MavlinkForwarder::parseEndpoint(spec, endpoint, &error)) {
+            mainWindow.getUAVManager()->getForwarder()->addEndpoint(endpoint);
+        } else {
+            Logger::instance().log("Geçersiz yönlendirme uç noktası: " + error, WARNING);
+        }
+    }
+    if (parser.isSet(geofenceOption)) {
+        mainWindow.getUAVManager()->getGeofence()->loadFile(parser.value(geofenceOption));
+    }
+    const QString tileUpstream = parser.value(tileUpstreamOption);
+    mainWindow.getTileCache()->start(parser.value(tilePackOption), tileUpstream == "none" ? QString() : tileUpstream);
+    mainWindow.loadMap();
     mainWindow.show();
 
     // Uygulama başlatma mesajı
@@ -0,0 +1,10 @@
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+// Her ölçüm kendi argümanlarını okur (argv[0] alt komutun adıdır) ve süreç çıkış kodunu döner
+int runFleetBenchmark(int argc, char **argv);
+int runGeofenceBenchmark(int argc, char **argv);
+int runLoggerBenchmark(int argc, char **argv);
+int runTrailBenchmark(int argc, char **argv);
+
+#endif // BENCHMARKS_H
@@ -0,0 +1,226 @@
+// Filo yükü: N araç, tek bir MAVSDK callback thread'inden gelen akışları varsayılan hızlarda iletir.
+// Örnekler canlı callback'lerin kullandığı TelemetryHandler giriş yolundan (ingestRecord) geçer;
+// snapshot, geçmiş, istatistik, türetilmiş metrikler, uçuş kaydı ve GUI'ye dağıtım uygulamadaki gibi
+// çalışır. MAVLink ayrıştırması (MAVSDK'nın kendi maliyeti) ölçüme dahil değildir.
+
+#include "Benchmarks.h"
+#include "src/Telemetry/TelemetryHandler.h"
+#include "src/Telemetry/TelemetryTimeSeries.h"
+#include "src/Utils/GeoMath.h"
+#include <QCoreApplication>
+#include <QDir>
+#include <QTemporaryDir>
+#include <QTimer>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Type = TelemetryRecord::Type;
+
+struct Stream {
+    Type type;
+    double rateHz;
+};
+
+// PX4'ün UDP üzerindeki GCS linkinde varsayılan (normal mod) akışlarından türeyen MAVSDK callback hızları
+const Stream DefaultStreams[] = {
+    {Type::Position, 5.0},          // GLOBAL_POSITION_INT
+    {Type::Heading, 5.0},           // GLOBAL_POSITION_INT
+    {Type::VelocityNed, 5.0},       // GLOBAL_POSITION_INT
+    {Type::Attitude, 15.0},         // ATTITUDE
+    {Type::FixedwingMetrics, 4.0},  // VFR_HUD
+    {Type::GpsInfo, 1.0},           // GPS_RAW_INT
+    {Type::Battery, 1.0},           // SYS_STATUS
+    {Type::FlightMode, 1.0},        // HEARTBEAT
+    {Type::Armed, 1.0},             // HEARTBEAT
+    {Type::Health, 1.0},            // SYS_STATUS
+    {Type::RcStatus, 1.0},          // RC_CHANNELS
+};
+
+struct Due {
+    std::int64_t nextUs;
+    std::int64_t periodUs;
+    int vehicle;
+    Type type;
+};
+
+// Araçlar 50 m yarıçaplı dairelerde döner; her araç farklı fazda
+void ingest(TelemetryHandler &handler, Type type, std::int64_t timestampUs, int vehicle)
+{
+    const double t = timestampUs * 1e-6;
+    const double angle = 0.2 * t + vehicle;
+    switch (type) {
+    case Type::Position: {
+        mavsdk::Telemetry::Position value;
+        value.latitude_deg = 39.9 + 0.01 * vehicle + 0.00045 * std::sin(angle);
+        value.longitude_deg = 32.8 + 0.00058 * std::cos(angle);
+        value.absolute_altitude_m = 950.0f + vehicle;
+        value.relative_altitude_m = 100.0f;
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::Heading: {
+        mavsdk::Telemetry::Heading value;
+        value.heading_deg = std::fmod(GeoMath::toDegrees(angle) + 90.0, 360.0);
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::VelocityNed: {
+        mavsdk::Telemetry::VelocityNed value;
+        value.north_m_s = static_cast<float>(10.0 * std::cos(angle));
+        value.east_m_s = static_cast<float>(-10.0 * std::sin(angle));
+        value.down_m_s = 0.0f;
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::Attitude: {
+        mavsdk::Telemetry::EulerAngle value;
+        value.roll_deg = 12.0f;
+        value.pitch_deg = 2.0f;
+        value.yaw_deg = static_cast<float>(std::fmod(GeoMath::toDegrees(angle) + 90.0, 360.0));
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::FixedwingMetrics: {
+        mavsdk::Telemetry::FixedwingMetrics value;
+        value.airspeed_m_s = 10.0f;
+        value.climb_rate_m_s = 0.0f;
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::GpsInfo: {
+        mavsdk::Telemetry::GpsInfo value;
+        value.num_satellites = 14;
+        value.fix_type = mavsdk::Telemetry::FixType::Fix3D;
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::Battery: {
+        mavsdk::Telemetry::Battery value;
+        value.voltage_v = 15.8f;
+        value.remaining_percent = static_cast<float>(std::max(0.0, 100.0 - t / 10.0));
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::FlightMode: {
+        const mavsdk::Telemetry::FlightMode value = mavsdk::Telemetry::FlightMode::Mission;
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::Armed: {
+        const bool value = true;
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::Health: {
+        const mavsdk::Telemetry::Health value{};
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    case Type::RcStatus: {
+        const mavsdk::Telemetry::RcStatus value{};
+        handler.ingestRecord(type, timestampUs, &value, sizeof(value));
+        break;
+    }
+    }
+}
+
+double processCpuSeconds()
+{
+    return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;  // Bütün thread'ler
+}
+
+} // namespace
+
+int runFleetBenchmark(int argc, char **argv)
+{
+    const int vehicleCount = argc > 1 ? std::atoi(argv[1]) : 50;
+    const int durationSec = argc > 2 ? std::atoi(argv[2]) : 20;
+    if (vehicleCount < 1 || vehicleCount > 255 || durationSec < 1) {
+        std::fprintf(stderr, "Araç sayısı 1-255, süre en az 1 sn olmalı.\n");
+        return 2;
+    }
+
+    QCoreApplication app(argc, argv);
+    QTemporaryDir recordings;
+    if (!recordings.isValid()) {
+        std::fprintf(stderr, "Geçici kayıt klasörü oluşturulamadı.\n");
+        return 1;
+    }
+
+    // UAVManager'daki gibi: ilk araç tam geçmiş, diğerleri 5 dakika tutar; hepsi kayıt alır
+    std::vector<std::unique_ptr<TelemetryHandler>> handlers;
+    std::atomic<quint64> frames{0};
+    for (int i = 0; i < vehicleCount; ++i) {
+        auto handler = std::make_unique<TelemetryHandler>(nullptr);
+        TelemetryTimeSeries::Config config;
+        if (i > 0) {
+            config.retention = std::chrono::minutes(5);
+        }
+        handler->setTimeSeriesConfig(config);
+        handler->startRecording(QDir(recordings.path()).filePath("sys" + QString::number(i + 1) + ".uavrec"));
+        QObject::connect(handler.get(), &TelemetryHandler::telemetrySnapshotUpdated, &app,
+                         [&frames](const TelemetrySnapshot &, quint32) { frames.fetch_add(1, std::memory_order_relaxed); });
+        handlers.push_back(std::move(handler));
+    }
+
+    // Araçlar periyot içinde eşit aralıklarla başlar ki callback'ler aynı milisaniyeye yığılmasın
+    std::vector<Due> schedule;
+    const std::int64_t startUs = TelemetryTimeSeries::now();
+    for (int vehicle = 0; vehicle < vehicleCount; ++vehicle) {
+        for (const Stream &stream : DefaultStreams) {
+            const std::int64_t periodUs = static_cast<std::int64_t>(1e6 / stream.rateHz);
+            schedule.push_back({startUs + periodUs * vehicle / vehicleCount, periodUs, vehicle, stream.type});
+        }
+    }
+
+    std::atomic<bool> stopRequested{false};
+    std::atomic<quint64> callbacks{0};
+    const double cpuStart = processCpuSeconds();
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    // Tek UDP portu = tek Mavsdk örneği = bütün araçların callback'leri tek thread'de
+    std::thread callbackThread([&]() {
+        while (!stopRequested.load(std::memory_order_acquire)) {
+            const std::int64_t nowUs = TelemetryTimeSeries::now();
+            quint64 delivered = 0;
+            for (Due &due : schedule) {
+                if (nowUs >= due.nextUs) {
+                    ingest(*handlers[static_cast<std::size_t>(due.vehicle)], due.type, nowUs, due.vehicle);
+                    due.nextUs += due.periodUs;
+                    ++delivered;
+                }
+            }
+            callbacks.fetch_add(delivered, std::memory_order_relaxed);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    QTimer::singleShot(durationSec * 1000, &app, &QCoreApplication::quit);
+    app.exec();
+    stopRequested.store(true, std::memory_order_release);
+    callbackThread.join();
+
+    const double cpuSec = processCpuSeconds() - cpuStart;
+    const double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    const double cpuPercent = 100.0 * cpuSec / wallSec;
+    const quint64 delivered = callbacks.load();
+
+    std::printf("araç: %d, süre: %.1f sn\n", vehicleCount, wallSec);
+    std::printf("callback: %llu (%.0f/sn), GUI karesi: %llu (%.0f/sn)\n", static_cast<unsigned long long>(delivered),
+                delivered / wallSec, static_cast<unsigned long long>(frames.load()), frames.load() / wallSec);
+    std::printf("CPU: toplam %.2f%% tek çekirdek, araç başına %.3f%%, callback başına %.2f us\n", cpuPercent,
+                cpuPercent / vehicleCount, delivered ? 1e6 * cpuSec / delivered : 0.0);
+
+    handlers.clear();
+    return 0;
+}
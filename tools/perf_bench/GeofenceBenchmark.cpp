@@ -0,0 +1,190 @@
+// Geofence sorgu maliyeti: 110 km'lik karede rastgele yıldız çokgenler (varsayılan 3000 bölge,
+// ~201k kenar) ve hepsini kapsayan bir keep-in bölgesi. Örneklem noktalarında sonuç kaba kuvvet
+// nokta-çokgen ve sınır mesafesi hesabıyla karşılaştırılır, sonra sorgu başına süre ölçülür.
+
+#include "Benchmarks.h"
+#include "src/Geofence/GeofenceIndex.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr double CenterLat = 39.9;
+constexpr double CenterLon = 32.8;
+constexpr double AreaM = 110000.0;
+constexpr int VerticesPerZone = 67;
+constexpr double MarginM = 50.0;
+constexpr int VerifiedQueries = 20000;
+
+struct Box {
+    double minX, minY, maxX, maxY;
+};
+
+struct LocalZone {
+    GeofenceZone::Type type;
+    std::vector<double> xs, ys;
+    Box box;
+};
+
+bool inside(const LocalZone &zone, double x, double y)
+{
+    bool result = false;
+    const std::size_t count = zone.xs.size();
+    for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+        if ((zone.ys[i] > y) != (zone.ys[j] > y)
+            && x < (zone.xs[j] - zone.xs[i]) * (y - zone.ys[i]) / (zone.ys[j] - zone.ys[i]) + zone.xs[i]) {
+            result = !result;
+        }
+    }
+    return result;
+}
+
+double boundaryDistance(const LocalZone &zone, double x, double y)
+{
+    double best = std::numeric_limits<double>::max();
+    const std::size_t count = zone.xs.size();
+    for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+        const double dx = zone.xs[i] - zone.xs[j];
+        const double dy = zone.ys[i] - zone.ys[j];
+        const double lengthSquared = dx * dx + dy * dy;
+        double t = lengthSquared > 0.0 ? ((x - zone.xs[j]) * dx + (y - zone.ys[j]) * dy) / lengthSquared : 0.0;
+        t = std::clamp(t, 0.0, 1.0);
+        best = std::min(best, std::hypot(zone.xs[j] + t * dx - x, zone.ys[j] + t * dy - y));
+    }
+    return best;
+}
+
+// GeofenceIndex::evaluate ile aynı kurallar, indekssiz
+GeofenceIndex::State bruteForce(const std::vector<LocalZone> &zones, double x, double y)
+{
+    bool insideKeepIn = false;
+    bool hasKeepIn = false;
+    for (const LocalZone &zone : zones) {
+        hasKeepIn = hasKeepIn || zone.type == GeofenceZone::Type::KeepIn;
+        if (x < zone.box.minX || x > zone.box.maxX || y < zone.box.minY || y > zone.box.maxY || !inside(zone, x, y)) {
+            continue;
+        }
+        if (zone.type == GeofenceZone::Type::KeepOut) {
+            return GeofenceIndex::State::Breach;
+        }
+        insideKeepIn = true;
+    }
+    if (hasKeepIn && !insideKeepIn) {
+        return GeofenceIndex::State::Breach;
+    }
+    for (const LocalZone &zone : zones) {
+        if (x < zone.box.minX - MarginM || x > zone.box.maxX + MarginM || y < zone.box.minY - MarginM
+            || y > zone.box.maxY + MarginM) {
+            continue;
+        }
+        // Keep-out'ların dışındayız ve bütün keep-in'lerin içindeyiz: her sınır yakınlığı sayılır
+        if (boundaryDistance(zone, x, y) < MarginM) {
+            return GeofenceIndex::State::Near;
+        }
+    }
+    return GeofenceIndex::State::Clear;
+}
+
+} // namespace
+
+int runGeofenceBenchmark(int argc, char **argv)
+{
+    const int zoneCount = argc > 1 ? std::atoi(argv[1]) : 3000;
+    const int queryCount = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    if (zoneCount < 2 || queryCount < 1) {
+        std::fprintf(stderr, "En az 2 bölge ve 1 sorgu gerekli.\n");
+        return 2;
+    }
+
+    const GeoMath::LocalProjection projection(CenterLat, CenterLon);
+    std::mt19937_64 random(18);
+    std::uniform_real_distribution<double> position(-AreaM / 2.0, AreaM / 2.0);
+    std::uniform_real_distribution<double> radius(300.0, 1500.0);
+    std::uniform_real_distribution<double> jitter(0.55, 1.0);
+
+    std::vector<GeofenceZone> zones;
+    std::vector<LocalZone> localZones;
+    auto addZone = [&](GeofenceZone::Type type, const std::vector<double> &xs, const std::vector<double> &ys) {
+        GeofenceZone zone;
+        zone.id = static_cast<int>(zones.size()) + 1;
+        zone.type = type;
+        zone.marginM = MarginM;
+        LocalZone local{type, {}, {}, {1e300, 1e300, -1e300, -1e300}};
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            GeoPoint point;
+            projection.toGeo(xs[i], ys[i], point.latitudeDeg, point.longitudeDeg);
+            zone.ring.push_back(point);
+            // Kaba kuvvet tarafı da indeksle aynı projeksiyondan geçen koordinatları kullanır
+            double x, y;
+            projection.toLocal(point.latitudeDeg, point.longitudeDeg, x, y);
+            local.xs.push_back(x);
+            local.ys.push_back(y);
+            local.box = {std::min(local.box.minX, x), std::min(local.box.minY, y), std::max(local.box.maxX, x),
+                         std::max(local.box.maxY, y)};
+        }
+        zones.push_back(std::move(zone));
+        localZones.push_back(std::move(local));
+    };
+
+    const double half = AreaM / 2.0 + 2000.0;
+    addZone(GeofenceZone::Type::KeepIn, {-half, half, half, -half}, {-half, -half, half, half});
+    for (int i = 1; i < zoneCount; ++i) {
+        const double cx = position(random);
+        const double cy = position(random);
+        const double r = radius(random);
+        std::vector<double> xs, ys;
+        for (int k = 0; k < VerticesPerZone; ++k) {
+            const double angle = 2.0 * GeoMath::Pi * k / VerticesPerZone;
+            const double length = r * jitter(random);
+            xs.push_back(cx + length * std::cos(angle));
+            ys.push_back(cy + length * std::sin(angle));
+        }
+        addZone(GeofenceZone::Type::KeepOut, xs, ys);
+    }
+
+    const auto buildStart = std::chrono::steady_clock::now();
+    const GeofenceIndex index(zones);
+    const double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+    std::printf("bölge: %zu, kenar: %zu, hücre: %zu (%.0f m), bellek: %.1f MB, kurulum: %.0f ms\n", index.zoneCount(),
+                index.edgeCount(), index.cellCount(), index.cellSizeM(), index.memoryBytes() / 1048576.0, buildMs);
+
+    std::vector<GeoPoint> queries(static_cast<std::size_t>(queryCount));
+    std::vector<double> localX(queries.size()), localY(queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        projection.toGeo(position(random), position(random), queries[i].latitudeDeg, queries[i].longitudeDeg);
+        projection.toLocal(queries[i].latitudeDeg, queries[i].longitudeDeg, localX[i], localY[i]);
+    }
+
+    // Doğruluk: durum (Clear/Near/Breach) kaba kuvvetle aynı olmalı
+    const std::size_t verified = std::min<std::size_t>(queries.size(), VerifiedQueries);
+    std::size_t mismatches = 0;
+    std::size_t states[3] = {0, 0, 0};
+    for (std::size_t i = 0; i < verified; ++i) {
+        const GeofenceIndex::State expected = bruteForce(localZones, localX[i], localY[i]);
+        const GeofenceIndex::State actual = index.evaluate(queries[i].latitudeDeg, queries[i].longitudeDeg).state;
+        ++states[static_cast<int>(expected)];
+        if (expected != actual) {
+            ++mismatches;
+        }
+    }
+    std::printf("doğrulama: %zu nokta (clear %zu, near %zu, breach %zu), uyuşmazlık: %zu\n", verified, states[0],
+                states[1], states[2], mismatches);
+
+    int checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const GeoPoint &query : queries) {
+        checksum += static_cast<int>(index.evaluate(query.latitudeDeg, query.longitudeDeg).state);
+    }
+    const double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    const double perQueryNs = elapsedNs / queries.size();
+    // 50 Hz x 100 araç = saniyede 5000 sorgu
+    std::printf("sorgu: %.0f ns, 50 Hz x 100 araç: tek çekirdeğin %%%.2f'si (kontrol %d)\n", perQueryNs,
+                100.0 * perQueryNs * 5000.0 / 1e9, checksum);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+// Logger::log çağrı maliyeti: eski senkron yol (sinyal + global mutex + QTextStream + QDateTime +
+// dosyaya yazma) ile kuyruklu Logger karşılaştırılır. Kuyruklu yol iki şekilde ölçülür:
+// kuyruğa sığan kısa patlama (çağıranın gördüğü gecikme) ve yazıcının hızıyla sınırlı sürekli yük.
+
+#include "Benchmarks.h"
+#include "src/Utils/Logger.h"
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QMutex>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Kuyruklu Logger'dan önceki Logger::log'un aynısı, iki farkla: dosya sadece yapıcıda açılır (eski
+// rotateLogFile log() içinden çağrılınca aynı mutex'i tekrar kilitleyip kilitleniyordu) ve son mesaj
+// kilit içinde yazılır (eskiden kilitsizdi, çok thread'li ölçümde veri yarışı olurdu).
+class LegacyLogger : public QObject {
+    Q_OBJECT
+
+public:
+    explicit LegacyLogger(const QString &path) : logFile(path) {
+        logFile.open(QIODevice::Append | QIODevice::Text);
+    }
+
+    void log(const QString &message, LogLevel level = INFO) {
+        QMutexLocker locker(&mutex);
+        lastStatusMessage = message;
+        lastStatusLevel = level;
+        emit StatusDataUpdated();
+
+        if (logFile.isOpen()) {
+            QTextStream out(&logFile);
+            QString levelStr;
+            switch (level) {
+            case INFO: levelStr = "INFO"; break;
+            case DEBUG: levelStr = "DEBUG"; break;
+            case ERROR: levelStr = "ERROR"; break;
+            case WARNING: levelStr = "WARNING"; break;
+            }
+            out << QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss") << " - " << levelStr << " - " << message
+                << "\n";
+        }
+    }
+
+    QString lastStatusMessage;
+    LogLevel lastStatusLevel = INFO;
+
+signals:
+    void StatusDataUpdated();
+
+private:
+    QFile logFile;
+    QMutex mutex;
+};
+
+// calls çağrı threads thread'e bölünür; çağrı başına ortalama ns (thread'in kendi süresi)
+double measure(int calls, int threads, const std::function<void(int)> &call)
+{
+    std::vector<double> elapsedNs(static_cast<std::size_t>(threads));
+    std::vector<std::thread> workers;
+    const int perThread = calls / threads;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < perThread; ++i) {
+                call(i);
+            }
+            elapsedNs[static_cast<std::size_t>(t)] =
+                std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        });
+    }
+    double total = 0.0;
+    for (int t = 0; t < threads; ++t) {
+        workers[static_cast<std::size_t>(t)].join();
+        total += elapsedNs[static_cast<std::size_t>(t)];
+    }
+    return total / (static_cast<double>(perThread) * threads);
+}
+
+} // namespace
+
+int runLoggerBenchmark(int argc, char **argv)
+{
+    const int calls = argc > 1 ? std::atoi(argv[1]) : 200000;
+    const int threads = argc > 2 ? std::atoi(argv[2]) : 1;
+    if (calls < 1 || threads < 1 || threads > 64) {
+        std::fprintf(stderr, "Çağrı sayısı en az 1, thread sayısı 1-64 olmalı.\n");
+        return 2;
+    }
+
+    QCoreApplication app(argc, argv);
+    QTemporaryDir directory;
+    if (!directory.isValid()) {
+        std::fprintf(stderr, "Geçici log klasörü oluşturulamadı.\n");
+        return 1;
+    }
+    const QString message = QStringLiteral("Position update: lat 39.9000000 lon 32.8000000 alt 100.0 m");
+
+    LegacyLogger legacy(QDir(directory.path()).filePath("legacy.log"));
+    const double legacyNs = measure(calls, threads, [&](int) { legacy.log(message, INFO); });
+
+    Logger &logger = Logger::instance();
+    logger.setLogFilePath(directory.path());
+    logger.setOverflowPolicy(Logger::OverflowPolicy::Block);
+    // Yazıcının yeni klasöre geçmesi ve kuyruğun boşalması için
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Kuyruğun yarısı: yazıcı geride kalsa da çağıran beklemez
+    const int burst = static_cast<int>(Logger::QueueCapacity / 2);
+    const double burstNs = measure(burst, threads, [&](int) { logger.log(message, INFO); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const double structuredBurstNs = measure(burst, threads, [&](int i) {
+        LOG_STRUCTURED(INFO, "Position update: lat %1 lon %2 alt %3 m", 39.9, 32.8 + i * 1e-7, 100.0);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const double sustainedNs = measure(calls, threads, [&](int) { logger.log(message, INFO); });
+
+    std::printf("%d çağrı, %d thread\n", calls, threads);
+    std::printf("eski senkron log():           %8.0f ns/çağrı\n", legacyNs);
+    std::printf("kuyruklu log(), patlama:      %8.0f ns/çağrı (%d çağrı)\n", burstNs, burst);
+    std::printf("LOG_STRUCTURED, patlama:      %8.0f ns/çağrı (%d çağrı)\n", structuredBurstNs, burst);
+    std::printf("kuyruklu log(), sürekli:      %8.0f ns/çağrı (yazıcı hızıyla sınırlı)\n", sustainedNs);
+    std::printf("atılan mesaj: %llu\n", static_cast<unsigned long long>(logger.droppedCount()));
+    return 0;
+}
+
+#include "LoggerBenchmark.moc"
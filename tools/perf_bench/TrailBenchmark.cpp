@@ -0,0 +1,191 @@
+// İz sadeleştirme: 1M noktalık sentetik uçuş (serbest dolaşma, loiter, düz hat ve tarama zikzağı,
+// araya havada asılı kalma tekrarları) TrailDecimator'a eklenir. Nokta başına ekleme süresi, bellek,
+// seviye başına köşe sayısı, seviye yolunun kurulma süresi ve tam ize göre en büyük sapma yazılır.
+
+#include "Benchmarks.h"
+#include "src/Map/TrailDecimator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr double OriginLat = 39.9;
+constexpr double OriginLon = 32.8;
+constexpr double StepM = 1.2;           // 12 m/s, 10 Hz
+constexpr double MaxRangeM = 15000.0;   // Araç bu yarıçapta kalır
+constexpr int SegmentPoints = 20000;
+
+// Sentetik iz yerel metre cinsinden üretilir
+class FlightGenerator {
+public:
+    explicit FlightGenerator(std::uint64_t seed) : random(seed) {}
+
+    void next(double &x, double &y) {
+        if (remaining == 0) {
+            startSegment();
+        }
+        --remaining;
+        switch (mode) {
+        case Mode::Wander:
+            heading += turn(random);
+            if (std::hypot(px, py) > MaxRangeM) {
+                heading = std::atan2(-py, -px);  // Merkeze dön
+            }
+            move(heading);
+            break;
+        case Mode::Loiter: {
+            loiterAngle += StepM / LoiterRadiusM;
+            px = loiterX + LoiterRadiusM * std::cos(loiterAngle) + noise(random);
+            py = loiterY + LoiterRadiusM * std::sin(loiterAngle) + noise(random);
+            break;
+        }
+        case Mode::Straight:
+            move(heading);
+            break;
+        case Mode::Zigzag:
+            // 400 m'lik şeritler, şerit sonunda 40 m kayma
+            if (++legStep > 333) {
+                legStep = 0;
+                heading += GeoMath::Pi;
+                px += 40.0 * std::cos(heading + GeoMath::Pi / 2);
+                py += 40.0 * std::sin(heading + GeoMath::Pi / 2);
+            }
+            move(heading);
+            break;
+        case Mode::Hover:
+            break;  // Aynı nokta tekrar eder
+        }
+        x = px;
+        y = py;
+    }
+
+private:
+    enum class Mode { Wander, Loiter, Straight, Zigzag, Hover };
+    static constexpr double LoiterRadiusM = 80.0;
+
+    void startSegment() {
+        mode = static_cast<Mode>(segment++ % 5);
+        remaining = mode == Mode::Hover ? SegmentPoints / 10 : SegmentPoints;
+        if (std::hypot(px, py) > MaxRangeM / 2) {
+            heading = std::atan2(-py, -px);
+        }
+        loiterX = px - LoiterRadiusM;
+        loiterY = py;
+        loiterAngle = 0.0;
+        legStep = 0;
+    }
+
+    void move(double direction) {
+        px += StepM * std::cos(direction);
+        py += StepM * std::sin(direction);
+    }
+
+    std::mt19937_64 random;
+    std::normal_distribution<double> turn{0.0, 0.05};
+    std::normal_distribution<double> noise{0.0, 0.3};
+    Mode mode = Mode::Wander;
+    int segment = 0;
+    int remaining = 0;
+    double px = 0.0, py = 0.0, heading = 0.0;
+    double loiterX = 0.0, loiterY = 0.0, loiterAngle = 0.0;
+    int legStep = 0;
+};
+
+double segmentDistance(double px, double py, double ax, double ay, double bx, double by)
+{
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double lengthSquared = dx * dx + dy * dy;
+    double t = lengthSquared > 0.0 ? ((px - ax) * dx + (py - ay) * dy) / lengthSquared : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    return std::hypot(ax + t * dx - px, ay + t * dy - py);
+}
+
+} // namespace
+
+int runTrailBenchmark(int argc, char **argv)
+{
+    const long pointCount = argc > 1 ? std::atol(argv[1]) : 1000000;
+    if (pointCount < 2) {
+        std::fprintf(stderr, "En az 2 nokta gerekli.\n");
+        return 2;
+    }
+
+    const GeoMath::LocalProjection projection(OriginLat, OriginLon);
+    FlightGenerator generator(21);
+    std::vector<GeoPoint> input(static_cast<std::size_t>(pointCount));
+    for (GeoPoint &point : input) {
+        double x, y;
+        generator.next(x, y);
+        projection.toGeo(x, y, point.latitudeDeg, point.longitudeDeg);
+    }
+
+    TrailDecimator trail;
+    std::vector<bool> accepted(input.size());
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        accepted[i] = trail.append(input[i].latitudeDeg, input[i].longitudeDeg);
+    }
+    const double appendNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::printf("nokta: %zu (%zu tekrar atıldı), ekleme: %.0f ns/nokta, bellek: %.1f MB\n", trail.pointCount(),
+                input.size() - trail.pointCount(), appendNs / input.size(), trail.memoryBytes() / 1048576.0);
+
+    // Tam iz, TrailDecimator'ın sakladığı 1e-7 derece çözünürlükte
+    std::vector<std::int64_t> keys;
+    std::vector<double> xs, ys;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        if (!accepted[i]) {
+            continue;
+        }
+        const std::int64_t latitudeE7 = std::llround(input[i].latitudeDeg * 1e7);
+        const std::int64_t longitudeE7 = std::llround(input[i].longitudeDeg * 1e7);
+        keys.push_back(latitudeE7 * 4000000000LL + longitudeE7);
+        double x, y;
+        projection.toLocal(latitudeE7 * 1e-7, longitudeE7 * 1e-7, x, y);
+        xs.push_back(x);
+        ys.push_back(y);
+    }
+
+    int result = 0;
+    for (int level = 0; level < TrailDecimator::LevelCount; ++level) {
+        const auto buildStart = std::chrono::steady_clock::now();
+        const std::vector<GeoPoint> path = trail.vertices(level);
+        const double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+
+        // Her nokta, kendisini kapsayan iki köşe arasındaki parçaya olan mesafesiyle ölçülür
+        double maxDeviationM = 0.0;
+        std::size_t vertex = 0;
+        double ax, ay, bx = 0.0, by = 0.0;
+        projection.toLocal(path[0].latitudeDeg, path[0].longitudeDeg, ax, ay);
+        if (path.size() > 1) {
+            projection.toLocal(path[1].latitudeDeg, path[1].longitudeDeg, bx, by);
+        }
+        for (std::size_t i = 0; i < keys.size() && vertex + 1 < path.size(); ++i) {
+            maxDeviationM = std::max(maxDeviationM, segmentDistance(xs[i], ys[i], ax, ay, bx, by));
+            const std::int64_t next = std::llround(path[vertex + 1].latitudeDeg * 1e7) * 4000000000LL +
+                                      std::llround(path[vertex + 1].longitudeDeg * 1e7);
+            if (keys[i] == next && ++vertex + 1 < path.size()) {
+                ax = bx;
+                ay = by;
+                projection.toLocal(path[vertex + 1].latitudeDeg, path[vertex + 1].longitudeDeg, bx, by);
+            }
+        }
+
+        const double toleranceM = TrailDecimator::toleranceM(level);
+        // Kiriş doğrultusunda geri dönüşte sınır √2 * tolerans
+        const bool withinBound = maxDeviationM <= toleranceM * std::sqrt(2.0) + 1e-6;
+        std::printf("seviye %d (%.1f m): %zu köşe, yol %.2f ms, en büyük sapma %.2f m%s\n", level, toleranceM,
+                    path.size(), buildMs, maxDeviationM,
+                    maxDeviationM <= toleranceM ? "" : (withinBound ? " (√2 sınırı içinde)" : " SINIR AŞILDI"));
+        if (!withinBound) {
+            result = 1;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,49 @@
+// Commit mesajlarında verilen performans ölçümlerini tekrar üreten konsol aracı.
+//   perf_bench <ölçüm> [argümanlar]
+// Sonuçlar makineye bağlıdır; karşılaştırma için aynı makinede önceki ve sonraki sürüm çalıştırılmalıdır.
+
+#include "Benchmarks.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+struct Benchmark {
+    const char *name;
+    const char *arguments;
+    const char *description;
+    int (*run)(int argc, char **argv);
+};
+
+const Benchmark benchmarks[] = {
+    {"fleet", "[araç=50] [süre_sn=20]", "Varsayılan akış hızlarında N aracın telemetri işleme CPU'su", runFleetBenchmark},
+    {"geofence", "[bölge=3000] [sorgu=1000000]", "Geofence sorgu süresi ve kaba kuvvetle doğrulama", runGeofenceBenchmark},
+    {"logger", "[çağrı=200000] [thread=1]", "Eski senkron Logger::log ile kuyruklu Logger karşılaştırması", runLoggerBenchmark},
+    {"trail", "[nokta=1000000]", "İz sadeleştirme: ekleme süresi, bellek, köşe sayısı ve sapma", runTrailBenchmark},
+};
+
+void printUsage(const char *program)
+{
+    std::fprintf(stderr, "Kullanım: %s <ölçüm> [argümanlar]\n", program);
+    for (const Benchmark &benchmark : benchmarks) {
+        std::fprintf(stderr, "  %-9s %-28s %s\n", benchmark.name, benchmark.arguments, benchmark.description);
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        printUsage(argv[0]);
+        return 2;
+    }
+    for (const Benchmark &benchmark : benchmarks) {
+        if (std::strcmp(argv[1], benchmark.name) == 0) {
+            return benchmark.run(argc - 1, argv + 1);
+        }
+    }
+    std::fprintf(stderr, "Bilinmeyen ölçüm: %s\n", argv[1]);
+    printUsage(argv[0]);
+    return 2;
+}
@@ -0,0 +1,39 @@
+# Performans ölçümleri (bkz. main.cpp). Uygulamanın kaynaklarını doğrudan derler.
+TEMPLATE = app
+TARGET = perf_bench
+QT = core gui widgets
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += \
+    main.cpp \
+    FleetBenchmark.cpp \
+    GeofenceBenchmark.cpp \
+    LoggerBenchmark.cpp \
+    TrailBenchmark.cpp \
+    ../../src/Geofence/GeofenceIndex.cpp \
+    ../../src/Map/TrailDecimator.cpp \
+    ../../src/Telemetry/DerivedMetrics.cpp \
+    ../../src/Telemetry/FlightRecorder.cpp \
+    ../../src/Telemetry/TelemetryHandler.cpp \
+    ../../src/Telemetry/TelemetryStatistics.cpp \
+    ../../src/Telemetry/TelemetrySubscriptionRegistry.cpp \
+    ../../src/Telemetry/TelemetryTimeSeries.cpp \
+    ../../src/Terrain/TerrainDatabase.cpp \
+    ../../src/Utils/Logger.cpp \
+    ../../src/Utils/StreamingStatistics.cpp \
+    ../../src/Utils/TaskExecutor.cpp
+
+HEADERS += \
+    Benchmarks.h \
+    ../../src/Telemetry/TelemetryHandler.h \
+    ../../src/Telemetry/TelemetrySubscriptionRegistry.h \
+    ../../src/Utils/Logger.h
+
+# MAVSDK (ana proje ile aynı kurulum)
+INCLUDEPATH += /home/efe/MAVSDK/install/include
+INCLUDEPATH += /home/efe/MAVSDK/install/include/mavsdk
+LIBS += -L/home/efe/MAVSDK/install/lib
+LIBS += -lmavsdk
@@ -0,0 +1,128 @@
+// Yapılandırılmış log dosyasını (.ulog) application.log ile aynı biçimde metne çevirir.
+//   ulog_decode application_20240101_120000_000.ulog [çıktı.log]
+// Qt'ye bağlı değildir; uygulamanın yazdığı formatı src/Utils/StructuredLog.h ile okur.
+
+#include "../../src/Utils/StructuredLog.h"
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Logger'daki LogLevel sırası
+const char *levelName(unsigned level)
+{
+    static const char *names[] = {"INFO", "DEBUG", "ERROR", "WARNING"};
+    return level < sizeof(names) / sizeof(names[0]) ? names[level] : "UNKNOWN";
+}
+
+std::string formatTimestamp(std::int64_t ms)
+{
+    const std::time_t seconds = static_cast<std::time_t>(ms / 1000);
+    std::tm local{};
+    localtime_r(&seconds, &local);
+    char buffer[32];
+    const std::size_t length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &local);
+    std::snprintf(buffer + length, sizeof(buffer) - length, ".%03d", static_cast<int>(ms % 1000));
+    return buffer;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || argc > 3) {
+        std::fprintf(stderr, "Kullanım: %s <dosya.ulog> [çıktı.log]\n", argv[0]);
+        return 2;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input) {
+        std::fprintf(stderr, "Dosya açılamadı: %s\n", argv[1]);
+        return 1;
+    }
+    const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    StructuredLog::FileHeader header{};
+    if (data.size() < sizeof(header)) {
+        std::fprintf(stderr, "Dosya başlığı eksik.\n");
+        return 1;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, StructuredLog::FileMagic, sizeof(header.magic)) != 0
+        || header.version != StructuredLog::FileVersion || header.headerSize < sizeof(header)
+        || header.headerSize > data.size()) {
+        std::fprintf(stderr, "Geçersiz ya da desteklenmeyen .ulog dosyası.\n");
+        return 1;
+    }
+
+    FILE *output = stdout;
+    if (argc == 3) {
+        output = std::fopen(argv[2], "w");
+        if (!output) {
+            std::fprintf(stderr, "Çıktı dosyası açılamadı: %s\n", argv[2]);
+            return 1;
+        }
+    }
+
+    std::unordered_map<std::uint64_t, std::string> formats;
+    std::vector<StructuredLog::Argument> arguments;
+    std::int64_t timestampMs = header.startWallClockMs;
+    std::size_t messages = 0;
+    bool truncated = false;
+
+    const std::uint8_t *p = data.data() + header.headerSize;
+    const std::uint8_t *end = data.data() + data.size();
+    while (p < end) {
+        const std::uint8_t kind = *p >> 4;
+        const unsigned level = *p & 0x0F;
+        ++p;
+
+        std::uint64_t id = 0;
+        std::uint64_t length = 0;
+        if (kind == static_cast<std::uint8_t>(StructuredLog::Kind::Format)) {
+            if (!StructuredLog::readVarint(p, end, id) || !StructuredLog::readVarint(p, end, length)
+                || length > static_cast<std::uint64_t>(end - p)) {
+                truncated = true;
+                break;
+            }
+            formats[id].assign(reinterpret_cast<const char *>(p), static_cast<std::size_t>(length));
+            p += length;
+        } else if (kind == static_cast<std::uint8_t>(StructuredLog::Kind::Message)) {
+            std::uint64_t delta = 0;
+            if (!StructuredLog::readVarint(p, end, delta) || !StructuredLog::readVarint(p, end, id)
+                || !StructuredLog::readVarint(p, end, length) || length > static_cast<std::uint64_t>(end - p)) {
+                truncated = true;
+                break;
+            }
+            timestampMs += StructuredLog::unzigzag(delta);
+            const auto format = formats.find(id);
+            std::string text;
+            if (format == formats.end()) {
+                text = "<bilinmeyen biçim " + std::to_string(id) + ">";
+            } else if (!StructuredLog::decodeArguments(p, p + length, arguments)) {
+                text = format->second + " <bozuk argümanlar>";
+            } else {
+                text = StructuredLog::formatMessage(format->second, arguments);
+            }
+            p += length;
+            std::fprintf(output, "%s - %s - %s\n", formatTimestamp(timestampMs).c_str(), levelName(level), text.c_str());
+            ++messages;
+        } else {
+            truncated = true;  // Bilinmeyen kayıt türünün uzunluğu bilinmez, devam edilemez
+            break;
+        }
+    }
+
+    if (output != stdout) {
+        std::fclose(output);
+    }
+    if (truncated) {
+        std::fprintf(stderr, "Uyarı: dosya %zu mesajdan sonra yarım ya da bozuk.\n", messages);
+    }
+    return 0;
+}
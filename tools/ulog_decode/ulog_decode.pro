@@ -0,0 +1,11 @@
+# Yapılandırılmış log (.ulog) çözücüsü; Qt kütüphanelerine bağlı değildir
+TEMPLATE = app
+TARGET = ulog_decode
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+
+SOURCES += \
+    main.cpp
+
+HEADERS += \
+    ../../src/Utils/StructuredLog.h